@@ -0,0 +1,145 @@
+/**
+ * @file arena_plan.cpp
+ * @brief Recording memory planner and CSV dump of the tensor arena layout
+ */
+
+#include "arena_plan.h"
+
+#include <new>
+
+#include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+void ArenaPlan::Reset() {
+  planner_.~GreedyMemoryPlanner();
+  new (&planner_) tflite::GreedyMemoryPlanner();
+  count_ = 0;
+  overflow_ = false;
+}
+
+void ArenaPlan::Record(int size, int first_time_used, int last_time_used,
+                       int offline_offset) {
+  if (count_ == kMaxBuffers) {
+    overflow_ = true;
+    return;
+  }
+  requests_[count_++] = {size, first_time_used, last_time_used, offline_offset};
+}
+
+TfLiteStatus ArenaPlan::AddBuffer(int size, int first_time_used,
+                                  int last_time_used) {
+  Record(size, first_time_used, last_time_used, -1);
+  return planner_.AddBuffer(size, first_time_used, last_time_used);
+}
+
+TfLiteStatus ArenaPlan::AddBuffer(int size, int first_time_used,
+                                  int last_time_used, int offline_offset) {
+  Record(size, first_time_used, last_time_used, offline_offset);
+  return planner_.AddBuffer(size, first_time_used, last_time_used,
+                            offline_offset);
+}
+
+size_t ArenaPlan::GetMaximumMemorySize() {
+  return planner_.GetMaximumMemorySize();
+}
+
+int ArenaPlan::GetBufferCount() {
+  return planner_.GetBufferCount();
+}
+
+TfLiteStatus ArenaPlan::GetOffsetForBuffer(int buffer_index, int* offset) {
+  return planner_.GetOffsetForBuffer(buffer_index, offset);
+}
+
+TfLiteStatus ArenaPlan::Init(unsigned char* scratch_buffer,
+                             int scratch_buffer_size) {
+  // The allocator re-plans from scratch on every Init()
+  count_ = 0;
+  overflow_ = false;
+  return planner_.Init(scratch_buffer, scratch_buffer_size);
+}
+
+bool ArenaPlan::preserves_all_tensors() const {
+  return planner_.preserves_all_tensors();
+}
+
+void ArenaPlan::PrintMemoryPlan() {
+  planner_.PrintMemoryPlan();
+}
+
+void ArenaPlan::PrintCsvHeader() {
+  MicroPrintf("CSV_PLAN_HEADER,model_name,quantization,buffer,subgraph,tensor,offset,bytes,first_op,last_op,offline,tensor_name");
+}
+
+void ArenaPlan::Print(const ModelConfig& config) {
+  if (overflow_) {
+    MicroPrintf("Arena plan: more than %d buffers, not recorded", kMaxBuffers);
+    return;
+  }
+
+  // Live bytes per operator; the planned section minus the peak is space
+  // lost to the placement (gaps no buffer lifetime could fill)
+  int last_op = -1;
+  for (int i = 0; i < count_; i++) {
+    if (requests_[i].last_time_used > last_op) last_op = requests_[i].last_time_used;
+  }
+  size_t peak_live = 0;
+  int peak_op = 0;
+  for (int op = 0; op <= last_op; op++) {
+    size_t live = 0;
+    for (int i = 0; i < count_; i++) {
+      if (requests_[i].first_time_used <= op && op <= requests_[i].last_time_used) {
+        live += requests_[i].size;
+      }
+    }
+    if (live > peak_live) {
+      peak_live = live;
+      peak_op = op;
+    }
+  }
+  const size_t planned = planner_.GetMaximumMemorySize();
+
+  // The allocator requests a buffer for every non-constant, non-variable
+  // tensor of every subgraph in order; anything after those is scratch
+  const tflite::Model* model = tflite::GetModel(config.model_data);
+  const auto* subgraphs = model->subgraphs();
+  const auto* buffers = model->buffers();
+  int buffer = 0;
+  int tensor_buffers = 0;
+  for (uint32_t s = 0; s < subgraphs->size(); s++) {
+    const auto* tensors = subgraphs->Get(s)->tensors();
+    for (uint32_t t = 0; tensors != nullptr && t < tensors->size() && buffer < count_; t++) {
+      const tflite::Tensor* tensor = tensors->Get(t);
+      const tflite::Buffer* data = buffers->Get(tensor->buffer());
+      if (tensor->is_variable() || (data->data() != nullptr && data->data()->size() > 0)) {
+        continue;
+      }
+      const Request& request = requests_[buffer];
+      int offset = -1;
+      planner_.GetOffsetForBuffer(buffer, &offset);
+      MicroPrintf("CSV_PLAN,%s,%s,%d,%lu,%lu,%d,%d,%d,%d,%d,%s",
+                  config.name, config.quantization, buffer, (unsigned long)s,
+                  (unsigned long)t, offset, request.size, request.first_time_used,
+                  request.last_time_used, request.offline_offset >= 0 ? 1 : 0,
+                  tensor->name() != nullptr ? tensor->name()->c_str() : "");
+      buffer++;
+      tensor_buffers++;
+    }
+  }
+  for (; buffer < count_; buffer++) {
+    const Request& request = requests_[buffer];
+    int offset = -1;
+    planner_.GetOffsetForBuffer(buffer, &offset);
+    MicroPrintf("CSV_PLAN,%s,%s,%d,-1,-1,%d,%d,%d,%d,%d,scratch",
+                config.name, config.quantization, buffer, offset, request.size,
+                request.first_time_used, request.last_time_used,
+                request.offline_offset >= 0 ? 1 : 0);
+  }
+
+  MicroPrintf("Arena plan: %d buffers (%d tensors, %d scratch), planned section %zu bytes",
+              count_, tensor_buffers, count_ - tensor_buffers, planned);
+  MicroPrintf("  Peak live %zu bytes at op %d, %zu bytes (%.1f%%) lost to placement gaps",
+              peak_live, peak_op, planned > peak_live ? planned - peak_live : 0,
+              planned > 0 && planned > peak_live
+                  ? 100.0f * (planned - peak_live) / planned : 0.0f);
+}
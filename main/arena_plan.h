@@ -0,0 +1,68 @@
+#ifndef ARENA_PLAN_H_
+#define ARENA_PLAN_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tensorflow/lite/micro/memory_planner/greedy_memory_planner.h"
+#include "tensorflow/lite/micro/memory_planner/micro_memory_planner.h"
+
+#include "model_manager.h"
+
+// Records the tensor arena layout TFLite Micro's memory planner chooses.
+//
+// The interpreter does not expose where it put each tensor (GetTensor()
+// needs preserve_all_tensors, which disables buffer sharing and so changes
+// the plan). ArenaPlan is handed to MicroAllocator::Create() as the memory
+// planner instead: it forwards every call to an embedded
+// GreedyMemoryPlanner, the allocator's default, so the plan is unchanged,
+// and keeps each buffer request (size and first/last operator using it).
+// After AllocateTensors() the requests plus the planner's offsets are the
+// whole non-persistent (head) section of the arena: one buffer per
+// activation tensor in tensor order, then the kernels' scratch buffers.
+// Variable tensors and other persistent allocations are not planned and
+// live in the arena tail.
+class ArenaPlan : public tflite::MicroMemoryPlanner {
+ public:
+  static constexpr int kMaxBuffers = 128;
+
+  ArenaPlan() = default;
+
+  // Forget the previous model's plan; call before MicroAllocator::Create()
+  void Reset();
+
+  TfLiteStatus AddBuffer(int size, int first_time_used,
+                         int last_time_used) override;
+  TfLiteStatus AddBuffer(int size, int first_time_used, int last_time_used,
+                         int offline_offset) override;
+  size_t GetMaximumMemorySize() override;
+  int GetBufferCount() override;
+  TfLiteStatus GetOffsetForBuffer(int buffer_index, int* offset) override;
+  TfLiteStatus Init(unsigned char* scratch_buffer,
+                    int scratch_buffer_size) override;
+  bool preserves_all_tensors() const override;
+  void PrintMemoryPlan() override;
+
+  static void PrintCsvHeader();
+  // Summary plus one CSV_PLAN line per planned buffer, matched to the
+  // model's tensors; scripts/visualize_arena_plan.py charts these
+  void Print(const ModelConfig& config);
+
+ private:
+  struct Request {
+    int size;
+    int first_time_used;
+    int last_time_used;
+    int offline_offset;  // -1 when placed by the planner
+  };
+
+  void Record(int size, int first_time_used, int last_time_used,
+              int offline_offset);
+
+  tflite::GreedyMemoryPlanner planner_;
+  Request requests_[kMaxBuffers];
+  int count_ = 0;
+  bool overflow_ = false;  // More than kMaxBuffers requests
+};
+
+#endif  // ARENA_PLAN_H_
@@ -0,0 +1,141 @@
+/**
+ * @file arena_sizer.cpp
+ * @brief Binary search for the minimum tensor arena per model
+ */
+
+#include "arena_sizer.h"
+
+#include <new>
+
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+#include "bench_timer.h"
+#include "packed_weights.h"
+
+namespace {
+// Probe interpreters are built here rather than on the task stack
+alignas(tflite::MicroInterpreter)
+    uint8_t probe_buffer[sizeof(tflite::MicroInterpreter)];
+// Bound like ModelSession's, so the packed kernels' buffers are counted
+PackedWeights probe_packed_weights;
+
+tflite::MicroInterpreter* CreateProbe(const tflite::Model* model,
+                                      const tflite::MicroOpResolver& resolver, uint8_t* arena,
+                                      size_t arena_size) {
+  tflite::MicroInterpreter* interpreter = new (probe_buffer)
+      tflite::MicroInterpreter(model, resolver, arena, arena_size);
+  if (probe_packed_weights.Bind(model)) {
+    interpreter->SetMicroExternalContext(&probe_packed_weights);
+  }
+  return interpreter;
+}
+
+// Build an interpreter over the first arena_size bytes and try to allocate
+bool TryAllocate(const tflite::Model* model, const tflite::MicroOpResolver& resolver,
+                 uint8_t* arena, size_t arena_size, size_t* used_bytes) {
+  tflite::MicroInterpreter* interpreter = CreateProbe(model, resolver, arena, arena_size);
+  bool ok = (interpreter->AllocateTensors() == kTfLiteOk);
+  if (ok && used_bytes != nullptr) *used_bytes = interpreter->arena_used_bytes();
+  interpreter->~MicroInterpreter();
+  return ok;
+}
+
+size_t RoundUp(size_t bytes) {
+  return (bytes + ArenaSizer::kGranularity - 1) / ArenaSizer::kGranularity *
+         ArenaSizer::kGranularity;
+}
+}  // namespace
+
+ArenaSizeResult ArenaSizer::FindMinimumArenaSize(ModelType type, uint8_t* arena,
+                                                 size_t arena_size) {
+  ArenaSizeResult result = {};
+  const ModelConfig& config = ModelManager::GetModelConfig(type);
+  if (config.unsupported_ops != nullptr) return result;
+  const tflite::MicroOpResolver* resolver = ModelManager::GetOpResolver(type);
+  const tflite::Model* model = tflite::GetModel(config.model_data);
+  if (resolver == nullptr || model->version() != TFLITE_SCHEMA_VERSION) {
+    return result;
+  }
+
+  // The full arena is the known-good upper bound
+  result.probes++;
+  if (!TryAllocate(model, *resolver, arena, arena_size, &result.used_bytes)) {
+    return result;
+  }
+  result.fits = true;
+
+  // Invariant: allocation fails at lo and succeeds at hi
+  size_t lo = 0;
+  size_t hi = arena_size;
+
+  // arena_used_bytes() is usually enough already, so probe it first to
+  // collapse the search to a few steps in the common case
+  size_t guess = RoundUp(result.used_bytes);
+  if (guess < hi) {
+    result.probes++;
+    if (TryAllocate(model, *resolver, arena, guess, nullptr)) {
+      hi = guess;
+    } else {
+      lo = guess;
+    }
+  }
+
+  while (hi - lo > kGranularity) {
+    size_t mid = lo + (hi - lo) / 2 / kGranularity * kGranularity;
+    result.probes++;
+    if (TryAllocate(model, *resolver, arena, mid, nullptr)) {
+      hi = mid;
+    } else {
+      lo = mid;
+    }
+  }
+  result.min_bytes = hi;
+  return result;
+}
+
+AllocationTiming ArenaSizer::TimeAllocation(ModelType type, bool offline,
+                                            uint8_t* arena, size_t arena_size,
+                                            int repeats) {
+  AllocationTiming result = {};
+  const ModelConfig& config = ModelManager::GetModelConfig(type);
+  const unsigned char* data = offline ? config.offline_model_data : config.model_data;
+  if (config.unsupported_ops != nullptr || (offline && config.offline_model_data_len == 0)) {
+    return result;
+  }
+  const tflite::MicroOpResolver* resolver = ModelManager::GetOpResolver(type);
+  const tflite::Model* model = tflite::GetModel(data);
+  if (resolver == nullptr || model->version() != TFLITE_SCHEMA_VERSION) {
+    return result;
+  }
+
+  double total_us = 0.0;
+  for (int i = 0; i < repeats; i++) {
+    tflite::MicroInterpreter* interpreter = CreateProbe(model, *resolver, arena, arena_size);
+    BenchTimer::Ticks start = BenchTimer::Now();
+    TfLiteStatus status = interpreter->AllocateTensors();
+    BenchTimer::Ticks end = BenchTimer::Now();
+    if (status == kTfLiteOk) result.used_bytes = interpreter->arena_used_bytes();
+    interpreter->~MicroInterpreter();
+    if (status != kTfLiteOk) return result;
+
+    const double us = BenchTimer::ToMicros(BenchTimer::Elapsed(start, end));
+    total_us += us;
+    if (i == 0 || us < result.min_us) result.min_us = us;
+  }
+  result.ok = repeats > 0;
+  result.avg_us = repeats > 0 ? total_us / repeats : 0.0;
+  return result;
+}
+
+void ArenaSizer::PrintCsvHeader() {
+  MicroPrintf("CSV_ARENA_HEADER,model_name,quantization,fits,arena_used_bytes,min_arena_bytes,configured_bytes,probes");
+}
+
+void ArenaSizer::PrintCsv(const ModelConfig& config, const ArenaSizeResult& result,
+                          size_t arena_size) {
+  MicroPrintf("CSV_ARENA,%s,%s,%d,%zu,%zu,%zu,%d",
+              config.name, config.quantization, result.fits ? 1 : 0,
+              result.used_bytes, result.min_bytes, arena_size, result.probes);
+}
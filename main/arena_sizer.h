@@ -0,0 +1,52 @@
+#ifndef ARENA_SIZER_H_
+#define ARENA_SIZER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "model_manager.h"
+
+struct ArenaSizeResult {
+  bool fits;          // AllocateTensors() succeeded with the full arena
+  size_t used_bytes;  // arena_used_bytes() after allocating in the full arena
+  size_t min_bytes;   // Smallest arena size for which allocation succeeds
+  int probes;         // AllocateTensors() attempts made by the search
+};
+
+struct AllocationTiming {
+  bool ok;            // Every AllocateTensors() attempt succeeded
+  size_t used_bytes;  // arena_used_bytes() after allocating
+  double avg_us;      // Mean AllocateTensors() time
+  double min_us;      // Fastest AllocateTensors() time
+};
+
+// Finds the smallest tensor arena each model can be allocated in.
+//
+// arena_used_bytes() reports what the planner ended up using but not what
+// AllocateTensors() needs along the way (alignment padding, temporaries
+// released before it returns), so the only reliable answer is to try.
+// The search builds a throwaway interpreter per probe and binary-searches
+// the arena size in kGranularity steps. Failed probes print TFLite Micro's
+// own "Failed to allocate" errors; that is expected in this mode.
+class ArenaSizer {
+ public:
+  // TFLite Micro aligns arena allocations to 16 bytes
+  static constexpr size_t kGranularity = 16;
+
+  static ArenaSizeResult FindMinimumArenaSize(ModelType type, uint8_t* arena,
+                                              size_t arena_size);
+
+  // Time AllocateTensors() over repeats throwaway interpreters, on the
+  // registry model or its offline-planned twin (offline_model_data)
+  static AllocationTiming TimeAllocation(ModelType type, bool offline,
+                                         uint8_t* arena, size_t arena_size,
+                                         int repeats);
+
+  static void PrintCsvHeader();
+  // One CSV_ARENA line; scripts/generate_arena_sizes.py turns these into a
+  // header of per-model arena constants
+  static void PrintCsv(const ModelConfig& config, const ArenaSizeResult& result,
+                       size_t arena_size);
+};
+
+#endif  // ARENA_SIZER_H_
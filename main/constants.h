@@ -1,17 +1,8 @@
 #ifndef CONSTANTS_H_
 #define CONSTANTS_H_
 
-// Model selection defines
-#define MODEL_SINE_FLOAT32 1
-#define MODEL_SINE_INT8 2
-#define MODEL_CNN_FLOAT32 3
-#define MODEL_CNN_INT8 4
-#define MODEL_RNN_FLOAT32 5
-#define MODEL_RNN_INT8 6
-
-// Select which model to benchmark
-// Change this to test different models
-#define CURRENT_MODEL MODEL_SINE_FLOAT32
+// All models linked into the image are benchmarked in one boot;
+// see kModelRegistry in model_manager.cpp for the sweep order.
 
 // Memory allocation for models
 // Adjust based on model size requirements
@@ -19,8 +10,123 @@ constexpr int kTensorArenaSize = 20 * 1024;  // 20KB arena (increased for CNN/RN
 
 // Benchmarking constants
 constexpr int kWarmupInferences = 10;      // Warmup runs before measurement
-constexpr int kInferencesPerTest = 100;    // Number of inferences per benchmark
-constexpr int kDelayBetweenTests = 100;    // ms between inferences
+constexpr int kInferencesPerTest = 100;    // Measured inferences per model in a sweep
+constexpr int kDelayBetweenTests = 100;    // ms between inferences (LATENCY mode)
+
+// How each model in the sweep is driven
+enum class BenchmarkMode {
+  LATENCY,     // One Invoke() per loop(), kDelayBetweenTests apart
+  THROUGHPUT,  // Back-to-back Invoke() with no delay and no logging in the loop
+  FIXED_RATE,  // Open loop: jobs released every 1/rate s regardless of completion
+  PIPELINE,    // Producer task on another core prepares double-buffered inputs
+  CONCURRENT,  // Model pairs (kConcurrentPairs) run side by side on both cores
+  KERNEL_AB,   // Every model once per kernel backend, per-op speedups and output deltas
+  AOT,         // Interpreter vs ahead-of-time compiled code (aot_models.h), same inputs
+};
+constexpr BenchmarkMode kBenchmarkMode = BenchmarkMode::LATENCY;
+
+// THROUGHPUT mode: run each model for this long; 0 runs kInferencesPerTest
+// inferences instead
+constexpr int kThroughputDurationMs = 0;
+
+// FIXED_RATE mode: release rates tried per model (kInferencesPerTest jobs
+// each) and how many released-but-unstarted jobs may queue, like a sensor
+// FIFO, before further samples are dropped
+constexpr int kFixedRatesHz[] = {100, 1000};
+constexpr int kFixedRateMaxBacklog = 4;
+
+// PIPELINE mode: core the input producer task is pinned to (the Invoke()
+// loop stays on the main task's core), synthetic per-sample preprocessing
+// cost on the producer, and the size of each of the two input buffers
+constexpr int kPipelineProducerCore = 1;
+constexpr int kPipelinePreprocessUs = 0;
+constexpr int kPipelineMaxInputBytes = 2048;  // cnn_b8 float32 input
+
+// Kernel implementation per switchable op (kernels/kernel_backends.h).
+// TFLM is whatever the TFLite Micro build links: ESP-NN on ESP-IDF (SIMD
+// or its portable C fallback, per CONFIG_NN_OPTIMIZED / CONFIG_NN_ANSI_C),
+// the reference kernels on the host. REFERENCE forces TFLite Micro's
+// portable reference kernels in any build; CUSTOM selects project-local
+// kernels. An op without a kernel in the chosen backend keeps TFLM.
+enum class KernelBackend {
+  TFLM,
+  REFERENCE,
+  CUSTOM,
+};
+constexpr KernelBackend kConv2DKernel = KernelBackend::TFLM;
+constexpr KernelBackend kFullyConnectedKernel = KernelBackend::TFLM;
+constexpr KernelBackend kMaxPool2DKernel = KernelBackend::TFLM;
+constexpr KernelBackend kLstmKernel = KernelBackend::TFLM;
+
+// KERNEL_AB mode: outputs of the first kKernelCheckSamples inputs (same
+// seed for every backend) are compared against the TFLM backend
+constexpr int kKernelCheckSamples = 8;
+constexpr int kKernelCheckMaxOutputs = 32;  // cnn_b8: 8 samples x 4 classes
+constexpr unsigned int kKernelInputSeed = 1;
+
+// AOT mode: the generated code reads the interpreter's input tensor and
+// writes a buffer of this size; outputs are compared on every measured
+// inference. The generated code always calls the reference kernels while
+// the interpreter runs the selection above, so select REFERENCE to measure
+// the interpreter's own overhead rather than ESP-NN against reference.
+constexpr int kAotMaxOutputBytes = 128;  // cnn_b8: 8 samples x 4 float32
+
+// Machine-readable output: CSV_* text lines, or CRC-checked binary frames
+// for CSV_TIMER/CSV_DATA/CSV_SUMMARY (CSV_DATA reports batched, about a
+// tenth of the bytes, and no float formatting on target). Decode binary
+// captures with scripts/decode_telemetry.py.
+enum class LogFormat {
+  CSV,
+  BINARY,
+};
+constexpr LogFormat kLogFormat = LogFormat::CSV;
+
+// LATENCY mode: queue the periodic progress reports (CSV_DATA etc.) in a
+// lock-free ring drained by a low-priority task on kResultLoggerCore, so
+// serial output never runs between timed inferences. Records that do not
+// fit in the ring are dropped and counted, never waited for. Ignored
+// (reports print synchronously) while kCheckInvokeAllocations is set.
+constexpr bool kDeferredLogging = true;
+constexpr int kResultRingCapacity = 16;  // Power of two
+constexpr int kResultLoggerCore = 1;
+
+// Attach OpProfiler to the interpreter and emit a per-op CSV_OP section
+// per model. Adds a timer read per op, so whole-graph latency is slightly
+// inflated while enabled.
+constexpr bool kEnableOpProfiling = false;
+
+// Watch the heap around every timed Invoke() (malloc hooks on the host,
+// heap tracing on ESP-IDF) and fail the model, with a CSV_ALLOC line
+// naming the first call site, if anything allocated; a build without heap
+// tracing fails as unsupported. Adds a watch start/stop outside the timer
+// reads. Heap tracing is opt-in, since it costs every allocation in the
+// image; on ESP-IDF also set, in sdkconfig (idf.py menuconfig):
+//   CONFIG_HEAP_TRACING_STANDALONE=y
+//   CONFIG_HEAP_TRACING_STACK_DEPTH=2
+constexpr bool kCheckInvokeAllocations = false;
+
+// Before the sweep, binary-search the smallest kTensorArenaSize prefix each
+// model allocates in and emit one CSV_ARENA line per model. Feed the log to
+// scripts/generate_arena_sizes.py for per-model arena constants.
+constexpr bool kEnableArenaSizing = false;
+
+// Record the memory planner's layout of each model's arena (offset, size
+// and first/last operator of every activation and scratch buffer) and emit
+// CSV_PLAN lines after AllocateTensors(). Chart a log with
+// scripts/visualize_arena_plan.py.
+constexpr bool kDumpArenaPlan = false;
+
+// Run the sweep on the offline-planned copies of the models generated by
+// scripts/convert_model.py (tensor offsets embedded as
+// OfflineMemoryAllocation metadata, so AllocateTensors() skips the greedy
+// placement). Models that could not be planned keep the original.
+constexpr bool kUseOfflinePlan = false;
+
+// Before the sweep, allocate every model kOfflinePlanRepeats times with the
+// online and the offline plan and emit CSV_OFFLINE_PLAN lines comparing
+// AllocateTensors() time.
+constexpr bool kCompareOfflinePlan = false;
+constexpr int kOfflinePlanRepeats = 20;
 
 // Model-specific input sizes
 constexpr int kSineInputSize = 1;
@@ -0,0 +1,13 @@
+#include "main_functions.h"
+
+// Host entry point: run the sweep once and exit so the binary can be used
+// from scripts and CI; the exit status is 1 if a check failed.
+int main(int argc, char** argv) {
+  (void)argc;
+  (void)argv;
+  setup();
+  while (!benchmark_complete()) {
+    loop();
+  }
+  return benchmark_passed() ? 0 : 1;
+}
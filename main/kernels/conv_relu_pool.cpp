@@ -0,0 +1,278 @@
+/**
+ * @file conv_relu_pool.cpp
+ * @brief Fused CONV_2D + activation + MAX_POOL_2D custom kernel
+ */
+
+#include "conv_relu_pool.h"
+
+#include <float.h>
+#include <string.h>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/kernels/padding.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_context.h"
+#include "tensorflow/lite/micro/micro_log.h"
+
+namespace {
+
+constexpr int kInputTensor = 0;
+constexpr int kFilterTensor = 1;
+constexpr int kBiasTensor = 2;
+constexpr int kOutputTensor = 0;
+
+struct OpData {
+  ConvReluPoolOptions options;
+  // NHWC / OHWI dimensions, fixed at Prepare()
+  int batches;
+  int input_height, input_width, input_depth;
+  int filter_height, filter_width;
+  int output_height, output_width, output_depth;
+  int padding_height, padding_width;
+
+  // int8: per-channel requantization to the (shared conv/pool) output
+  int32_t input_offset;
+  int32_t output_offset;
+  int32_t* output_multiplier;
+  int* output_shift;
+  int32_t activation_min;
+  int32_t activation_max;
+
+  float activation_min_f32;
+  float activation_max_f32;
+};
+
+// Conv accumulator at conv output (y, x), channel oc, bias not included
+template <typename T, typename Acc>
+inline Acc ConvAt(const OpData& data, const T* input, const T* filter, int batch, int y, int x,
+                  int oc, Acc input_offset) {
+  const ConvReluPoolOptions& o = data.options;
+  const int in_y0 = y * o.stride_height - data.padding_height;
+  const int in_x0 = x * o.stride_width - data.padding_width;
+  Acc acc = 0;
+  for (int ky = 0; ky < data.filter_height; ky++) {
+    const int in_y = in_y0 + ky * o.dilation_height;
+    if (in_y < 0 || in_y >= data.input_height) continue;
+    for (int kx = 0; kx < data.filter_width; kx++) {
+      const int in_x = in_x0 + kx * o.dilation_width;
+      if (in_x < 0 || in_x >= data.input_width) continue;
+      const T* in = input + ((batch * data.input_height + in_y) * data.input_width + in_x) *
+                                data.input_depth;
+      const T* w = filter + ((oc * data.filter_height + ky) * data.filter_width + kx) *
+                                data.input_depth;
+      for (int ic = 0; ic < data.input_depth; ic++) {
+        acc += (static_cast<Acc>(in[ic]) + input_offset) * static_cast<Acc>(w[ic]);
+      }
+    }
+  }
+  return acc;
+}
+
+// Max conv accumulator (with bias) over the pool window at output (py, px)
+template <typename T, typename Acc, typename Bias>
+inline Acc PooledConv(const OpData& data, const T* input, const T* filter, const Bias* bias,
+                      int batch, int py, int px, int oc, Acc input_offset, Acc lowest) {
+  const ConvReluPoolOptions& o = data.options;
+  const Acc bias_value = bias != nullptr ? static_cast<Acc>(bias[oc]) : 0;
+  Acc best = lowest;
+  for (int wy = 0; wy < o.pool_filter_height; wy++) {
+    const int y = py * o.pool_stride_height + wy;
+    for (int wx = 0; wx < o.pool_filter_width; wx++) {
+      const int x = px * o.pool_stride_width + wx;
+      const Acc acc = ConvAt<T, Acc>(data, input, filter, batch, y, x, oc, input_offset) +
+                      bias_value;
+      if (acc > best) best = acc;
+    }
+  }
+  return best;
+}
+
+void EvalFloat(const OpData& data, const float* input, const float* filter, const float* bias,
+               float* output) {
+  float* out = output;
+  for (int b = 0; b < data.batches; b++) {
+    for (int py = 0; py < data.output_height; py++) {
+      for (int px = 0; px < data.output_width; px++) {
+        for (int oc = 0; oc < data.output_depth; oc++) {
+          const float best = PooledConv<float, float, float>(data, input, filter, bias, b, py,
+                                                             px, oc, 0.0f, -FLT_MAX);
+          *out++ = tflite::ActivationFunctionWithMinMax(best, data.activation_min_f32,
+                                                        data.activation_max_f32);
+        }
+      }
+    }
+  }
+}
+
+void EvalInt8(const OpData& data, const int8_t* input, const int8_t* filter,
+              const int32_t* bias, int8_t* output) {
+  int8_t* out = output;
+  for (int b = 0; b < data.batches; b++) {
+    for (int py = 0; py < data.output_height; py++) {
+      for (int px = 0; px < data.output_width; px++) {
+        for (int oc = 0; oc < data.output_depth; oc++) {
+          const int32_t best = PooledConv<int8_t, int32_t, int32_t>(
+              data, input, filter, bias, b, py, px, oc, data.input_offset, INT32_MIN);
+          int32_t value = tflite::MultiplyByQuantizedMultiplier(
+                              best, data.output_multiplier[oc], data.output_shift[oc]) +
+                          data.output_offset;
+          value = value < data.activation_min ? data.activation_min : value;
+          value = value > data.activation_max ? data.activation_max : value;
+          *out++ = static_cast<int8_t>(value);
+        }
+      }
+    }
+  }
+}
+
+void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  auto* data = static_cast<OpData*>(context->AllocatePersistentBuffer(context, sizeof(OpData)));
+  if (data == nullptr) return nullptr;
+  memset(data, 0, sizeof(OpData));
+  if (buffer == nullptr || length != sizeof(ConvReluPoolOptions)) {
+    // Left zeroed; Prepare() rejects a zero stride
+    MicroPrintf("CONV_RELU_POOL: %u option bytes, expected %u", static_cast<unsigned>(length),
+                static_cast<unsigned>(sizeof(ConvReluPoolOptions)));
+    return data;
+  }
+  memcpy(&data->options, buffer, sizeof(ConvReluPoolOptions));
+  return data;
+}
+
+TfLiteStatus PrepareQuantized(TfLiteContext* context, OpData* data, const TfLiteTensor* input,
+                              const TfLiteTensor* filter, TfLiteTensor* output) {
+  TF_LITE_ENSURE_TYPES_EQ(context, filter->type, kTfLiteInt8);
+  TF_LITE_ENSURE_EQ(context, filter->quantization.type, kTfLiteAffineQuantization);
+  const auto* filter_quantization =
+      static_cast<const TfLiteAffineQuantization*>(filter->quantization.params);
+  const int scales = filter_quantization->scale->size;
+  TF_LITE_ENSURE(context, scales == 1 || scales == data->output_depth);
+
+  data->output_multiplier = static_cast<int32_t*>(
+      context->AllocatePersistentBuffer(context, data->output_depth * sizeof(int32_t)));
+  data->output_shift = static_cast<int*>(
+      context->AllocatePersistentBuffer(context, data->output_depth * sizeof(int)));
+  TF_LITE_ENSURE(context, data->output_multiplier != nullptr && data->output_shift != nullptr);
+
+  for (int oc = 0; oc < data->output_depth; oc++) {
+    const float filter_scale = filter_quantization->scale->data[scales == 1 ? 0 : oc];
+    const double effective_scale = static_cast<double>(input->params.scale) * filter_scale /
+                                   output->params.scale;
+    tflite::QuantizeMultiplier(effective_scale, &data->output_multiplier[oc],
+                               &data->output_shift[oc]);
+  }
+  data->input_offset = -input->params.zero_point;
+  data->output_offset = output->params.zero_point;
+  return tflite::CalculateActivationRangeQuantized(
+      context, static_cast<TfLiteFusedActivation>(data->options.activation), output,
+      &data->activation_min, &data->activation_max);
+}
+
+TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  TF_LITE_ENSURE(context, node->user_data != nullptr);
+  auto* data = static_cast<OpData*>(node->user_data);
+  const ConvReluPoolOptions& o = data->options;
+  TF_LITE_ENSURE(context, o.stride_width > 0 && o.stride_height > 0);
+  TF_LITE_ENSURE(context, o.dilation_width > 0 && o.dilation_height > 0);
+  TF_LITE_ENSURE(context, o.pool_stride_width > 0 && o.pool_stride_height > 0);
+  TF_LITE_ENSURE(context, o.pool_filter_width > 0 && o.pool_filter_height > 0);
+  TF_LITE_ENSURE(context, o.activation == kTfLiteActNone || o.activation == kTfLiteActRelu ||
+                              o.activation == kTfLiteActRelu6);
+  TF_LITE_ENSURE(context, tflite::NumInputs(node) == 2 || tflite::NumInputs(node) == 3);
+  TF_LITE_ENSURE_EQ(context, tflite::NumOutputs(node), 1);
+
+  tflite::MicroContext* micro_context = tflite::GetMicroContext(context);
+  TfLiteTensor* input = micro_context->AllocateTempInputTensor(node, kInputTensor);
+  TF_LITE_ENSURE(context, input != nullptr);
+  TfLiteTensor* filter = micro_context->AllocateTempInputTensor(node, kFilterTensor);
+  TF_LITE_ENSURE(context, filter != nullptr);
+  TfLiteTensor* output = micro_context->AllocateTempOutputTensor(node, kOutputTensor);
+  TF_LITE_ENSURE(context, output != nullptr);
+  TF_LITE_ENSURE_TYPES_EQ(context, input->type, output->type);
+  TF_LITE_ENSURE_EQ(context, tflite::NumDimensions(input), 4);
+  TF_LITE_ENSURE_EQ(context, tflite::NumDimensions(filter), 4);
+  TF_LITE_ENSURE_EQ(context, tflite::NumDimensions(output), 4);
+
+  data->batches = tflite::SizeOfDimension(input, 0);
+  data->input_height = tflite::SizeOfDimension(input, 1);
+  data->input_width = tflite::SizeOfDimension(input, 2);
+  data->input_depth = tflite::SizeOfDimension(input, 3);
+  data->filter_height = tflite::SizeOfDimension(filter, 1);
+  data->filter_width = tflite::SizeOfDimension(filter, 2);
+  data->output_depth = tflite::SizeOfDimension(filter, 0);
+  TF_LITE_ENSURE_EQ(context, tflite::SizeOfDimension(filter, 3), data->input_depth);
+
+  // Conv output size and padding as CONV_2D computes them, then the VALID
+  // pool over it
+  int conv_height = 0;
+  int conv_width = 0;
+  const TfLitePaddingValues padding = tflite::ComputePaddingHeightWidth(
+      o.stride_height, o.stride_width, o.dilation_height, o.dilation_width,
+      data->input_height, data->input_width, data->filter_height, data->filter_width,
+      o.padding == 0 ? kTfLitePaddingSame : kTfLitePaddingValid, &conv_height, &conv_width);
+  data->padding_height = padding.height;
+  data->padding_width = padding.width;
+  TF_LITE_ENSURE(context, conv_height >= o.pool_filter_height &&
+                              conv_width >= o.pool_filter_width);
+  data->output_height = (conv_height - o.pool_filter_height) / o.pool_stride_height + 1;
+  data->output_width = (conv_width - o.pool_filter_width) / o.pool_stride_width + 1;
+  TF_LITE_ENSURE_EQ(context, tflite::SizeOfDimension(output, 0), data->batches);
+  TF_LITE_ENSURE_EQ(context, tflite::SizeOfDimension(output, 1), data->output_height);
+  TF_LITE_ENSURE_EQ(context, tflite::SizeOfDimension(output, 2), data->output_width);
+  TF_LITE_ENSURE_EQ(context, tflite::SizeOfDimension(output, 3), data->output_depth);
+
+  TfLiteStatus status = kTfLiteOk;
+  if (input->type == kTfLiteFloat32) {
+    TF_LITE_ENSURE_TYPES_EQ(context, filter->type, kTfLiteFloat32);
+    tflite::CalculateActivationRange(static_cast<TfLiteFusedActivation>(o.activation),
+                                     &data->activation_min_f32, &data->activation_max_f32);
+  } else if (input->type == kTfLiteInt8) {
+    status = PrepareQuantized(context, data, input, filter, output);
+  } else {
+    MicroPrintf("CONV_RELU_POOL: type %s not supported", TfLiteTypeGetName(input->type));
+    status = kTfLiteError;
+  }
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(filter);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  return status;
+}
+
+TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
+  const auto& data = *static_cast<const OpData*>(node->user_data);
+  const TfLiteEvalTensor* input = tflite::micro::GetEvalInput(context, node, kInputTensor);
+  const TfLiteEvalTensor* filter = tflite::micro::GetEvalInput(context, node, kFilterTensor);
+  const TfLiteEvalTensor* bias =
+      tflite::NumInputs(node) == 3
+          ? tflite::micro::GetEvalInput(context, node, kBiasTensor)
+          : nullptr;
+  TfLiteEvalTensor* output = tflite::micro::GetEvalOutput(context, node, kOutputTensor);
+
+  if (input->type == kTfLiteFloat32) {
+    EvalFloat(data, tflite::micro::GetTensorData<float>(input),
+              tflite::micro::GetTensorData<float>(filter),
+              tflite::micro::GetOptionalTensorData<float>(bias),
+              tflite::micro::GetTensorData<float>(output));
+    return kTfLiteOk;
+  }
+  if (input->type == kTfLiteInt8) {
+    EvalInt8(data, tflite::micro::GetTensorData<int8_t>(input),
+             tflite::micro::GetTensorData<int8_t>(filter),
+             tflite::micro::GetOptionalTensorData<int32_t>(bias),
+             tflite::micro::GetTensorData<int8_t>(output));
+    return kTfLiteOk;
+  }
+  MicroPrintf("CONV_RELU_POOL: type %s not supported", TfLiteTypeGetName(input->type));
+  return kTfLiteError;
+}
+
+}  // namespace
+
+TFLMRegistration* RegisterConvReluPool() {
+  static TFLMRegistration registration = tflite::micro::RegisterOp(Init, Prepare, Eval);
+  return &registration;
+}
@@ -0,0 +1,32 @@
+#ifndef CONV_RELU_POOL_H_
+#define CONV_RELU_POOL_H_
+
+#include <stdint.h>
+
+#include "tensorflow/lite/micro/micro_common.h"
+
+// custom_options of a CONV_RELU_POOL operator, little-endian int32s as
+// scripts/fuse_conv_pool.py writes them. Enum values are the flatbuffer
+// schema's (Padding: 0 SAME, 1 VALID; ActivationFunctionType).
+struct ConvReluPoolOptions {
+  int32_t padding;
+  int32_t stride_width;
+  int32_t stride_height;
+  int32_t dilation_width;
+  int32_t dilation_height;
+  int32_t activation;  // NONE, RELU or RELU6
+  int32_t pool_filter_width;
+  int32_t pool_filter_height;
+  int32_t pool_stride_width;
+  int32_t pool_stride_height;
+};
+
+// CONV_2D followed by a VALID MAX_POOL_2D in one kernel, float32 and int8
+// (per-channel weights). Inputs are the conv's [input, filter, bias],
+// output is the pool's; the conv output never exists in the arena. Each
+// pool window takes the max of the raw conv accumulators and requantizes
+// and clamps once, which matches the unfused pair because requantization
+// and the activation are both monotonic.
+TFLMRegistration* RegisterConvReluPool();
+
+#endif  // CONV_RELU_POOL_H_
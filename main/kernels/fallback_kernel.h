@@ -0,0 +1,50 @@
+#ifndef FALLBACK_KERNEL_H_
+#define FALLBACK_KERNEL_H_
+
+#include <stddef.h>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/micro_common.h"
+
+// Helpers for kernels that hand the nodes they do not specialize to
+// TFLite Micro's own kernel. The wrapper's OpData keeps the stock kernel's
+// user_data in a `void* fallback_data` member, and every stock callback
+// runs with that pointer, never the wrapper's OpData.
+
+// Zeroed OpData with the stock kernel's init() already run
+template <typename OpData>
+OpData* InitWithFallback(TfLiteContext* context, const char* buffer, size_t length,
+                         const TFLMRegistration& fallback) {
+  auto* data = static_cast<OpData*>(context->AllocatePersistentBuffer(context, sizeof(OpData)));
+  if (data == nullptr) return nullptr;
+  *data = {};
+  if (fallback.init != nullptr) {
+    data->fallback_data = fallback.init(context, buffer, length);
+  }
+  return data;
+}
+
+// Runs a stock kernel callback with its own user_data in the node
+template <typename OpData, typename Callback>
+TfLiteStatus WithFallbackData(TfLiteNode* node, Callback callback) {
+  OpData* data = static_cast<OpData*>(node->user_data);
+  node->user_data = data->fallback_data;
+  const TfLiteStatus status = callback();
+  node->user_data = data;
+  return status;
+}
+
+// free and reset get the wrapper's OpData as buffer
+template <typename OpData>
+void FreeFallback(TfLiteContext* context, void* buffer, const TFLMRegistration& fallback) {
+  auto* data = static_cast<OpData*>(buffer);
+  if (data != nullptr && fallback.free != nullptr) fallback.free(context, data->fallback_data);
+}
+
+template <typename OpData>
+void ResetFallback(TfLiteContext* context, void* buffer, const TFLMRegistration& fallback) {
+  auto* data = static_cast<OpData*>(buffer);
+  if (data != nullptr && fallback.reset != nullptr) fallback.reset(context, data->fallback_data);
+}
+
+#endif  // FALLBACK_KERNEL_H_
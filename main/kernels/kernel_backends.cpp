@@ -0,0 +1,154 @@
+/**
+ * @file kernel_backends.cpp
+ * @brief Per-op kernel registrations by backend and the runtime selection
+ */
+
+#include "kernel_backends.h"
+
+#include <string.h>
+
+#include "tensorflow/lite/micro/kernels/conv.h"
+#include "tensorflow/lite/micro/kernels/fully_connected.h"
+#include "tensorflow/lite/micro/kernels/micro_ops.h"
+#include "tensorflow/lite/micro/kernels/pooling.h"
+#include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/schema/schema_utils.h"
+
+#include "lstm_specialized.h"
+#include "packed_kernels.h"
+#include "reference_kernels.h"
+
+#if defined(ESP_PLATFORM)
+#include "sdkconfig.h"
+#endif
+
+namespace {
+using RegisterFunction = TFLMRegistration (*)();
+
+struct KernelEntry {
+  const char* name;
+  tflite::BuiltinOperator builtin;
+  // Indexed by KernelBackend; null when the backend has no kernel
+  RegisterFunction kernels[kKernelBackendCount];
+};
+
+// Indexed by KernelOp. The library's LSTM is the reference implementation
+// in every build (ESP-NN does not provide one), so it has no separate
+// REFERENCE entry; its CUSTOM kernel is shape-specialized for our RNNs.
+// CONV_2D and FULLY_CONNECTED CUSTOM kernels run int8 models over weights
+// pre-packed at conversion time.
+const KernelEntry kKernels[kKernelOpCount] = {
+  {"CONV_2D", tflite::BuiltinOperator_CONV_2D,
+   {tflite::Register_CONV_2D, RegisterReferenceConv2D, RegisterPackedConv2D}},
+  {"FULLY_CONNECTED", tflite::BuiltinOperator_FULLY_CONNECTED,
+   {tflite::Register_FULLY_CONNECTED, RegisterReferenceFullyConnected,
+    RegisterPackedFullyConnected}},
+  {"MAX_POOL_2D", tflite::BuiltinOperator_MAX_POOL_2D,
+   {tflite::Register_MAX_POOL_2D, RegisterReferenceMaxPool2D, nullptr}},
+  {"UNIDIRECTIONAL_SEQUENCE_LSTM", tflite::BuiltinOperator_UNIDIRECTIONAL_SEQUENCE_LSTM,
+   {tflite::Register_UNIDIRECTIONAL_SEQUENCE_LSTM, nullptr, RegisterSpecializedLstm}},
+};
+
+const char* const kBackendNames[kKernelBackendCount] = {"tflm", "reference", "custom"};
+
+KernelBackend selection[kKernelOpCount] = {
+  kConv2DKernel, kFullyConnectedKernel, kMaxPool2DKernel, kLstmKernel,
+};
+// Starts at 1 so a resolver's initial 0 always rebuilds
+uint32_t selection_generation = 1;
+}  // namespace
+
+void KernelBackends::Select(KernelOp op, KernelBackend backend) {
+  if (selection[static_cast<int>(op)] == backend) return;
+  selection[static_cast<int>(op)] = backend;
+  selection_generation++;
+}
+
+void KernelBackends::SelectAll(KernelBackend backend) {
+  for (int i = 0; i < kKernelOpCount; i++) {
+    Select(static_cast<KernelOp>(i), backend);
+  }
+}
+
+void KernelBackends::SelectDefaults() {
+  Select(KernelOp::CONV_2D, kConv2DKernel);
+  Select(KernelOp::FULLY_CONNECTED, kFullyConnectedKernel);
+  Select(KernelOp::MAX_POOL_2D, kMaxPool2DKernel);
+  Select(KernelOp::UNIDIRECTIONAL_SEQUENCE_LSTM, kLstmKernel);
+}
+
+KernelBackend KernelBackends::selected(KernelOp op) {
+  return selection[static_cast<int>(op)];
+}
+
+bool KernelBackends::Available(KernelOp op, KernelBackend backend) {
+  return kKernels[static_cast<int>(op)].kernels[static_cast<int>(backend)] != nullptr;
+}
+
+KernelBackend KernelBackends::Effective(KernelOp op) {
+  const KernelBackend backend = selected(op);
+  return Available(op, backend) ? backend : KernelBackend::TFLM;
+}
+
+TFLMRegistration KernelBackends::Registration(KernelOp op) {
+  return kKernels[static_cast<int>(op)].kernels[static_cast<int>(Effective(op))]();
+}
+
+uint32_t KernelBackends::generation() {
+  return selection_generation;
+}
+
+const char* KernelBackends::Name(KernelBackend backend) {
+  return kBackendNames[static_cast<int>(backend)];
+}
+
+const char* KernelBackends::LibraryName() {
+#if defined(ESP_PLATFORM) && defined(CONFIG_NN_OPTIMIZED)
+  return "esp-nn";
+#elif defined(ESP_PLATFORM) && defined(CONFIG_NN_ANSI_C)
+  return "esp-nn-ansi";
+#else
+  return "reference";
+#endif
+}
+
+const char* KernelBackends::OpName(KernelOp op) {
+  return kKernels[static_cast<int>(op)].name;
+}
+
+bool KernelBackends::FindOp(const char* op_name, KernelOp* op) {
+  for (int i = 0; op_name != nullptr && i < kKernelOpCount; i++) {
+    if (strcmp(op_name, kKernels[i].name) == 0) {
+      *op = static_cast<KernelOp>(i);
+      return true;
+    }
+  }
+  return false;
+}
+
+int KernelBackends::CountKernels(const tflite::Model* model, KernelBackend backend) {
+  const auto* operator_codes = model->operator_codes();
+  int count = 0;
+  for (uint32_t i = 0; operator_codes != nullptr && i < operator_codes->size(); i++) {
+    const tflite::BuiltinOperator builtin = tflite::GetBuiltinCode(operator_codes->Get(i));
+    for (int op = 0; op < kKernelOpCount; op++) {
+      if (kKernels[op].builtin == builtin &&
+          Available(static_cast<KernelOp>(op), backend)) {
+        count++;
+      }
+    }
+  }
+  return count;
+}
+
+void KernelBackends::PrintSelection() {
+  MicroPrintf("Kernels (tflm = %s):", LibraryName());
+  for (int i = 0; i < kKernelOpCount; i++) {
+    const KernelOp op = static_cast<KernelOp>(i);
+    if (Effective(op) == selected(op)) {
+      MicroPrintf("  %s: %s", OpName(op), Name(selected(op)));
+    } else {
+      MicroPrintf("  %s: %s (no kernel, using tflm)", OpName(op), Name(selected(op)));
+    }
+  }
+}
@@ -0,0 +1,58 @@
+#ifndef KERNEL_BACKENDS_H_
+#define KERNEL_BACKENDS_H_
+
+#include <stdint.h>
+
+#include "tensorflow/lite/micro/micro_common.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+#include "constants.h"
+
+// Ops whose kernel can be switched between backends
+enum class KernelOp {
+  CONV_2D,
+  FULLY_CONNECTED,
+  MAX_POOL_2D,
+  UNIDIRECTIONAL_SEQUENCE_LSTM,
+};
+constexpr int kKernelOpCount = 4;
+constexpr int kKernelBackendCount = 3;
+
+// Per-op kernel backend selection.
+//
+// The generated op resolvers (model_op_resolvers.h) register every
+// switchable op with Registration(op) instead of TFLite Micro's default,
+// and rebuild themselves when generation() has moved since they were last
+// filled. The interpreter copies kernel pointers out of the resolver in
+// AllocateTensors(), so a new selection takes effect for the next
+// ModelSession::Begin(); never change it while an interpreter is alive.
+// Initial selection comes from kConv2DKernel etc. in constants.h.
+class KernelBackends {
+ public:
+  static void Select(KernelOp op, KernelBackend backend);
+  // Same backend for every op (ops it has no kernel for keep TFLM)
+  static void SelectAll(KernelBackend backend);
+  // Back to the constants.h selection
+  static void SelectDefaults();
+
+  static KernelBackend selected(KernelOp op);
+  // Backend the op actually runs: the selected one, or TFLM when the
+  // selected backend has no kernel for it
+  static KernelBackend Effective(KernelOp op);
+  static bool Available(KernelOp op, KernelBackend backend);
+  static TFLMRegistration Registration(KernelOp op);
+  static uint32_t generation();
+
+  static const char* Name(KernelBackend backend);
+  // What TFLM stands for in this build (esp-nn, esp-nn-ansi, reference)
+  static const char* LibraryName();
+  // Builtin op name, as OpProfiler tags nodes
+  static const char* OpName(KernelOp op);
+  static bool FindOp(const char* op_name, KernelOp* op);
+  // Number of the model's operator codes with a kernel in backend
+  static int CountKernels(const tflite::Model* model, KernelBackend backend);
+
+  static void PrintSelection();
+};
+
+#endif  // KERNEL_BACKENDS_H_
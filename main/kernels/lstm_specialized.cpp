@@ -0,0 +1,284 @@
+/**
+ * @file lstm_specialized.cpp
+ * @brief Compile-time shaped float32 LSTM with fused gate matmul
+ */
+
+#include "lstm_specialized.h"
+
+#include <math.h>
+#include <stddef.h>
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/lstm_shared.h"
+#include "tensorflow/lite/micro/kernels/micro_ops.h"
+#include "tensorflow/lite/micro/micro_context.h"
+
+#include "fallback_kernel.h"
+
+namespace {
+
+// Keras / TFLite gate order, also the row blocks of the packed matrix
+constexpr int kGateCount = 4;
+constexpr int kInputWeights[kGateCount] = {
+    tflite::kLstmInputToInputWeightsTensor, tflite::kLstmInputToForgetWeightsTensor,
+    tflite::kLstmInputToCellWeightsTensor, tflite::kLstmInputToOutputWeightsTensor};
+constexpr int kRecurrentWeights[kGateCount] = {
+    tflite::kLstmRecurrentToInputWeightsTensor, tflite::kLstmRecurrentToForgetWeightsTensor,
+    tflite::kLstmRecurrentToCellWeightsTensor, tflite::kLstmRecurrentToOutputWeightsTensor};
+constexpr int kGateBiases[kGateCount] = {
+    tflite::kLstmInputGateBiasTensor, tflite::kLstmForgetGateBiasTensor,
+    tflite::kLstmCellGateBiasTensor, tflite::kLstmOutputGateBiasTensor};
+// Inputs that must be absent: peephole, projection, layer norm
+constexpr int kUnsupportedInputs[] = {
+    tflite::kLstmCellToInputWeightsTensor, tflite::kLstmCellToForgetWeightsTensor,
+    tflite::kLstmCellToOutputWeightsTensor, tflite::kLstmProjectionWeightsTensor,
+    tflite::kLstmProjectionBiasTensor, tflite::kLstmInputLayerNormCoefficientsTensor,
+    tflite::kLstmForgetLayerNormCoefficientsTensor, tflite::kLstmCellLayerNormCoefficientsTensor,
+    tflite::kLstmOutputLayerNormCoefficientsTensor};
+
+// Gate weights as the model stores them
+struct GateTensors {
+  const float* input_weights[kGateCount];      // [units, inputs]
+  const float* recurrent_weights[kGateCount];  // [units, units]
+  const float* biases[kGateCount];             // [units]
+};
+
+// Same as reference_ops::Logistic, which the stock kernel uses
+inline float Sigmoid(float x) {
+  if (x > 16.619047164916992188f) return 1.0f;
+  if (x < -9.0f) return expf(x);
+  return 1.0f / (1.0f + expf(-x));
+}
+
+template <int kUnits, int kInputs>
+struct PackedLstm {
+  static constexpr int kRows = kGateCount * kUnits;
+  static constexpr int kCols = kInputs + kUnits;
+  float weights[kRows][kCols];  // Row r: [W_x(r) | W_h(r)]
+  float bias[kRows];
+};
+
+template <int kUnits, int kInputs>
+void Pack(void* buffer, const GateTensors& gates) {
+  auto* packed = static_cast<PackedLstm<kUnits, kInputs>*>(buffer);
+  for (int g = 0; g < kGateCount; g++) {
+    for (int u = 0; u < kUnits; u++) {
+      float* row = packed->weights[g * kUnits + u];
+      for (int i = 0; i < kInputs; i++) row[i] = gates.input_weights[g][u * kInputs + i];
+      for (int j = 0; j < kUnits; j++) row[kInputs + j] = gates.recurrent_weights[g][u * kUnits + j];
+      packed->bias[g * kUnits + u] = gates.biases[g][u];
+    }
+  }
+}
+
+template <int kUnits, int kInputs, int kSteps>
+void Run(const void* buffer, const float* input, float* output, float* output_state,
+         float* cell_state, int batches, bool time_major, float cell_clip) {
+  using Packed = PackedLstm<kUnits, kInputs>;
+  const Packed& packed = *static_cast<const Packed*>(buffer);
+  for (int b = 0; b < batches; b++) {
+    float* h = output_state + b * kUnits;
+    float* c = cell_state + b * kUnits;
+    for (int t = 0; t < kSteps; t++) {
+      const int step = time_major ? t * batches + b : b * kSteps + t;
+      const float* x = input + step * kInputs;
+
+      float xh[Packed::kCols];
+#pragma GCC unroll 32
+      for (int i = 0; i < kInputs; i++) xh[i] = x[i];
+#pragma GCC unroll 32
+      for (int j = 0; j < kUnits; j++) xh[kInputs + j] = h[j];
+
+      // All four gates in one matmul
+      float z[Packed::kRows];
+      for (int r = 0; r < Packed::kRows; r++) {
+        const float* row = packed.weights[r];
+        float acc = packed.bias[r];
+#pragma GCC unroll 32
+        for (int k = 0; k < Packed::kCols; k++) acc += row[k] * xh[k];
+        z[r] = acc;
+      }
+
+      float* out = output + step * kUnits;
+#pragma GCC unroll 16
+      for (int u = 0; u < kUnits; u++) {
+        const float input_gate = Sigmoid(z[u]);
+        const float forget_gate = Sigmoid(z[kUnits + u]);
+        const float cell_gate = tanhf(z[2 * kUnits + u]);
+        const float output_gate = Sigmoid(z[3 * kUnits + u]);
+        float cell = forget_gate * c[u] + input_gate * cell_gate;
+        if (cell_clip > 0.0f) {
+          cell = cell > cell_clip ? cell_clip : (cell < -cell_clip ? -cell_clip : cell);
+        }
+        c[u] = cell;
+        h[u] = output_gate * tanhf(cell);
+        out[u] = h[u];
+      }
+    }
+  }
+}
+
+struct Specialization {
+  int units;
+  int inputs;
+  int steps;
+  size_t packed_bytes;
+  void (*pack)(void* buffer, const GateTensors& gates);
+  void (*run)(const void* buffer, const float* input, float* output, float* output_state,
+              float* cell_state, int batches, bool time_major, float cell_clip);
+};
+
+template <int kUnits, int kInputs, int kSteps>
+constexpr Specialization Specialize() {
+  return {kUnits, kInputs, kSteps, sizeof(PackedLstm<kUnits, kInputs>),
+          Pack<kUnits, kInputs>, Run<kUnits, kInputs, kSteps>};
+}
+
+// Shapes of the benchmark models; add one line per new RNN
+const Specialization kSpecializations[] = {
+  Specialize<16, 1, 10>(),  // rnn (float32)
+  Specialize<16, 1, 1>(),   // rnn_stream
+};
+
+struct OpData {
+  const Specialization* specialization;  // null: stock kernel
+  void* packed;
+  int batches;
+  bool time_major;
+  float cell_clip;
+  void* fallback_data;  // Stock kernel's user_data
+};
+
+const TFLMRegistration& Fallback() {
+  static const TFLMRegistration registration = tflite::Register_UNIDIRECTIONAL_SEQUENCE_LSTM();
+  return registration;
+}
+
+void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  return InitWithFallback<OpData>(context, buffer, length, Fallback());
+}
+
+void Free(TfLiteContext* context, void* buffer) {
+  FreeFallback<OpData>(context, buffer, Fallback());
+}
+
+void Reset(TfLiteContext* context, void* buffer) {
+  ResetFallback<OpData>(context, buffer, Fallback());
+}
+
+bool IsFloat(const TfLiteTensor* tensor) {
+  return tensor != nullptr && tensor->type == kTfLiteFloat32;
+}
+
+// Specialization matching this node, or null when the stock kernel runs it
+const Specialization* Match(TfLiteContext* context, TfLiteNode* node,
+                            const TfLiteUnidirectionalSequenceLSTMParams& params,
+                            GateTensors* gates, int* batches) {
+  if (params.activation != kTfLiteActTanh) return nullptr;
+  tflite::MicroContext* micro_context = tflite::GetMicroContext(context);
+  const Specialization* match = nullptr;
+  bool supported = true;
+
+  for (int index : kUnsupportedInputs) {
+    if (index >= tflite::NumInputs(node)) continue;
+    TfLiteTensor* tensor = micro_context->AllocateTempInputTensor(node, index);
+    if (tensor != nullptr) {
+      supported = false;
+      micro_context->DeallocateTempTfLiteTensor(tensor);
+    }
+  }
+
+  TfLiteTensor* input = micro_context->AllocateTempInputTensor(node, tflite::kLstmInputTensor);
+  TfLiteTensor* recurrent =
+      micro_context->AllocateTempInputTensor(node, tflite::kLstmRecurrentToForgetWeightsTensor);
+  TfLiteTensor* output = micro_context->AllocateTempOutputTensor(node, tflite::kLstmOutputTensor);
+  supported = supported && IsFloat(input) && IsFloat(recurrent) && IsFloat(output) &&
+              tflite::NumDimensions(input) == 3 && tflite::NumDimensions(recurrent) == 2;
+  if (supported) {
+    const int steps = tflite::SizeOfDimension(input, params.time_major ? 0 : 1);
+    const int inputs = tflite::SizeOfDimension(input, 2);
+    const int units = tflite::SizeOfDimension(recurrent, 0);
+    *batches = tflite::SizeOfDimension(input, params.time_major ? 1 : 0);
+    for (const Specialization& s : kSpecializations) {
+      if (s.units == units && s.inputs == inputs && s.steps == steps) match = &s;
+    }
+  }
+  if (input != nullptr) micro_context->DeallocateTempTfLiteTensor(input);
+  if (recurrent != nullptr) micro_context->DeallocateTempTfLiteTensor(recurrent);
+  if (output != nullptr) micro_context->DeallocateTempTfLiteTensor(output);
+
+  // Every gate present (no CIFG), float32 and shaped as specialized
+  for (int g = 0; match != nullptr && g < kGateCount; g++) {
+    TfLiteTensor* w = micro_context->AllocateTempInputTensor(node, kInputWeights[g]);
+    TfLiteTensor* r = micro_context->AllocateTempInputTensor(node, kRecurrentWeights[g]);
+    TfLiteTensor* bias = micro_context->AllocateTempInputTensor(node, kGateBiases[g]);
+    if (IsFloat(w) && IsFloat(r) && IsFloat(bias) &&
+        tflite::NumElements(w) == match->units * match->inputs &&
+        tflite::NumElements(r) == match->units * match->units &&
+        tflite::NumElements(bias) == match->units) {
+      // Constant tensors: these point into the flatbuffer
+      gates->input_weights[g] = tflite::GetTensorData<float>(w);
+      gates->recurrent_weights[g] = tflite::GetTensorData<float>(r);
+      gates->biases[g] = tflite::GetTensorData<float>(bias);
+    } else {
+      match = nullptr;
+    }
+    if (w != nullptr) micro_context->DeallocateTempTfLiteTensor(w);
+    if (r != nullptr) micro_context->DeallocateTempTfLiteTensor(r);
+    if (bias != nullptr) micro_context->DeallocateTempTfLiteTensor(bias);
+  }
+  return match;
+}
+
+TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  TF_LITE_ENSURE(context, node->user_data != nullptr && node->builtin_data != nullptr);
+  auto* data = static_cast<OpData*>(node->user_data);
+  const auto& params =
+      *static_cast<const TfLiteUnidirectionalSequenceLSTMParams*>(node->builtin_data);
+
+  GateTensors gates = {};
+  data->specialization = Match(context, node, params, &gates, &data->batches);
+  if (data->specialization == nullptr) {
+    return WithFallbackData<OpData>(node, [&] { return Fallback().prepare(context, node); });
+  }
+  data->time_major = params.time_major;
+  data->cell_clip = params.cell_clip;
+  if (data->packed == nullptr) {
+    data->packed = context->AllocatePersistentBuffer(context, data->specialization->packed_bytes);
+    TF_LITE_ENSURE(context, data->packed != nullptr);
+  }
+  data->specialization->pack(data->packed, gates);
+  return kTfLiteOk;
+}
+
+TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
+  const auto& data = *static_cast<const OpData*>(node->user_data);
+  if (data.specialization == nullptr) {
+    return WithFallbackData<OpData>(node, [&] { return Fallback().invoke(context, node); });
+  }
+  const TfLiteEvalTensor* input =
+      tflite::micro::GetEvalInput(context, node, tflite::kLstmInputTensor);
+  TfLiteEvalTensor* output_state =
+      tflite::micro::GetMutableEvalInput(context, node, tflite::kLstmOutputStateTensor);
+  TfLiteEvalTensor* cell_state =
+      tflite::micro::GetMutableEvalInput(context, node, tflite::kLstmCellStateTensor);
+  TfLiteEvalTensor* output = tflite::micro::GetEvalOutput(context, node, tflite::kLstmOutputTensor);
+  TF_LITE_ENSURE(context, output_state != nullptr && cell_state != nullptr);
+
+  data.specialization->run(data.packed, tflite::micro::GetTensorData<float>(input),
+                           tflite::micro::GetTensorData<float>(output),
+                           tflite::micro::GetTensorData<float>(output_state),
+                           tflite::micro::GetTensorData<float>(cell_state), data.batches,
+                           data.time_major, data.cell_clip);
+  return kTfLiteOk;
+}
+
+}  // namespace
+
+TFLMRegistration RegisterSpecializedLstm() {
+  return tflite::micro::RegisterOp(Init, Prepare, Eval, Free, Reset);
+}
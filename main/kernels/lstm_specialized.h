@@ -0,0 +1,19 @@
+#ifndef LSTM_SPECIALIZED_H_
+#define LSTM_SPECIALIZED_H_
+
+#include "tensorflow/lite/micro/micro_common.h"
+
+// UNIDIRECTIONAL_SEQUENCE_LSTM with hidden size, input size and sequence
+// length as template parameters, instantiated for the benchmark RNNs
+// (16 units, 1 feature, 10 steps for rnn and 1 step for rnn_stream).
+// Prepare() packs the four gates' input and recurrent weights into one
+// [4 * units, inputs + units] matrix in the persistent arena, so every
+// timestep is a single matmul over [x_t, h_{t-1}] with the dot products
+// unrolled, followed by the gate nonlinearities.
+//
+// float32, no CIFG, peephole, projection or layer norm, TANH activation.
+// Any other LSTM (shape or variant) runs TFLite Micro's kernel, which this
+// registration wraps. It is the LSTM's KernelBackend::CUSTOM kernel.
+TFLMRegistration RegisterSpecializedLstm();
+
+#endif  // LSTM_SPECIALIZED_H_
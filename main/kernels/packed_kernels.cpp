@@ -0,0 +1,400 @@
+/**
+ * @file packed_kernels.cpp
+ * @brief int8 CONV_2D / FULLY_CONNECTED over pre-packed weight blocks
+ */
+
+#include "packed_kernels.h"
+
+#include <string.h>
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/kernels/padding.h"
+#include "tensorflow/lite/micro/kernels/conv.h"
+#include "tensorflow/lite/micro/kernels/fully_connected.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_context.h"
+#include "tensorflow/lite/micro/micro_log.h"
+
+#include "fallback_kernel.h"
+#include "packed_weights.h"
+
+namespace {
+
+constexpr int kInputTensor = 0;
+constexpr int kFilterTensor = 1;
+constexpr int kBiasTensor = 2;
+constexpr int kOutputTensor = 0;
+
+struct OpData {
+  bool packed;  // false: stock kernel
+  PackedWeightsEntry weights;
+  int blocks;  // kPackedDepth-byte blocks per filter row
+  int batches;
+
+  // CONV_2D only: NHWC / OHWI dimensions and geometry
+  int input_height, input_width, input_depth;
+  int filter_height, filter_width;
+  int output_height, output_width;
+  int stride_height, stride_width;
+  int dilation_height, dilation_width;
+  int padding_height, padding_width;
+
+  int32_t input_offset;
+  int32_t output_offset;
+  int32_t* bias;  // bias + input_offset * sum(filter row), per channel
+  int32_t* output_multiplier;
+  int* output_shift;
+  int32_t activation_min;
+  int32_t activation_max;
+  int scratch_index;  // Patch / padded row; -1 when rows are read in place
+
+  void* fallback_data;  // Stock kernel's user_data
+};
+
+const TFLMRegistration& ConvFallback() {
+  static const TFLMRegistration registration = tflite::Register_CONV_2D();
+  return registration;
+}
+
+const TFLMRegistration& FullyConnectedFallback() {
+  static const TFLMRegistration registration = tflite::Register_FULLY_CONNECTED();
+  return registration;
+}
+
+void* Init(TfLiteContext* context, const char* buffer, size_t length,
+           const TFLMRegistration& fallback) {
+  OpData* data = InitWithFallback<OpData>(context, buffer, length, fallback);
+  if (data != nullptr) data->scratch_index = -1;
+  return data;
+}
+
+void FreeConv(TfLiteContext* context, void* buffer) {
+  FreeFallback<OpData>(context, buffer, ConvFallback());
+}
+
+void ResetConv(TfLiteContext* context, void* buffer) {
+  ResetFallback<OpData>(context, buffer, ConvFallback());
+}
+
+void FreeFullyConnected(TfLiteContext* context, void* buffer) {
+  FreeFallback<OpData>(context, buffer, FullyConnectedFallback());
+}
+
+void ResetFullyConnected(TfLiteContext* context, void* buffer) {
+  ResetFallback<OpData>(context, buffer, FullyConnectedFallback());
+}
+
+void* InitConv(TfLiteContext* context, const char* buffer, size_t length) {
+  return Init(context, buffer, length, ConvFallback());
+}
+
+void* InitFullyConnected(TfLiteContext* context, const char* buffer, size_t length) {
+  return Init(context, buffer, length, FullyConnectedFallback());
+}
+
+// Four output channels per pass over x (data.blocks * kPackedDepth bytes;
+// the padded weights are zero, so bytes past the row never contribute)
+void PackedMatVec(const OpData& data, const int8_t* x, int8_t* output) {
+  const int8_t* w = data.weights.data;
+  for (int c0 = 0; c0 < data.weights.channels; c0 += kPackedChannels) {
+    int32_t acc[kPackedChannels] = {};
+    for (int b = 0; b < data.blocks; b++, w += kPackedBlockBytes) {
+      const int8_t* in = x + b * kPackedDepth;
+      for (int r = 0; r < kPackedChannels; r++) {
+        const int8_t* row = w + r * kPackedDepth;
+        int32_t sum = 0;
+#pragma GCC unroll 16
+        for (int i = 0; i < kPackedDepth; i++) sum += in[i] * row[i];
+        acc[r] += sum;
+      }
+    }
+    const int rows = data.weights.channels - c0 < kPackedChannels ? data.weights.channels - c0
+                                                                  : kPackedChannels;
+    for (int r = 0; r < rows; r++) {
+      const int c = c0 + r;
+      int32_t value = tflite::MultiplyByQuantizedMultiplier(
+                          acc[r] + data.bias[c], data.output_multiplier[c],
+                          data.output_shift[c]) +
+                      data.output_offset;
+      value = value < data.activation_min ? data.activation_min : value;
+      value = value > data.activation_max ? data.activation_max : value;
+      output[c] = static_cast<int8_t>(value);
+    }
+  }
+}
+
+// The filter's packed copy, if the interpreter carries PackedWeights and
+// the node is int8 with a filter this kernel can take
+bool FindPacked(TfLiteContext* context, const TfLiteTensor* input, const TfLiteTensor* filter,
+                const TfLiteTensor* bias, const TfLiteTensor* output, int channels, int depth,
+                PackedWeightsEntry* entry) {
+  const auto* packed =
+      static_cast<const PackedWeights*>(tflite::GetMicroContext(context)->external_context());
+  if (packed == nullptr || input->type != kTfLiteInt8 || filter->type != kTfLiteInt8 ||
+      output->type != kTfLiteInt8 || (bias != nullptr && bias->type != kTfLiteInt32) ||
+      filter->quantization.type != kTfLiteAffineQuantization) {
+    return false;
+  }
+  const auto* quantization =
+      static_cast<const TfLiteAffineQuantization*>(filter->quantization.params);
+  if (quantization == nullptr || quantization->scale == nullptr ||
+      (quantization->scale->size != 1 && quantization->scale->size != channels)) {
+    return false;
+  }
+  return packed->Find(filter->data.data, entry) && entry->channels == channels &&
+         entry->depth == depth;
+}
+
+// Folded bias, per-channel requantization and activation range. The
+// multipliers follow the stock kernels: CONV_2D and per-channel
+// FULLY_CONNECTED scale in double, per-tensor FULLY_CONNECTED multiplies
+// the float scales first.
+TfLiteStatus PrepareQuantized(TfLiteContext* context, OpData* data, const TfLiteTensor* input,
+                              const TfLiteTensor* filter, const TfLiteTensor* bias,
+                              TfLiteTensor* output, TfLiteFusedActivation activation,
+                              bool float_product) {
+  const int channels = data->weights.channels;
+  const int depth = data->weights.depth;
+  data->bias = static_cast<int32_t*>(
+      context->AllocatePersistentBuffer(context, channels * sizeof(int32_t)));
+  data->output_multiplier = static_cast<int32_t*>(
+      context->AllocatePersistentBuffer(context, channels * sizeof(int32_t)));
+  data->output_shift =
+      static_cast<int*>(context->AllocatePersistentBuffer(context, channels * sizeof(int)));
+  TF_LITE_ENSURE(context, data->bias != nullptr && data->output_multiplier != nullptr &&
+                              data->output_shift != nullptr);
+
+  data->input_offset = -input->params.zero_point;
+  data->output_offset = output->params.zero_point;
+  const auto* quantization =
+      static_cast<const TfLiteAffineQuantization*>(filter->quantization.params);
+  const int scales = quantization->scale->size;
+  const int8_t* weights = tflite::GetTensorData<int8_t>(filter);
+  const int32_t* bias_data = bias != nullptr ? tflite::GetTensorData<int32_t>(bias) : nullptr;
+  for (int c = 0; c < channels; c++) {
+    int32_t row_sum = 0;
+    for (int k = 0; k < depth; k++) row_sum += weights[c * depth + k];
+    data->bias[c] = (bias_data != nullptr ? bias_data[c] : 0) + data->input_offset * row_sum;
+
+    const float filter_scale = quantization->scale->data[scales == 1 ? 0 : c];
+    const double effective_scale =
+        float_product
+            ? static_cast<double>(input->params.scale * filter_scale) / output->params.scale
+            : static_cast<double>(input->params.scale) * filter_scale / output->params.scale;
+    tflite::QuantizeMultiplier(effective_scale, &data->output_multiplier[c],
+                               &data->output_shift[c]);
+  }
+  return tflite::CalculateActivationRangeQuantized(context, activation, output,
+                                                   &data->activation_min, &data->activation_max);
+}
+
+TfLiteStatus RequestScratch(TfLiteContext* context, OpData* data) {
+  return context->RequestScratchBufferInArena(
+      context, static_cast<size_t>(data->blocks) * kPackedDepth, &data->scratch_index);
+}
+
+void DeallocateTemps(tflite::MicroContext* micro_context, TfLiteTensor* input,
+                     TfLiteTensor* filter, TfLiteTensor* bias, TfLiteTensor* output) {
+  if (input != nullptr) micro_context->DeallocateTempTfLiteTensor(input);
+  if (filter != nullptr) micro_context->DeallocateTempTfLiteTensor(filter);
+  if (bias != nullptr) micro_context->DeallocateTempTfLiteTensor(bias);
+  if (output != nullptr) micro_context->DeallocateTempTfLiteTensor(output);
+}
+
+TfLiteStatus PrepareConv(TfLiteContext* context, TfLiteNode* node) {
+  TF_LITE_ENSURE(context, node->user_data != nullptr && node->builtin_data != nullptr);
+  auto* data = static_cast<OpData*>(node->user_data);
+  const auto& params = *static_cast<const TfLiteConvParams*>(node->builtin_data);
+
+  tflite::MicroContext* micro_context = tflite::GetMicroContext(context);
+  TfLiteTensor* input = micro_context->AllocateTempInputTensor(node, kInputTensor);
+  TfLiteTensor* filter = micro_context->AllocateTempInputTensor(node, kFilterTensor);
+  TfLiteTensor* bias = tflite::NumInputs(node) > kBiasTensor
+                           ? micro_context->AllocateTempInputTensor(node, kBiasTensor)
+                           : nullptr;
+  TfLiteTensor* output = micro_context->AllocateTempOutputTensor(node, kOutputTensor);
+
+  data->packed = input != nullptr && filter != nullptr && output != nullptr &&
+                 tflite::NumDimensions(input) == 4 && tflite::NumDimensions(filter) == 4 &&
+                 tflite::NumDimensions(output) == 4 &&
+                 tflite::SizeOfDimension(filter, 3) == tflite::SizeOfDimension(input, 3) &&
+                 FindPacked(context, input, filter, bias, output,
+                            tflite::SizeOfDimension(filter, 0),
+                            tflite::SizeOfDimension(filter, 1) *
+                                tflite::SizeOfDimension(filter, 2) *
+                                tflite::SizeOfDimension(filter, 3),
+                            &data->weights);
+  if (!data->packed) {
+    DeallocateTemps(micro_context, input, filter, bias, output);
+    return WithFallbackData<OpData>(node, [&] { return ConvFallback().prepare(context, node); });
+  }
+
+  data->batches = tflite::SizeOfDimension(input, 0);
+  data->input_height = tflite::SizeOfDimension(input, 1);
+  data->input_width = tflite::SizeOfDimension(input, 2);
+  data->input_depth = tflite::SizeOfDimension(input, 3);
+  data->filter_height = tflite::SizeOfDimension(filter, 1);
+  data->filter_width = tflite::SizeOfDimension(filter, 2);
+  data->stride_height = params.stride_height;
+  data->stride_width = params.stride_width;
+  data->dilation_height = params.dilation_height_factor;
+  data->dilation_width = params.dilation_width_factor;
+  data->blocks = (data->weights.depth + kPackedDepth - 1) / kPackedDepth;
+
+  const TfLitePaddingValues padding = tflite::ComputePaddingHeightWidth(
+      params.stride_height, params.stride_width, params.dilation_height_factor,
+      params.dilation_width_factor, data->input_height, data->input_width,
+      data->filter_height, data->filter_width, params.padding, &data->output_height,
+      &data->output_width);
+  data->padding_height = padding.height;
+  data->padding_width = padding.width;
+
+  TfLiteStatus status = kTfLiteOk;
+  if (tflite::SizeOfDimension(output, 0) != data->batches ||
+      tflite::SizeOfDimension(output, 1) != data->output_height ||
+      tflite::SizeOfDimension(output, 2) != data->output_width ||
+      tflite::SizeOfDimension(output, 3) != data->weights.channels) {
+    MicroPrintf("CONV_2D (packed): output shape mismatch");
+    status = kTfLiteError;
+  }
+  if (status == kTfLiteOk) {
+    status = PrepareQuantized(context, data, input, filter, bias, output, params.activation,
+                              /*float_product=*/false);
+  }
+  if (status == kTfLiteOk) status = RequestScratch(context, data);
+  DeallocateTemps(micro_context, input, filter, bias, output);
+  return status;
+}
+
+TfLiteStatus PrepareFullyConnected(TfLiteContext* context, TfLiteNode* node) {
+  TF_LITE_ENSURE(context, node->user_data != nullptr && node->builtin_data != nullptr);
+  auto* data = static_cast<OpData*>(node->user_data);
+  const auto& params = *static_cast<const TfLiteFullyConnectedParams*>(node->builtin_data);
+
+  tflite::MicroContext* micro_context = tflite::GetMicroContext(context);
+  TfLiteTensor* input = micro_context->AllocateTempInputTensor(node, kInputTensor);
+  TfLiteTensor* filter = micro_context->AllocateTempInputTensor(node, kFilterTensor);
+  TfLiteTensor* bias = tflite::NumInputs(node) > kBiasTensor
+                           ? micro_context->AllocateTempInputTensor(node, kBiasTensor)
+                           : nullptr;
+  TfLiteTensor* output = micro_context->AllocateTempOutputTensor(node, kOutputTensor);
+
+  data->packed = input != nullptr && filter != nullptr && output != nullptr &&
+                 params.weights_format == kTfLiteFullyConnectedWeightsFormatDefault &&
+                 tflite::NumDimensions(filter) == 2 &&
+                 FindPacked(context, input, filter, bias, output,
+                            tflite::SizeOfDimension(filter, 0),
+                            tflite::SizeOfDimension(filter, 1), &data->weights);
+  if (data->packed) {
+    const int depth = data->weights.depth;
+    data->batches = tflite::NumElements(input) / depth;
+    data->packed = tflite::NumElements(input) == data->batches * depth &&
+                   tflite::NumElements(output) == data->batches * data->weights.channels;
+  }
+  if (!data->packed) {
+    DeallocateTemps(micro_context, input, filter, bias, output);
+    return WithFallbackData<OpData>(node,
+                            [&] { return FullyConnectedFallback().prepare(context, node); });
+  }
+
+  data->blocks = (data->weights.depth + kPackedDepth - 1) / kPackedDepth;
+  const auto* quantization =
+      static_cast<const TfLiteAffineQuantization*>(filter->quantization.params);
+  TfLiteStatus status = PrepareQuantized(context, data, input, filter, bias, output,
+                                         params.activation,
+                                         /*float_product=*/quantization->scale->size == 1);
+  // Rows that fill whole blocks are read in place
+  if (status == kTfLiteOk && data->weights.depth % kPackedDepth != 0) {
+    status = RequestScratch(context, data);
+  }
+  DeallocateTemps(micro_context, input, filter, bias, output);
+  return status;
+}
+
+void RunConv(const OpData& data, const int8_t* input, int8_t* patch, int8_t* output) {
+  // Out-of-image taps read the input zero point, i.e. contribute nothing
+  const int8_t pad_value = static_cast<int8_t>(-data.input_offset);
+  const size_t pixel_bytes = data.input_depth;
+  for (int b = 0; b < data.batches; b++) {
+    for (int y = 0; y < data.output_height; y++) {
+      const int in_y0 = y * data.stride_height - data.padding_height;
+      for (int x = 0; x < data.output_width; x++) {
+        const int in_x0 = x * data.stride_width - data.padding_width;
+        int8_t* dst = patch;
+        for (int ky = 0; ky < data.filter_height; ky++) {
+          const int in_y = in_y0 + ky * data.dilation_height;
+          for (int kx = 0; kx < data.filter_width; kx++, dst += pixel_bytes) {
+            const int in_x = in_x0 + kx * data.dilation_width;
+            if (in_y < 0 || in_y >= data.input_height || in_x < 0 || in_x >= data.input_width) {
+              memset(dst, pad_value, pixel_bytes);
+              continue;
+            }
+            memcpy(dst,
+                   input + ((b * data.input_height + in_y) * data.input_width + in_x) *
+                               data.input_depth,
+                   pixel_bytes);
+          }
+        }
+        PackedMatVec(data, patch,
+                     output + ((b * data.output_height + y) * data.output_width + x) *
+                                  data.weights.channels);
+      }
+    }
+  }
+}
+
+TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node, const TFLMRegistration& fallback,
+                  bool conv) {
+  const auto& data = *static_cast<const OpData*>(node->user_data);
+  if (!data.packed) {
+    return WithFallbackData<OpData>(node, [&] { return fallback.invoke(context, node); });
+  }
+  const TfLiteEvalTensor* input = tflite::micro::GetEvalInput(context, node, kInputTensor);
+  TfLiteEvalTensor* output = tflite::micro::GetEvalOutput(context, node, kOutputTensor);
+  const int8_t* in = tflite::micro::GetTensorData<int8_t>(input);
+  int8_t* out = tflite::micro::GetTensorData<int8_t>(output);
+  int8_t* scratch = data.scratch_index >= 0
+                        ? static_cast<int8_t*>(context->GetScratchBuffer(context, data.scratch_index))
+                        : nullptr;
+  TF_LITE_ENSURE(context, data.scratch_index < 0 || scratch != nullptr);
+
+  if (conv) {
+    RunConv(data, in, scratch, out);
+    return kTfLiteOk;
+  }
+  const int depth = data.weights.depth;
+  for (int b = 0; b < data.batches; b++) {
+    const int8_t* row = in + b * depth;
+    if (scratch != nullptr) {
+      memcpy(scratch, row, depth);
+      row = scratch;
+    }
+    PackedMatVec(data, row, out + b * data.weights.channels);
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus EvalConv(TfLiteContext* context, TfLiteNode* node) {
+  return Eval(context, node, ConvFallback(), /*conv=*/true);
+}
+
+TfLiteStatus EvalFullyConnected(TfLiteContext* context, TfLiteNode* node) {
+  return Eval(context, node, FullyConnectedFallback(), /*conv=*/false);
+}
+
+}  // namespace
+
+TFLMRegistration RegisterPackedConv2D() {
+  return tflite::micro::RegisterOp(InitConv, PrepareConv, EvalConv, FreeConv, ResetConv);
+}
+
+TFLMRegistration RegisterPackedFullyConnected() {
+  return tflite::micro::RegisterOp(InitFullyConnected, PrepareFullyConnected,
+                                   EvalFullyConnected, FreeFullyConnected,
+                                   ResetFullyConnected);
+}
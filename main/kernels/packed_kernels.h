@@ -0,0 +1,22 @@
+#ifndef PACKED_KERNELS_H_
+#define PACKED_KERNELS_H_
+
+#include "tensorflow/lite/micro/micro_common.h"
+
+// int8 CONV_2D and FULLY_CONNECTED over the filters scripts/pack_weights.py
+// pre-packed into the model (packed_weights.h). Each output pixel or batch
+// row is a matrix-vector product over 16-byte blocks, four output channels
+// per pass, so every input vector is loaded once per four channels and all
+// weight loads are aligned and free of tails; CONV_2D first gathers the
+// pixel's receptive field into a scratch patch (padding as the input zero
+// point). The input zero point is folded into the bias at Prepare().
+//
+// Per-tensor or per-channel int8 weights, any stride, dilation, padding
+// and fused activation. Float models, filters without a packed copy and
+// interpreters without PackedWeights as external context run TFLite
+// Micro's kernel, which these registrations wrap. They are the ops'
+// KernelBackend::CUSTOM kernels.
+TFLMRegistration RegisterPackedConv2D();
+TFLMRegistration RegisterPackedFullyConnected();
+
+#endif  // PACKED_KERNELS_H_
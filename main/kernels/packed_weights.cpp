@@ -0,0 +1,102 @@
+/**
+ * @file packed_weights.cpp
+ * @brief Lookup of pre-packed filters in a model's PackedWeights metadata
+ */
+
+#include "packed_weights.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "tensorflow/lite/micro/micro_log.h"
+
+namespace {
+constexpr char kMetadataName[] = "PackedWeights";
+constexpr int32_t kVersion = 1;
+constexpr int kHeaderInts = 2;  // version, count
+constexpr int kEntryInts = 4;   // buffer index, channels, depth, offset
+
+int32_t ReadInt(const uint8_t* payload, int index) {
+  int32_t value;
+  memcpy(&value, payload + index * sizeof(int32_t), sizeof(value));
+  return value;
+}
+
+size_t PackedBytes(int channels, int depth) {
+  const size_t groups = (channels + kPackedChannels - 1) / kPackedChannels;
+  const size_t blocks = (depth + kPackedDepth - 1) / kPackedDepth;
+  return groups * blocks * kPackedBlockBytes;
+}
+}  // namespace
+
+bool PackedWeights::Bind(const tflite::Model* model) {
+  Clear();
+  if (model == nullptr || model->metadata() == nullptr || model->buffers() == nullptr) {
+    return false;
+  }
+  const flatbuffers::Vector<uint8_t>* data = nullptr;
+  for (uint32_t i = 0; i < model->metadata()->size(); i++) {
+    const tflite::Metadata* entry = model->metadata()->Get(i);
+    if (entry->name() == nullptr || strcmp(entry->name()->c_str(), kMetadataName) != 0) {
+      continue;
+    }
+    if (entry->buffer() < model->buffers()->size()) {
+      data = model->buffers()->Get(entry->buffer())->data();
+    }
+    break;
+  }
+  if (data == nullptr) return false;
+
+  // Everything the kernels will index is checked once here
+  const uint8_t* payload = data->data();
+  const size_t size = data->size();
+  if (size < kHeaderInts * sizeof(int32_t) || ReadInt(payload, 0) != kVersion) {
+    MicroPrintf("PackedWeights: unsupported metadata, ignored");
+    return false;
+  }
+  const int32_t count = ReadInt(payload, 1);
+  if (count < 0 || size < (kHeaderInts + static_cast<size_t>(count) * kEntryInts) *
+                             sizeof(int32_t)) {
+    MicroPrintf("PackedWeights: truncated metadata, ignored");
+    return false;
+  }
+  for (int i = 0; i < count; i++) {
+    const int base = kHeaderInts + i * kEntryInts;
+    const int32_t channels = ReadInt(payload, base + 1);
+    const int32_t depth = ReadInt(payload, base + 2);
+    const int32_t offset = ReadInt(payload, base + 3);
+    if (channels <= 0 || depth <= 0 || offset < 0 ||
+        reinterpret_cast<uintptr_t>(payload + offset) % kPackedDepth != 0 ||
+        static_cast<size_t>(offset) + PackedBytes(channels, depth) > size) {
+      MicroPrintf("PackedWeights: entry %d out of bounds, ignored", i);
+      return false;
+    }
+  }
+  model_ = model;
+  payload_ = payload;
+  count_ = count;
+  return true;
+}
+
+void PackedWeights::Clear() {
+  model_ = nullptr;
+  payload_ = nullptr;
+  count_ = 0;
+}
+
+bool PackedWeights::Find(const void* weights, PackedWeightsEntry* entry) const {
+  if (weights == nullptr) return false;
+  const auto* buffers = model_ != nullptr ? model_->buffers() : nullptr;
+  for (int i = 0; i < count_; i++) {
+    const int base = kHeaderInts + i * kEntryInts;
+    const uint32_t buffer = static_cast<uint32_t>(ReadInt(payload_, base));
+    if (buffer >= buffers->size()) continue;
+    const flatbuffers::Vector<uint8_t>* data = buffers->Get(buffer)->data();
+    if (data == nullptr || data->data() != weights) continue;
+    entry->data = reinterpret_cast<const int8_t*>(payload_ + ReadInt(payload_, base + 3));
+    entry->channels = ReadInt(payload_, base + 1);
+    entry->depth = ReadInt(payload_, base + 2);
+    return true;
+  }
+  return false;
+}
@@ -0,0 +1,45 @@
+#ifndef PACKED_WEIGHTS_H_
+#define PACKED_WEIGHTS_H_
+
+#include <stdint.h>
+
+#include "tensorflow/lite/schema/schema_generated.h"
+
+// Block shape of scripts/pack_weights.py: kPackedChannels rows interleaved
+// per kPackedDepth-byte block, each block 16-byte aligned
+constexpr int kPackedChannels = 4;
+constexpr int kPackedDepth = 16;
+constexpr int kPackedBlockBytes = kPackedChannels * kPackedDepth;
+
+// Packed copy of one [channels, depth] int8 filter: ceil(channels / 4)
+// groups of ceil(depth / 16) blocks, zero-padded
+struct PackedWeightsEntry {
+  const int8_t* data;
+  int channels;
+  int depth;
+};
+
+// The "PackedWeights" metadata of the model being run. ModelSession binds
+// it to the model and hands it to the interpreter as the external context
+// (MicroContext::external_context()), where the packed kernels look their
+// filters up in Prepare(). A model without the metadata binds to nothing
+// and every lookup fails, so the kernels fall back to the stock ones.
+class PackedWeights {
+ public:
+  // Parse and validate the model's metadata; false when it has none
+  bool Bind(const tflite::Model* model);
+  void Clear();
+
+  // Packed copy of the constant filter whose data is `weights` (a pointer
+  // into the same flatbuffer)
+  bool Find(const void* weights, PackedWeightsEntry* entry) const;
+
+  int count() const { return count_; }
+
+ private:
+  const tflite::Model* model_ = nullptr;
+  const uint8_t* payload_ = nullptr;
+  int count_ = 0;
+};
+
+#endif  // PACKED_WEIGHTS_H_
@@ -0,0 +1,225 @@
+/**
+ * @file reference_kernels.cpp
+ * @brief TFLite Micro reference Conv2D, FullyConnected and MaxPool2D
+ */
+
+#include "reference_kernels.h"
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/kernels/internal/reference/conv.h"
+#include "tensorflow/lite/kernels/internal/reference/fully_connected.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/conv.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/pooling.h"
+#include "tensorflow/lite/kernels/internal/reference/pooling.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/conv.h"
+#include "tensorflow/lite/micro/kernels/fully_connected.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/pooling.h"
+#include "tensorflow/lite/micro/micro_context.h"
+#include "tensorflow/lite/micro/micro_log.h"
+
+namespace {
+
+// Conv2D: the library's ConvInit/ConvPrepare (shared by every conv
+// kernel) compute the per-channel requantization this Eval consumes
+TfLiteStatus ConvEval(TfLiteContext* context, TfLiteNode* node) {
+  const auto& params = *static_cast<const TfLiteConvParams*>(node->builtin_data);
+  const auto& data = *static_cast<const tflite::OpDataConv*>(node->user_data);
+  const TfLiteEvalTensor* input =
+      tflite::micro::GetEvalInput(context, node, tflite::kConvInputTensor);
+  const TfLiteEvalTensor* filter =
+      tflite::micro::GetEvalInput(context, node, tflite::kConvWeightsTensor);
+  const TfLiteEvalTensor* bias =
+      tflite::NumInputs(node) == 3
+          ? tflite::micro::GetEvalInput(context, node, tflite::kConvBiasTensor)
+          : nullptr;
+  TfLiteEvalTensor* output =
+      tflite::micro::GetEvalOutput(context, node, tflite::kConvOutputTensor);
+
+  if (input->type == kTfLiteFloat32) {
+    tflite::reference_ops::Conv(
+        tflite::ConvParamsFloat(params, data),
+        tflite::micro::GetTensorShape(input), tflite::micro::GetTensorData<float>(input),
+        tflite::micro::GetTensorShape(filter), tflite::micro::GetTensorData<float>(filter),
+        tflite::micro::GetTensorShape(bias), tflite::micro::GetOptionalTensorData<float>(bias),
+        tflite::micro::GetTensorShape(output), tflite::micro::GetTensorData<float>(output),
+        tflite::RuntimeShape(), nullptr);
+    return kTfLiteOk;
+  }
+  if (input->type == kTfLiteInt8 && filter->type == kTfLiteInt8) {
+    tflite::reference_integer_ops::ConvPerChannel(
+        tflite::ConvParamsQuantized(params, data),
+        data.per_channel_output_multiplier, data.per_channel_output_shift,
+        tflite::micro::GetTensorShape(input), tflite::micro::GetTensorData<int8_t>(input),
+        tflite::micro::GetTensorShape(filter), tflite::micro::GetTensorData<int8_t>(filter),
+        tflite::micro::GetTensorShape(bias), tflite::micro::GetOptionalTensorData<int32_t>(bias),
+        tflite::micro::GetTensorShape(output), tflite::micro::GetTensorData<int8_t>(output));
+    return kTfLiteOk;
+  }
+  MicroPrintf("Reference CONV_2D: type %s not supported", TfLiteTypeGetName(input->type));
+  return kTfLiteError;
+}
+
+// FullyConnected: the library's Prepare is file-local, so this mirrors it
+// on top of the exported CalculateOpDataFullyConnected()
+void* FullyConnectedInit(TfLiteContext* context, const char* buffer, size_t length) {
+  return context->AllocatePersistentBuffer(context, sizeof(tflite::OpDataFullyConnected));
+}
+
+TfLiteStatus FullyConnectedPrepare(TfLiteContext* context, TfLiteNode* node) {
+  tflite::MicroContext* micro_context = tflite::GetMicroContext(context);
+  auto* data = static_cast<tflite::OpDataFullyConnected*>(node->user_data);
+  const auto* params = static_cast<const TfLiteFullyConnectedParams*>(node->builtin_data);
+
+  TfLiteTensor* input =
+      micro_context->AllocateTempInputTensor(node, tflite::kFullyConnectedInputTensor);
+  TF_LITE_ENSURE(context, input != nullptr);
+  TfLiteTensor* filter =
+      micro_context->AllocateTempInputTensor(node, tflite::kFullyConnectedWeightsTensor);
+  TF_LITE_ENSURE(context, filter != nullptr);
+  TfLiteTensor* bias =
+      micro_context->AllocateTempInputTensor(node, tflite::kFullyConnectedBiasTensor);
+  TfLiteTensor* output =
+      micro_context->AllocateTempOutputTensor(node, tflite::kFullyConnectedOutputTensor);
+  TF_LITE_ENSURE(context, output != nullptr);
+  TF_LITE_ENSURE_TYPES_EQ(context, input->type, output->type);
+  TF_LITE_ENSURE_TYPES_EQ(context, input->type, filter->type);
+  // Per-channel weights: CalculateOpDataFullyConnected() fills the
+  // multiplier/shift arrays when they are allocated up front
+  data->is_per_channel = false;
+  if (filter->quantization.type == kTfLiteAffineQuantization &&
+      filter->quantization.params != nullptr) {
+    const auto* quantization =
+        static_cast<const TfLiteAffineQuantization*>(filter->quantization.params);
+    TF_LITE_ENSURE(context, quantization->scale != nullptr);
+    const int channels = quantization->scale->size;
+    TF_LITE_ENSURE(context,
+                   channels == 1 ||
+                       channels == filter->dims->data[quantization->quantized_dimension]);
+    data->is_per_channel = channels > 1;
+    if (data->is_per_channel) {
+      data->per_channel_output_multiplier = static_cast<int32_t*>(
+          context->AllocatePersistentBuffer(context, channels * sizeof(int32_t)));
+      data->per_channel_output_shift = static_cast<int32_t*>(
+          context->AllocatePersistentBuffer(context, channels * sizeof(int32_t)));
+      TF_LITE_ENSURE(context, data->per_channel_output_multiplier != nullptr &&
+                                  data->per_channel_output_shift != nullptr);
+    }
+  }
+
+  TF_LITE_ENSURE_OK(context, tflite::CalculateOpDataFullyConnected(
+                                 context, params->activation, input->type, input,
+                                 filter, bias, output, data));
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(filter);
+  if (bias != nullptr) micro_context->DeallocateTempTfLiteTensor(bias);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  return kTfLiteOk;
+}
+
+TfLiteStatus FullyConnectedEval(TfLiteContext* context, TfLiteNode* node) {
+  const auto* params = static_cast<const TfLiteFullyConnectedParams*>(node->builtin_data);
+  const auto& data = *static_cast<const tflite::OpDataFullyConnected*>(node->user_data);
+  const TfLiteEvalTensor* input =
+      tflite::micro::GetEvalInput(context, node, tflite::kFullyConnectedInputTensor);
+  const TfLiteEvalTensor* filter =
+      tflite::micro::GetEvalInput(context, node, tflite::kFullyConnectedWeightsTensor);
+  const TfLiteEvalTensor* bias =
+      tflite::micro::GetEvalInput(context, node, tflite::kFullyConnectedBiasTensor);
+  TfLiteEvalTensor* output =
+      tflite::micro::GetEvalOutput(context, node, tflite::kFullyConnectedOutputTensor);
+
+  if (input->type == kTfLiteFloat32) {
+    tflite::reference_ops::FullyConnected(
+        tflite::FullyConnectedParamsFloat(params->activation),
+        tflite::micro::GetTensorShape(input), tflite::micro::GetTensorData<float>(input),
+        tflite::micro::GetTensorShape(filter), tflite::micro::GetTensorData<float>(filter),
+        tflite::micro::GetTensorShape(bias), tflite::micro::GetOptionalTensorData<float>(bias),
+        tflite::micro::GetTensorShape(output), tflite::micro::GetTensorData<float>(output));
+    return kTfLiteOk;
+  }
+  if (input->type == kTfLiteInt8 && data.is_per_channel) {
+    tflite::reference_integer_ops::FullyConnectedPerChannel(
+        tflite::FullyConnectedParamsQuantized(data), data.per_channel_output_multiplier,
+        reinterpret_cast<const int*>(data.per_channel_output_shift),
+        tflite::micro::GetTensorShape(input), tflite::micro::GetTensorData<int8_t>(input),
+        tflite::micro::GetTensorShape(filter), tflite::micro::GetTensorData<int8_t>(filter),
+        tflite::micro::GetTensorShape(bias), tflite::micro::GetOptionalTensorData<int32_t>(bias),
+        tflite::micro::GetTensorShape(output), tflite::micro::GetTensorData<int8_t>(output));
+    return kTfLiteOk;
+  }
+  if (input->type == kTfLiteInt8) {
+    tflite::reference_integer_ops::FullyConnected(
+        tflite::FullyConnectedParamsQuantized(data),
+        tflite::micro::GetTensorShape(input), tflite::micro::GetTensorData<int8_t>(input),
+        tflite::micro::GetTensorShape(filter), tflite::micro::GetTensorData<int8_t>(filter),
+        tflite::micro::GetTensorShape(bias), tflite::micro::GetOptionalTensorData<int32_t>(bias),
+        tflite::micro::GetTensorShape(output), tflite::micro::GetTensorData<int8_t>(output));
+    return kTfLiteOk;
+  }
+  MicroPrintf("Reference FULLY_CONNECTED: type %s not supported",
+              TfLiteTypeGetName(input->type));
+  return kTfLiteError;
+}
+
+// MaxPool2D: the library's PoolingPrepare fills padding and activation
+// limits into OpDataPooling
+void* PoolingInit(TfLiteContext* context, const char* buffer, size_t length) {
+  return context->AllocatePersistentBuffer(context, sizeof(tflite::OpDataPooling));
+}
+
+TfLiteStatus MaxPoolEval(TfLiteContext* context, TfLiteNode* node) {
+  const auto* params = static_cast<const TfLitePoolParams*>(node->builtin_data);
+  const auto* data = static_cast<const tflite::OpDataPooling*>(node->user_data);
+  const TfLiteEvalTensor* input =
+      tflite::micro::GetEvalInput(context, node, tflite::kPoolingInputTensor);
+  TfLiteEvalTensor* output =
+      tflite::micro::GetEvalOutput(context, node, tflite::kPoolingOutputTensor);
+
+  tflite::PoolParams op_params;
+  op_params.stride_height = params->stride_height;
+  op_params.stride_width = params->stride_width;
+  op_params.filter_height = params->filter_height;
+  op_params.filter_width = params->filter_width;
+  op_params.padding_values.height = data->padding.height;
+  op_params.padding_values.width = data->padding.width;
+
+  if (input->type == kTfLiteFloat32) {
+    op_params.float_activation_min = data->activation_min_f32;
+    op_params.float_activation_max = data->activation_max_f32;
+    tflite::reference_ops::MaxPool(
+        op_params, tflite::micro::GetTensorShape(input),
+        tflite::micro::GetTensorData<float>(input),
+        tflite::micro::GetTensorShape(output), tflite::micro::GetTensorData<float>(output));
+    return kTfLiteOk;
+  }
+  if (input->type == kTfLiteInt8) {
+    op_params.quantized_activation_min = data->activation_min;
+    op_params.quantized_activation_max = data->activation_max;
+    tflite::reference_integer_ops::MaxPool(
+        op_params, tflite::micro::GetTensorShape(input),
+        tflite::micro::GetTensorData<int8_t>(input),
+        tflite::micro::GetTensorShape(output), tflite::micro::GetTensorData<int8_t>(output));
+    return kTfLiteOk;
+  }
+  MicroPrintf("Reference MAX_POOL_2D: type %s not supported", TfLiteTypeGetName(input->type));
+  return kTfLiteError;
+}
+
+}  // namespace
+
+TFLMRegistration RegisterReferenceConv2D() {
+  return tflite::micro::RegisterOp(tflite::ConvInit, tflite::ConvPrepare, ConvEval);
+}
+
+TFLMRegistration RegisterReferenceFullyConnected() {
+  return tflite::micro::RegisterOp(FullyConnectedInit, FullyConnectedPrepare,
+                                   FullyConnectedEval);
+}
+
+TFLMRegistration RegisterReferenceMaxPool2D() {
+  return tflite::micro::RegisterOp(PoolingInit, tflite::PoolingPrepare, MaxPoolEval);
+}
@@ -0,0 +1,16 @@
+#ifndef REFERENCE_KERNELS_H_
+#define REFERENCE_KERNELS_H_
+
+#include "tensorflow/lite/micro/micro_common.h"
+
+// TFLite Micro's portable reference kernels, registered under the
+// library's own Init/Prepare so they can be selected in any build. In an
+// ESP-NN build Register_CONV_2D() and friends resolve to the optimized
+// kernels and the reference code is otherwise not linked; these keep it
+// available as the A/B baseline. float32 and int8 (per-channel conv,
+// per-tensor fully connected) only.
+TFLMRegistration RegisterReferenceConv2D();
+TFLMRegistration RegisterReferenceFullyConnected();
+TFLMRegistration RegisterReferenceMaxPool2D();
+
+#endif  // REFERENCE_KERNELS_H_
@@ -2,10 +2,20 @@
 #include <freertos/task.h>
 
 #include "main_functions.h"
+#include "tensorflow/lite/micro/micro_log.h"
 
 extern "C" void app_main(void) {
   setup();
+  while (!benchmark_complete()) {
+    loop();
+  }
+  // No exit status on target: one verdict line for whoever reads the log
+  if (benchmark_passed()) {
+    MicroPrintf("BENCHMARK PASSED");
+  } else {
+    MicroPrintf("BENCHMARK FAILED: a check failed or could not run, see above");
+  }
   while (true) {
     loop();
   }
-}
\ No newline at end of file
+}
@@ -1,297 +1,1266 @@
 /**
  * @file main_functions.cpp
- * @brief Core benchmarking logic with multi-model support
+ * @brief Core benchmarking logic, sweeping every registered model in one boot
  */
 
-#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
-#include "tensorflow/lite/micro/micro_interpreter.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+
 #include "tensorflow/lite/micro/system_setup.h"
-#include "tensorflow/lite/schema/schema_generated.h"
 
 #include "main_functions.h"
 #include "constants.h"
+#include "model_manager.h"
+#include "model_session.h"
+#include "arena_sizer.h"
+#include "arena_plan.h"
+#include "kernel_backends.h"
 #include "output_handler.h"
 #include "csv_logger.h"
+#include "running_stats.h"
+#include "latency_histogram.h"
+#include "op_profiler.h"
+#include "memory_tracker.h"
+#include "allocation_guard.h"
+#include "bench_timer.h"
+#include "double_buffer.h"
+#include "result_logger.h"
 
-#include "esp_timer.h"
-#include "esp_system.h"
-#include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
-
-#include "models/sine/model8.h"
-#include "models/sine/model32.h"
-#include "models/cnn/model8.h"
-#include "models/cnn/model32.h"
-#include "models/rnn/model8.h"
-#include "models/rnn/model32.h"
+#include "platform.h"
 
 namespace {
-// Tensor arena for model inference
+// Tensor arena for model inference, reused by every model in the sweep
 uint8_t tensor_arena[kTensorArenaSize];
+ModelSession session(tensor_arena, kTensorArenaSize);
+
+// CONCURRENT mode: second interpreter with its own arena, only sized when
+// the mode is compiled in
+constexpr int kSecondArenaSize =
+    (kBenchmarkMode == BenchmarkMode::CONCURRENT) ? kTensorArenaSize : 16;
+uint8_t second_tensor_arena[kSecondArenaSize];
+ModelSession second_session(second_tensor_arena, kSecondArenaSize);
+
+// CONCURRENT mode: model pairs run side by side, the first on core 0 and
+// the second on core 1
+const ModelType kConcurrentPairs[][2] = {
+  {ModelType::CNN_INT8, ModelType::RNN_INT8},
+  {ModelType::CNN_FLOAT32, ModelType::RNN_FLOAT32},
+  {ModelType::CNN_INT8, ModelType::SINE_INT8},
+};
+
+// Sweep progress
+int current_model_index = 0;
+bool sweep_done = false;
+
+// Per-model results, printed again as a table at the end of the sweep
+struct ModelResult {
+  bool completed;
+  float avg_latency_us;
+  uint32_t avg_latency_ticks;
+  float min_latency_us;
+  float max_latency_us;
+  float stddev_us;
+  LatencyPercentiles percentiles;
+  size_t arena_bytes;
+  size_t memory_used;
+  int64_t inferences;
+  float throughput_ips;  // THROUGHPUT mode only
+};
+ModelResult results[kModelTypeCount];
+
+// Heap, fragmentation and stack snapshots per lifecycle phase
+MemoryTracker memory_tracker;
 
-// Memory tracking
-size_t heap_before_init = 0;
-size_t heap_after_init = 0;
-size_t min_free_heap = 0;
+// Memory planner recording the arena layout, when kDumpArenaPlan is set
+ArenaPlan arena_plan;
 
-// Statistics
-constexpr int kMaxLatencyHistory = 100;
-int64_t latencies[kMaxLatencyHistory];
-int latency_index = 0;
+// Heap allocations inside timed Invoke() regions, when
+// kCheckInvokeAllocations is set; models that allocated, and models the
+// platform could not check, are counted
+AllocationGuard allocation_guard(kCheckInvokeAllocations);
+int allocation_failures = 0;
+int allocation_unchecked = 0;
+
+// Statistics: all measured inferences plus a sliding window for the
+// periodic "last N" report. Neither contains warmup samples.
+constexpr int kStatsWindowSize = 100;
+RunningStats latency_stats;
+WindowedStats<kStatsWindowSize> window_stats;
+LatencyHistogram<> latency_histogram;  // Tail latency, fixed ~700 bytes
+LatencyHistogram<> response_histogram;  // FIXED_RATE release-to-completion
+
+// LATENCY mode progress reports, printed by a low-priority task when
+// kDeferredLogging is set. ESP-IDF heap tracing watches every task, so
+// with kCheckInvokeAllocations a logger task printing on the other core
+// would be charged to the watched Invoke(); reports are then printed
+// synchronously, between the watched regions.
+constexpr bool kLogFromTask = kDeferredLogging && !kCheckInvokeAllocations;
+ResultLogger<kResultRingCapacity> result_logger;
+
+// Per-op timing, only attached when kEnableOpProfiling is set
+OpProfiler op_profiler;
+int64_t warmup_inferences = 0;
 bool warmup_done = false;
 
-// Benchmarking variables
-int64_t total_inferences = 0;
-int64_t total_latency_us = 0;
-int64_t min_latency_us = INT64_MAX;
-int64_t max_latency_us = 0;
-
-// TFLite Micro objects
-const tflite::Model* model = nullptr;
-tflite::MicroInterpreter* interpreter = nullptr;
-TfLiteTensor* input = nullptr;
-TfLiteTensor* output = nullptr;
-
-// Model-specific variables
-const char* current_model_name = "";
-const char* current_quantization = "";
-float x_val = 0.0f;  // For sine model
-
-// Model configuration
-const unsigned char* model_data = nullptr;
-int model_data_len = 0;
+// PIPELINE mode: inputs handed from the producer task to the Invoke() loop
+DoubleBuffer<kPipelineMaxInputBytes> input_buffers;
+struct PipelineProducer {
+  int64_t items;
+  uint64_t wait_ticks;     // Time spent waiting for a free buffer
+  std::atomic<bool> stop;  // Set by the consumer to abandon the run
+  std::atomic<bool> done;  // Set by the producer as its last action
+};
+PipelineProducer pipeline_producer;
+
+// CONCURRENT mode: one benchmark task per core
+struct ConcurrentWorker {
+  ModelSession* session;
+  int core;
+  RunningStats stats;
+  LatencyHistogram<> histogram;
+  bool failed;
+  std::atomic<bool> measured;  // kInferencesPerTest samples recorded
+  std::atomic<bool> finished;  // Task is about to return
+};
+ConcurrentWorker concurrent_workers[2];
+std::atomic<bool> concurrent_go;    // Released together so runs overlap
+std::atomic<bool> concurrent_stop;  // End background load after measuring
+
+// KERNEL_AB mode: outputs of the tflm run for the check samples, and
+// per-node times of every backend, for the model being compared
+float kernel_check_outputs[kKernelCheckSamples][kKernelCheckMaxOutputs];
+double kernel_node_us[kKernelBackendCount][OpProfiler::kMaxOps];
+const char* kernel_node_ops[OpProfiler::kMaxOps];
+int kernel_node_count = 0;
+struct KernelRun {
+  bool ok;
+  int kernels;  // Operator codes of the model with a kernel in the backend
+  int64_t inferences;
+  double avg_us;
+  float max_abs_delta;
+  float mean_abs_delta;
+};
+KernelRun kernel_runs[kKernelBackendCount];
+
+// AOT mode: output of the ahead-of-time compiled model
+alignas(16) uint8_t aot_output[kAotMaxOutputBytes];
 }
 
-// Calculate standard deviation
-float calculate_stddev(int64_t* values, int count, int64_t mean) {
-  if (count <= 1) return 0.0f;
-  
-  int64_t sum_squared_diff = 0;
+void reset_statistics() {
+  latency_stats.Reset();
+  window_stats.Reset();
+  latency_histogram.Reset();
+  allocation_guard.Reset();
+  warmup_inferences = 0;
+  warmup_done = false;
+}
+
+// Streaming vs full-sequence LSTM. For a classifier fed one new sample at
+// a time, the full-sequence model has to re-run the whole window per
+// sample while the streaming model advances a single timestep.
+void report_streaming_comparison() {
+  const ModelResult& full = results[static_cast<int>(ModelType::RNN_FLOAT32)];
+  const ModelResult& stream = results[static_cast<int>(ModelType::RNN_STREAM_FLOAT32)];
+  if (!full.completed || !stream.completed) {
+    return;
+  }
+  MicroPrintf("=== RNN streaming vs full sequence (float32) ===");
+  MicroPrintf("Full sequence: %.2f us per Invoke, %d timesteps (%.2f us per timestep)",
+              full.avg_latency_us, kRNNSequenceLength,
+              full.avg_latency_us / kRNNSequenceLength);
+  MicroPrintf("Streaming:     %.2f us per Invoke, 1 timestep", stream.avg_latency_us);
+  if (stream.avg_latency_us > 0.0f) {
+    MicroPrintf("Per new sample: streaming is %.2fx faster than re-running the window",
+                full.avg_latency_us / stream.avg_latency_us);
+  }
+  CSVLogger::PrintStreamingHeader();
+  CSVLogger::LogStreaming("float32", kRNNSequenceLength,
+                          full.avg_latency_us, stream.avg_latency_us,
+                          full.percentiles.p99, stream.percentiles.p99);
+}
+
+// Unfused CNN against the same graph with CONV_2D + MAX_POOL_2D fused
+// into CONV_RELU_POOL, per quantization both ran in this sweep
+void report_fusion_comparison() {
+  const struct {
+    ModelType unfused;
+    ModelType fused;
+    const char* quantization;
+  } pairs[] = {
+    {ModelType::CNN_FLOAT32, ModelType::CNN_FUSED_FLOAT32, "float32"},
+    {ModelType::CNN_INT8, ModelType::CNN_FUSED_INT8, "int8"},
+  };
+  bool header_printed = false;
+  for (const auto& pair : pairs) {
+    const ModelResult& unfused = results[static_cast<int>(pair.unfused)];
+    const ModelResult& fused = results[static_cast<int>(pair.fused)];
+    if (!unfused.completed || !fused.completed) {
+      continue;
+    }
+    if (!header_printed) {
+      MicroPrintf("=== CNN conv+relu+pool fusion ===");
+      CSVLogger::PrintFusionHeader();
+      header_printed = true;
+    }
+    MicroPrintf("%s: unfused %.2f us, %u arena bytes; fused %.2f us, %u arena bytes",
+                pair.quantization, unfused.avg_latency_us, (unsigned)unfused.arena_bytes,
+                fused.avg_latency_us, (unsigned)fused.arena_bytes);
+    CSVLogger::LogFusion(pair.quantization, unfused.avg_latency_us, fused.avg_latency_us,
+                         unfused.percentiles.p99, fused.percentiles.p99,
+                         unfused.arena_bytes, fused.arena_bytes);
+  }
+}
+
+// Build the interpreter for the next model in the registry. Models that
+// fail to load are recorded as skipped and the sweep moves on.
+void start_next_model() {
+  while (current_model_index < kModelTypeCount) {
+    ModelType type = ModelManager::GetModelType(current_model_index);
+    results[current_model_index] = {};
+    reset_statistics();
+
+    MicroPrintf("=== Model %d/%d ===", current_model_index + 1, kModelTypeCount);
+    memory_tracker.Reset();
+    memory_tracker.Snapshot(MemoryPhase::MODEL_START);
+    if (session.Begin(type, kEnableOpProfiling ? &op_profiler : nullptr,
+                      &memory_tracker, kDumpArenaPlan ? &arena_plan : nullptr)) {
+      const MemorySnapshot& before = memory_tracker.Get(MemoryPhase::MODEL_START);
+      const MemorySnapshot& after = memory_tracker.Get(MemoryPhase::TENSORS_ALLOCATED);
+      size_t memory_used =
+          memory_tracker.HeapUsed(MemoryPhase::MODEL_START, MemoryPhase::TENSORS_ALLOCATED);
+      results[current_model_index].memory_used = memory_used;
+
+      MicroPrintf("Memory Analysis:");
+      MicroPrintf("  Heap before init: %zu bytes", before.free_heap);
+      MicroPrintf("  Heap after init: %zu bytes", after.free_heap);
+      MicroPrintf("  Memory used by model: %zu bytes", memory_used);
+      MicroPrintf("  Arena used: %zu bytes", session.interpreter()->arena_used_bytes());
+      MicroPrintf("  Min free heap ever: %zu bytes", after.min_free_heap);
+      MicroPrintf("  Largest free block: %zu bytes", after.largest_free_block);
+      if (kDumpArenaPlan) {
+        arena_plan.Print(session.config());
+      }
+      MicroPrintf("Starting benchmark...");
+      return;
+    }
+
+    const ModelConfig& config = ModelManager::GetModelConfig(type);
+    MicroPrintf("Skipping %s (%s): setup failed", config.name, config.quantization);
+    current_model_index++;
+  }
+
+  // Every model has been run, print the whole matrix once
+  MicroPrintf("=== Sweep complete ===");
+  for (int i = 0; i < kModelTypeCount; i++) {
+    const ModelConfig& config = ModelManager::GetModelConfig(ModelManager::GetModelType(i));
+    const ModelResult& result = results[i];
+    OutputHandler::PrintModelSummary(
+        config.name, config.quantization, result.completed,
+        result.avg_latency_us, result.min_latency_us, result.max_latency_us,
+        result.stddev_us, result.percentiles, result.arena_bytes,
+        result.throughput_ips, config.batch_size);
+    CSVLogger::LogModelSummary(
+        i, config.name, config.quantization, result.completed,
+        result.avg_latency_us, result.avg_latency_ticks,
+        result.min_latency_us, result.max_latency_us,
+        result.stddev_us, result.percentiles, result.arena_bytes, result.memory_used,
+        result.inferences, result.throughput_ips, config.batch_size);
+  }
+  report_streaming_comparison();
+  report_fusion_comparison();
+  if (allocation_guard.enabled()) {
+    if (allocation_failures > 0) {
+      MicroPrintf("Allocation check FAILED: %d model(s) allocated in timed Invoke()",
+                  allocation_failures);
+    } else if (allocation_unchecked > 0) {
+      MicroPrintf("Allocation check UNSUPPORTED: %d model(s) not checked",
+                  allocation_unchecked);
+    } else {
+      MicroPrintf("Allocation check passed for every model");
+    }
+  }
+  sweep_done = true;
+}
+
+// Record the finished model's statistics and release the interpreter
+void finish_current_model() {
+  result_logger.Flush();
+  CSVLogger::Flush();
+  ModelResult& result = results[current_model_index];
+  result.completed = true;
+  result.avg_latency_us = (float)latency_stats.mean();
+  result.avg_latency_ticks = (uint32_t)(latency_stats.mean() * BenchTimer::ticks_per_us());
+  result.min_latency_us = (float)latency_stats.min();
+  result.max_latency_us = (float)latency_stats.max();
+  result.stddev_us = (float)latency_stats.stddev();
+  result.percentiles = latency_histogram.Percentiles();
+  result.arena_bytes = session.interpreter()->arena_used_bytes();
+  result.inferences = latency_stats.count();
+
+  memory_tracker.Snapshot(MemoryPhase::STEADY_STATE);
+  const ModelConfig& config = session.config();
+  memory_tracker.Print();
+  memory_tracker.PrintCsv(config.name, config.quantization);
+
+  if (kEnableOpProfiling) {
+    op_profiler.PrintCsv(config.name, config.quantization);
+  }
+  allocation_guard.Report(config.name, config.quantization);
+  switch (allocation_guard.verdict()) {
+    case AllocationGuard::Verdict::DIRTY: allocation_failures++; break;
+    case AllocationGuard::Verdict::UNSUPPORTED: allocation_unchecked++; break;
+    default: break;
+  }
+
+  session.End();
+  current_model_index++;
+}
+
+// Drop a model whose Invoke() failed and move on
+void skip_current_model() {
+  result_logger.Flush();
+  CSVLogger::Flush();
+  const ModelConfig& config = session.config();
+  MicroPrintf("Invoke failed! Skipping %s (%s)", config.name, config.quantization);
+  session.End();
+  current_model_index++;
+}
+
+// Closed-loop throughput run for the current model: back-to-back Invoke()
+// calls for kThroughputDurationMs or kInferencesPerTest inferences. Only
+// the statistics updates sit inside the loop; logging happens afterwards.
+// Wall time includes PrepareInput(), i.e. what a caller feeding the model
+// continuously would see.
+void run_throughput_test() {
+  const ModelConfig& config = session.config();
+  MicroPrintf("Throughput run: %s (%s)", config.name, config.quantization);
+
+  for (int i = 0; i < kWarmupInferences; i++) {
+    session.PrepareInput();
+    if (session.Invoke() != kTfLiteOk) {
+      skip_current_model();
+      return;
+    }
+    if (i == 0) memory_tracker.Snapshot(MemoryPhase::FIRST_INVOKE);
+  }
+  op_profiler.Reset();
+  allocation_guard.Reset();
+
+  // Run time is accumulated per iteration so the 32-bit cycle counter may
+  // wrap during long runs. Every second of run time the task sleeps
+  // briefly, outside the measured time, so the idle task can feed the
+  // task watchdog.
+  const double ticks_per_us = BenchTimer::ticks_per_us();
+  const uint64_t duration_ticks = (uint64_t)(kThroughputDurationMs * 1000.0 * ticks_per_us);
+  const uint64_t yield_interval_ticks = (uint64_t)(1000000.0 * ticks_per_us);
+  uint64_t run_ticks = 0;
+  uint64_t next_yield_ticks = yield_interval_ticks;
+  BenchTimer::Ticks previous = BenchTimer::Now();
+  while (true) {
+    session.PrepareInput();
+    allocation_guard.Begin();
+    BenchTimer::Ticks start_ticks = BenchTimer::Now();
+    TfLiteStatus invoke_status = session.Invoke();
+    BenchTimer::Ticks end_ticks = BenchTimer::Now();
+    allocation_guard.End();
+    if (invoke_status != kTfLiteOk) {
+      skip_current_model();
+      return;
+    }
+
+    double latency_us = BenchTimer::ToMicros(BenchTimer::Elapsed(start_ticks, end_ticks));
+    latency_stats.Add(latency_us);
+    latency_histogram.RecordUs(latency_us);
+    run_ticks += (BenchTimer::Ticks)(end_ticks - previous);
+    previous = end_ticks;
+
+    if (kThroughputDurationMs > 0 ? run_ticks >= duration_ticks
+                                  : latency_stats.count() >= kInferencesPerTest) {
+      break;
+    }
+    if (run_ticks >= next_yield_ticks) {
+      Platform::DelayMs(10);
+      next_yield_ticks += yield_interval_ticks;
+      previous = BenchTimer::Now();
+    }
+  }
+
+  double run_us = (double)run_ticks / ticks_per_us;
+  float throughput_ips = (float)(latency_stats.count() * 1000000.0 / run_us);
+  MicroPrintf("  %lld inferences in %.1f ms: %.2f inferences/s",
+              latency_stats.count(), run_us / 1000.0, throughput_ips);
+  MicroPrintf("  Latency under load: avg=%.2f us, min=%.2f us, max=%.2f us, stddev=%.2f us",
+              latency_stats.mean(), latency_stats.min(), latency_stats.max(),
+              latency_stats.stddev());
+  OutputHandler::PrintBenchmarkResult(config.name, (float)latency_stats.mean(),
+                                      latency_histogram.Percentiles(),
+                                      session.interpreter()->arena_used_bytes());
+
+  int model_index = current_model_index;
+  finish_current_model();
+  results[model_index].throughput_ips = throughput_ips;
+}
+
+// Open-loop fixed-rate run for the current model. For every rate in
+// kFixedRatesHz, kInferencesPerTest jobs are released at fixed instants
+// independent of when earlier jobs finish, as a sensor interrupt would.
+// Response time runs from release to completion, so it includes queueing
+// behind a late predecessor. A job misses its deadline when it completes
+// after the next release; it overruns when Invoke() alone takes longer than
+// the period. Jobs that wait behind kFixedRateMaxBacklog others are dropped
+// (and counted as missed), like samples lost to a full sensor FIFO.
+void run_fixed_rate_test() {
+  const ModelConfig& config = session.config();
+
+  for (int i = 0; i < kWarmupInferences; i++) {
+    session.PrepareInput();
+    if (session.Invoke() != kTfLiteOk) {
+      skip_current_model();
+      return;
+    }
+    if (i == 0) memory_tracker.Snapshot(MemoryPhase::FIRST_INVOKE);
+  }
+  op_profiler.Reset();
+  allocation_guard.Reset();
+
+  const double ticks_per_us = BenchTimer::ticks_per_us();
+  double max_service_us = 0.0;
+  for (int rate_hz : kFixedRatesHz) {
+    const uint64_t period_ticks = (uint64_t)(1000000.0 * ticks_per_us / rate_hz);
+    const uint64_t max_lateness_ticks = period_ticks * kFixedRateMaxBacklog;
+    RunningStats response_stats;
+    RunningStats service_stats;
+    response_histogram.Reset();
+    int64_t completed = 0, dropped = 0, missed = 0, overruns = 0;
+
+    // Waiting for a release is a busy-wait on the timer: sleeping would be
+    // bound to the RTOS tick, which is coarser than a 1 kHz period. Every
+    // second of releases the task sleeps briefly between jobs so the idle
+    // task can feed the task watchdog; releases restart one period after
+    // it wakes, so the pause is never charged to a job.
+    const uint64_t yield_interval_ticks = (uint64_t)(1000000.0 * ticks_per_us);
+    BenchClock clock;
+    uint64_t release = clock.Read() + period_ticks;
+    uint64_t next_yield = release + yield_interval_ticks;
+    for (int64_t job = 0; job < kInferencesPerTest; job++, release += period_ticks) {
+      if (release >= next_yield) {
+        Platform::DelayMs(10);
+        release = clock.Read() + period_ticks;
+        next_yield = release + yield_interval_ticks;
+      }
+      uint64_t now = clock.Read();
+      while (now < release) {
+        now = clock.Read();
+      }
+      if (now - release > max_lateness_ticks) {
+        dropped++;
+        missed++;
+        continue;
+      }
+
+      session.PrepareInput();
+      allocation_guard.Begin();
+      const uint64_t service_start = clock.Read();
+      TfLiteStatus invoke_status = session.Invoke();
+      const uint64_t completion = clock.Read();
+      allocation_guard.End();
+      if (invoke_status != kTfLiteOk) {
+        skip_current_model();
+        return;
+      }
+
+      const uint64_t service_ticks = completion - service_start;
+      const uint64_t response_ticks = completion - release;
+      completed++;
+      if (response_ticks > period_ticks) missed++;
+      if (service_ticks > period_ticks) overruns++;
+
+      double service_us = service_ticks / ticks_per_us;
+      double response_us = response_ticks / ticks_per_us;
+      service_stats.Add(service_us);
+      latency_stats.Add(service_us);
+      latency_histogram.RecordUs(service_us);
+      response_stats.Add(response_us);
+      response_histogram.RecordUs(response_us);
+    }
+
+    LatencyPercentiles response_percentiles = response_histogram.Percentiles();
+    MicroPrintf("%s (%s) @ %d Hz: %lld completed, %lld missed (%lld dropped), %lld overruns -> %s",
+                config.name, config.quantization, rate_hz, (long long)completed,
+                (long long)missed, (long long)dropped, (long long)overruns,
+                missed == 0 ? "sustainable" : "NOT sustainable");
+    MicroPrintf("  Response: avg=%.2f us, p99=%.1f us, max=%.2f us; service: avg=%.2f us, max=%.2f us",
+                response_stats.mean(), response_percentiles.p99,
+                response_stats.max(), service_stats.mean(), service_stats.max());
+    CSVLogger::LogRate(config.name, config.quantization, rate_hz,
+                       kInferencesPerTest, completed, dropped, missed, overruns,
+                       (float)response_stats.mean(), response_percentiles.p99,
+                       (float)response_stats.max(), (float)service_stats.mean(),
+                       (float)service_stats.max());
+    if (service_stats.max() > max_service_us) max_service_us = service_stats.max();
+    Platform::DelayMs(10);
+  }
+
+  // Upper bound on the rate: a job must fit in its period even at worst case
+  if (max_service_us > 0.0) {
+    MicroPrintf("  Max sustainable rate (1 / worst service time): %.0f Hz",
+                1000000.0 / max_service_us);
+  }
+
+  // The summary line reports service (Invoke) time across all rates
+  finish_current_model();
+}
+
+// Stand-in for sensor preprocessing (filtering, feature extraction)
+void simulate_preprocessing() {
+  if (kPipelinePreprocessUs <= 0) return;
+  const double target_ticks = kPipelinePreprocessUs * BenchTimer::ticks_per_us();
+  BenchTimer::Ticks start = BenchTimer::Now();
+  while ((double)(BenchTimer::Ticks)(BenchTimer::Now() - start) < target_ticks) {
+  }
+}
+
+// PIPELINE producer, runs on kPipelineProducerCore
+void pipeline_producer_task(void* arg) {
+  PipelineProducer* producer = static_cast<PipelineProducer*>(arg);
+  BenchClock clock;
+  for (int64_t i = 0; i < producer->items; i++) {
+    uint8_t* slot;
+    uint64_t wait_start = clock.Read();
+    while ((slot = input_buffers.TryAcquireWrite()) == nullptr) {
+      if (producer->stop.load(std::memory_order_relaxed)) {
+        producer->done.store(true, std::memory_order_release);
+        return;
+      }
+    }
+    producer->wait_ticks += clock.Read() - wait_start;
+    session.GenerateInput(slot);
+    simulate_preprocessing();
+    input_buffers.CommitWrite();
+  }
+  producer->done.store(true, std::memory_order_release);
+}
+
+// Two-stage pipeline for the current model. The same workload (generate +
+// preprocess + copy into the input tensor + Invoke) first runs serially on
+// this task as the baseline, then with generation and preprocessing moved
+// to a producer task on the other core, handing inputs over through a
+// lock-free double buffer. The copy into the input tensor stays on the
+// consumer: kernels read the arena tensor, not the staging buffer.
+void run_pipeline_test() {
+  const ModelConfig& config = session.config();
+  TfLiteTensor* input = session.input();
+  const size_t input_bytes = input->bytes;
+  if (Platform::GetCoreCount() < 2 || input_bytes > input_buffers.capacity()) {
+    MicroPrintf("Skipping %s (%s): pipeline needs 2 cores and inputs <= %d bytes",
+                config.name, config.quantization, kPipelineMaxInputBytes);
+    session.End();
+    current_model_index++;
+    return;
+  }
+
+  for (int i = 0; i < kWarmupInferences; i++) {
+    session.PrepareInput();
+    if (session.Invoke() != kTfLiteOk) {
+      skip_current_model();
+      return;
+    }
+    if (i == 0) memory_tracker.Snapshot(MemoryPhase::FIRST_INVOKE);
+  }
+  op_profiler.Reset();
+  allocation_guard.Reset();
+
+  const double ticks_per_us = BenchTimer::ticks_per_us();
+  BenchClock clock;
+
+  // Serial baseline, staging through a buffer like the pipeline does
+  input_buffers.Reset();
+  uint8_t* staging = input_buffers.TryAcquireWrite();
+  uint64_t run_start = clock.Read();
+  for (int i = 0; i < kInferencesPerTest; i++) {
+    session.GenerateInput(staging);
+    simulate_preprocessing();
+    memcpy(input->data.raw, staging, input_bytes);
+    session.ResetState();
+    allocation_guard.Begin();
+    TfLiteStatus invoke_status = session.Invoke();
+    allocation_guard.End();
+    if (invoke_status != kTfLiteOk) {
+      skip_current_model();
+      return;
+    }
+  }
+  const uint64_t serial_ticks = clock.Read() - run_start;
+
+  // Pipelined run
+  input_buffers.Reset();
+  pipeline_producer.items = kInferencesPerTest;
+  pipeline_producer.wait_ticks = 0;
+  pipeline_producer.stop.store(false, std::memory_order_relaxed);
+  pipeline_producer.done.store(false, std::memory_order_relaxed);
+  if (!Platform::StartTask("input_producer", pipeline_producer_task,
+                           &pipeline_producer, kPipelineProducerCore)) {
+    MicroPrintf("Skipping %s (%s): could not start producer task",
+                config.name, config.quantization);
+    session.End();
+    current_model_index++;
+    return;
+  }
+
+  uint64_t consumer_wait_ticks = 0;
+  bool invoke_failed = false;
+  run_start = clock.Read();
+  for (int i = 0; i < kInferencesPerTest; i++) {
+    const uint8_t* slot;
+    uint64_t wait_start = clock.Read();
+    while ((slot = input_buffers.TryAcquireRead()) == nullptr) {
+    }
+    consumer_wait_ticks += clock.Read() - wait_start;
+    memcpy(input->data.raw, slot, input_bytes);
+    input_buffers.ReleaseRead();
+    session.ResetState();
+
+    allocation_guard.Begin();
+    BenchTimer::Ticks start_ticks = BenchTimer::Now();
+    TfLiteStatus invoke_status = session.Invoke();
+    BenchTimer::Ticks end_ticks = BenchTimer::Now();
+    allocation_guard.End();
+    if (invoke_status != kTfLiteOk) {
+      invoke_failed = true;
+      break;
+    }
+    double latency_us = BenchTimer::ToMicros(BenchTimer::Elapsed(start_ticks, end_ticks));
+    latency_stats.Add(latency_us);
+    latency_histogram.RecordUs(latency_us);
+  }
+  const uint64_t pipelined_ticks = clock.Read() - run_start;
+
+  // The producer uses the session; it must be finished before End()
+  pipeline_producer.stop.store(true, std::memory_order_relaxed);
+  while (!pipeline_producer.done.load(std::memory_order_acquire)) {
+  }
+  if (invoke_failed) {
+    skip_current_model();
+    return;
+  }
+
+  float serial_ips = (float)(kInferencesPerTest * 1000000.0 * ticks_per_us / serial_ticks);
+  float pipelined_ips = (float)(kInferencesPerTest * 1000000.0 * ticks_per_us / pipelined_ticks);
+  float consumer_wait_us = (float)(consumer_wait_ticks / ticks_per_us);
+  float producer_wait_us = (float)(pipeline_producer.wait_ticks / ticks_per_us);
+  MicroPrintf("%s (%s) pipeline: serial %.2f inferences/s, pipelined %.2f inferences/s (x%.2f)",
+              config.name, config.quantization, serial_ips, pipelined_ips,
+              pipelined_ips / serial_ips);
+  MicroPrintf("  Invoke() loop waited %.1f us for inputs, producer waited %.1f us for buffers",
+              consumer_wait_us, producer_wait_us);
+  CSVLogger::LogPipeline(config.name, config.quantization, kInferencesPerTest,
+                         kPipelinePreprocessUs, serial_ips, pipelined_ips,
+                         consumer_wait_us, producer_wait_us);
+
+  int model_index = current_model_index;
+  finish_current_model();
+  results[model_index].throughput_ips = pipelined_ips;
+}
+
+// CONCURRENT worker: kInferencesPerTest timed inferences, then keep the
+// model running untimed until concurrent_stop so the other core's
+// measurement sees contention for its whole duration
+void concurrent_worker_task(void* arg) {
+  ConcurrentWorker* worker = static_cast<ConcurrentWorker*>(arg);
+  while (!concurrent_go.load(std::memory_order_acquire)) {
+  }
+  for (int i = 0; i < kInferencesPerTest; i++) {
+    worker->session->PrepareInput();
+    BenchTimer::Ticks start_ticks = BenchTimer::Now();
+    TfLiteStatus invoke_status = worker->session->Invoke();
+    BenchTimer::Ticks end_ticks = BenchTimer::Now();
+    if (invoke_status != kTfLiteOk) {
+      worker->failed = true;
+      break;
+    }
+    double latency_us = BenchTimer::ToMicros(BenchTimer::Elapsed(start_ticks, end_ticks));
+    worker->stats.Add(latency_us);
+    worker->histogram.RecordUs(latency_us);
+  }
+  worker->measured.store(true, std::memory_order_release);
+  while (!worker->failed && !concurrent_stop.load(std::memory_order_acquire)) {
+    worker->session->PrepareInput();
+    worker->session->Invoke();
+  }
+  worker->finished.store(true, std::memory_order_release);
+}
+
+// Run the given workers at once; the main task sleeps while they measure
+bool run_concurrent_workers(ConcurrentWorker* workers[], int count) {
+  concurrent_go.store(false, std::memory_order_relaxed);
+  concurrent_stop.store(false, std::memory_order_relaxed);
   for (int i = 0; i < count; i++) {
-    int64_t diff = values[i] - mean;
-    sum_squared_diff += diff * diff;
+    ConcurrentWorker* worker = workers[i];
+    worker->stats.Reset();
+    worker->histogram.Reset();
+    worker->failed = false;
+    worker->measured.store(false, std::memory_order_relaxed);
+    worker->finished.store(false, std::memory_order_relaxed);
+    if (!Platform::StartTask("bench_worker", concurrent_worker_task, worker, worker->core)) {
+      MicroPrintf("Could not start worker task on core %d", worker->core);
+      concurrent_stop.store(true, std::memory_order_release);
+      concurrent_go.store(true, std::memory_order_release);
+      for (int j = 0; j < i; j++) {
+        while (!workers[j]->finished.load(std::memory_order_acquire)) {
+          Platform::DelayMs(10);
+        }
+      }
+      return false;
+    }
   }
-  
-  return sqrt((float)sum_squared_diff / (count - 1));
+  concurrent_go.store(true, std::memory_order_release);
+
+  for (int i = 0; i < count; i++) {
+    while (!workers[i]->measured.load(std::memory_order_acquire)) {
+      Platform::DelayMs(10);
+    }
+  }
+  concurrent_stop.store(true, std::memory_order_release);
+  bool ok = true;
+  for (int i = 0; i < count; i++) {
+    while (!workers[i]->finished.load(std::memory_order_acquire)) {
+      Platform::DelayMs(10);
+    }
+    ok = ok && !workers[i]->failed;
+  }
+  return ok;
+}
+
+// For each pair in kConcurrentPairs, measure both models alone on their
+// core, then side by side with their own interpreter and arena, and report
+// the latency degradation caused by shared flash cache and bus contention
+void run_concurrent_tests() {
+  if (Platform::GetCoreCount() < 2) {
+    MicroPrintf("CONCURRENT mode needs 2 cores, %d available", Platform::GetCoreCount());
+    return;
+  }
+  CSVLogger::PrintConcurrentHeader();
+
+  ModelSession* sessions[2] = {&session, &second_session};
+  const int pair_count = sizeof(kConcurrentPairs) / sizeof(kConcurrentPairs[0]);
+  for (int pair = 0; pair < pair_count; pair++) {
+    MicroPrintf("=== Concurrent pair %d/%d ===", pair + 1, pair_count);
+    bool ready = true;
+    for (int i = 0; i < 2 && ready; i++) {
+      ready = sessions[i]->Begin(kConcurrentPairs[pair][i]);
+    }
+    if (!ready) {
+      MicroPrintf("Skipping pair %d: setup failed", pair + 1);
+      session.End();
+      second_session.End();
+      continue;
+    }
+
+    // Warmup both interpreters before anything is timed
+    for (int i = 0; i < 2 && ready; i++) {
+      for (int w = 0; w < kWarmupInferences && ready; w++) {
+        sessions[i]->PrepareInput();
+        ready = (sessions[i]->Invoke() == kTfLiteOk);
+      }
+    }
+
+    float solo_avg_us[2] = {};
+    float solo_p99_us[2] = {};
+    for (int i = 0; i < 2 && ready; i++) {
+      ConcurrentWorker& worker = concurrent_workers[i];
+      worker.session = sessions[i];
+      worker.core = i;
+      ConcurrentWorker* solo[1] = {&worker};
+      ready = run_concurrent_workers(solo, 1);
+      solo_avg_us[i] = (float)worker.stats.mean();
+      solo_p99_us[i] = worker.histogram.Percentiles().p99;
+    }
+
+    ConcurrentWorker* both[2] = {&concurrent_workers[0], &concurrent_workers[1]};
+    if (ready) {
+      ready = run_concurrent_workers(both, 2);
+    }
+    if (!ready) {
+      MicroPrintf("Skipping pair %d: Invoke failed", pair + 1);
+    } else {
+      for (int i = 0; i < 2; i++) {
+        const ModelConfig& config = sessions[i]->config();
+        const ConcurrentWorker& worker = concurrent_workers[i];
+        float concurrent_avg_us = (float)worker.stats.mean();
+        MicroPrintf("%s (%s) on core %d: solo avg=%.2f us, concurrent avg=%.2f us (%+.1f%%), p99 %.1f -> %.1f us",
+                    config.name, config.quantization, worker.core, solo_avg_us[i],
+                    concurrent_avg_us, 100.0f * (concurrent_avg_us - solo_avg_us[i]) / solo_avg_us[i],
+                    solo_p99_us[i], worker.histogram.Percentiles().p99);
+        CSVLogger::LogConcurrent(pair + 1, config.name, config.quantization, worker.core,
+                                 worker.stats.count(), solo_avg_us[i], concurrent_avg_us,
+                                 solo_p99_us[i], worker.histogram.Percentiles().p99);
+      }
+    }
+    session.End();
+    second_session.End();
+  }
+  MicroPrintf("=== Concurrent runs complete ===");
+}
+
+// Up to max_values output elements as real values (int8 dequantized)
+int read_output_values(const TfLiteTensor* output, float* values, int max_values) {
+  const bool is_int8 = (output->type == kTfLiteInt8);
+  int count = (int)(output->bytes / (is_int8 ? 1 : sizeof(float)));
+  if (count > max_values) count = max_values;
+  for (int i = 0; i < count; i++) {
+    values[i] = is_int8
+        ? (output->data.int8[i] - output->params.zero_point) * output->params.scale
+        : output->data.f[i];
+  }
+  return count;
+}
+
+// One model under the current kernel selection: the check samples first,
+// stored for tflm and compared against it otherwise, then warmup and
+// kInferencesPerTest inferences with the op profiler attached
+KernelRun run_kernel_backend(ModelType type, KernelBackend backend) {
+  KernelRun run = {};
+  const int b = static_cast<int>(backend);
+  if (!session.Begin(type, &op_profiler)) return run;
+
+  // Identical input sequence for every backend
+  srand(kKernelInputSeed);
+  double delta_sum = 0.0;
+  int delta_count = 0;
+  bool ok = true;
+  for (int sample = 0; sample < kKernelCheckSamples && ok; sample++) {
+    session.PrepareInput();
+    ok = (session.Invoke() == kTfLiteOk);
+    float values[kKernelCheckMaxOutputs];
+    const int count = ok ? read_output_values(session.output(), values, kKernelCheckMaxOutputs) : 0;
+    for (int i = 0; i < count; i++) {
+      if (backend == KernelBackend::TFLM) {
+        kernel_check_outputs[sample][i] = values[i];
+        continue;
+      }
+      const float delta = fabsf(values[i] - kernel_check_outputs[sample][i]);
+      if (delta > run.max_abs_delta) run.max_abs_delta = delta;
+      delta_sum += delta;
+      delta_count++;
+    }
+  }
+  run.mean_abs_delta = delta_count > 0 ? (float)(delta_sum / delta_count) : 0.0f;
+
+  for (int w = 0; w < kWarmupInferences && ok; w++) {
+    session.PrepareInput();
+    ok = (session.Invoke() == kTfLiteOk);
+  }
+  op_profiler.Reset();
+  RunningStats stats;
+  for (int i = 0; i < kInferencesPerTest && ok; i++) {
+    session.PrepareInput();
+    BenchTimer::Ticks start_ticks = BenchTimer::Now();
+    ok = (session.Invoke() == kTfLiteOk);
+    BenchTimer::Ticks end_ticks = BenchTimer::Now();
+    stats.Add(BenchTimer::ToMicros(BenchTimer::Elapsed(start_ticks, end_ticks)));
+  }
+  if (ok) {
+    run.ok = true;
+    run.inferences = stats.count();
+    run.avg_us = stats.mean();
+    kernel_node_count = op_profiler.op_count();
+    for (int node = 0; node < kernel_node_count; node++) {
+      kernel_node_ops[node] = op_profiler.tag(node);
+      kernel_node_us[b][node] = op_profiler.avg_us(node);
+    }
+  }
+  session.End();
+  return run;
+}
+
+// Run every model once per kernel backend with identical inputs and report
+// per-op speedups and output deltas against the tflm backend. Per-op times
+// include the op profiler's timer reads, the same for every backend.
+void run_kernel_comparison() {
+  MicroPrintf("=== Kernel backend comparison (tflm = %s) ===", KernelBackends::LibraryName());
+  CSVLogger::PrintKernelHeader();
+  for (int m = 0; m < kModelTypeCount; m++) {
+    const ModelType type = ModelManager::GetModelType(m);
+    const ModelConfig& config = ModelManager::GetModelConfig(type);
+    if (config.unsupported_ops != nullptr) {
+      MicroPrintf("%s (%s): skipped, unsupported ops", config.name, config.quantization);
+      continue;
+    }
+    const tflite::Model* model = tflite::GetModel(config.model_data);
+
+    for (int b = 0; b < kKernelBackendCount; b++) {
+      const KernelBackend backend = static_cast<KernelBackend>(b);
+      kernel_runs[b] = {};
+      const int kernels = KernelBackends::CountKernels(model, backend);
+      // Nothing to compare when every op would fall back to tflm
+      if (backend != KernelBackend::TFLM && kernels == 0) continue;
+      if (backend != KernelBackend::TFLM && !kernel_runs[0].ok) continue;
+      KernelBackends::SelectAll(backend);
+      kernel_runs[b] = run_kernel_backend(type, backend);
+      kernel_runs[b].kernels = kernels;
+      if (!kernel_runs[b].ok) {
+        MicroPrintf("%s (%s): %s backend failed", config.name, config.quantization,
+                    KernelBackends::Name(backend));
+      }
+    }
+    KernelBackends::SelectDefaults();
+    if (!kernel_runs[0].ok) continue;
+
+    const double baseline_us = kernel_runs[0].avg_us;
+    for (int b = 0; b < kKernelBackendCount; b++) {
+      const KernelRun& run = kernel_runs[b];
+      if (!run.ok) continue;
+      const KernelBackend backend = static_cast<KernelBackend>(b);
+      const char* name = KernelBackends::Name(backend);
+      MicroPrintf("%s (%s) %s: avg=%.2f us (%.2fx vs tflm), %d kernels, max |delta|=%g",
+                  config.name, config.quantization, name, run.avg_us,
+                  run.avg_us > 0.0 ? baseline_us / run.avg_us : 0.0, run.kernels,
+                  run.max_abs_delta);
+      for (int node = 0; node < kernel_node_count; node++) {
+        // Backend that ran this node: selected for the op, tflm otherwise
+        KernelOp op;
+        const bool switchable = KernelBackends::FindOp(kernel_node_ops[node], &op);
+        const KernelBackend op_backend =
+            switchable && KernelBackends::Available(op, backend) ? backend : KernelBackend::TFLM;
+        CSVLogger::LogKernelOp(config.name, config.quantization, name, node,
+                               kernel_node_ops[node], KernelBackends::Name(op_backend),
+                               kernel_node_us[b][node], kernel_node_us[0][node]);
+      }
+      CSVLogger::LogKernel(config.name, config.quantization, name, run.kernels,
+                           run.inferences, run.avg_us, baseline_us,
+                           run.max_abs_delta, run.mean_abs_delta);
+    }
+  }
+  MicroPrintf("=== Kernel backend comparison complete ===");
+}
+
+// Run every ahead-of-time compiled model on the interpreter and on its
+// generated code, alternating per input so both see the same inputs and
+// cache state, and report latency, setup cost, arena and output deltas
+void run_aot_comparison() {
+  MicroPrintf("=== Ahead-of-time compiled vs interpreter (tflm = %s) ===",
+              KernelBackends::LibraryName());
+  CSVLogger::PrintAotHeader();
+  for (int m = 0; m < kModelTypeCount; m++) {
+    const ModelType type = ModelManager::GetModelType(m);
+    const ModelConfig& config = ModelManager::GetModelConfig(type);
+    if (config.aot_invoke == nullptr) {
+      MicroPrintf("%s (%s): skipped, not compiled ahead of time", config.name,
+                  config.quantization);
+      continue;
+    }
+    // Parsing, planning and Prepare(): the work aot_compile.py did offline
+    BenchTimer::Ticks setup_start = BenchTimer::Now();
+    bool ok = session.Begin(type);
+    BenchTimer::Ticks setup_end = BenchTimer::Now();
+    if (!ok) {
+      MicroPrintf("%s (%s): interpreter setup failed", config.name, config.quantization);
+      continue;
+    }
+    const double setup_us = BenchTimer::ToMicros(BenchTimer::Elapsed(setup_start, setup_end));
+    TfLiteTensor* output = session.output();
+    if (output->bytes > sizeof(aot_output)) {
+      MicroPrintf("%s (%s): skipped, output larger than kAotMaxOutputBytes",
+                  config.name, config.quantization);
+      session.End();
+      continue;
+    }
+    // Same layout and quantization as the interpreter's output
+    TfLiteTensor aot_tensor = *output;
+    aot_tensor.data.raw = reinterpret_cast<char*>(aot_output);
+
+    srand(kKernelInputSeed);
+    RunningStats interpreter_stats;
+    RunningStats aot_stats;
+    float max_abs_delta = 0.0f;
+    for (int i = 0; i < kWarmupInferences + kInferencesPerTest && ok; i++) {
+      session.PrepareInput();
+      BenchTimer::Ticks start_ticks = BenchTimer::Now();
+      ok = (session.Invoke() == kTfLiteOk);
+      BenchTimer::Ticks end_ticks = BenchTimer::Now();
+      const double interpreter_us = BenchTimer::ToMicros(BenchTimer::Elapsed(start_ticks, end_ticks));
+      start_ticks = BenchTimer::Now();
+      config.aot_invoke(session.input()->data.raw, aot_output);
+      end_ticks = BenchTimer::Now();
+      const double aot_us = BenchTimer::ToMicros(BenchTimer::Elapsed(start_ticks, end_ticks));
+      if (!ok || i < kWarmupInferences) continue;
+      interpreter_stats.Add(interpreter_us);
+      aot_stats.Add(aot_us);
+
+      float expected[kAotMaxOutputBytes];  // At most one value per byte
+      float actual[kAotMaxOutputBytes];
+      const int count = read_output_values(output, expected, kAotMaxOutputBytes);
+      read_output_values(&aot_tensor, actual, kAotMaxOutputBytes);
+      for (int j = 0; j < count; j++) {
+        const float delta = fabsf(actual[j] - expected[j]);
+        if (delta > max_abs_delta) max_abs_delta = delta;
+      }
+    }
+    const size_t interpreter_arena = session.interpreter()->arena_used_bytes();
+    session.End();
+    if (!ok) {
+      MicroPrintf("%s (%s): interpreter Invoke() failed", config.name, config.quantization);
+      continue;
+    }
+
+    MicroPrintf("%s (%s) x%d: interpreter %.2f us, aot %.2f us (%.2fx), setup %.1f us, "
+                "arena %zu -> %zu bytes, max |delta|=%g",
+                config.name, config.quantization, config.batch_size,
+                interpreter_stats.mean(), aot_stats.mean(),
+                aot_stats.mean() > 0.0 ? interpreter_stats.mean() / aot_stats.mean() : 0.0,
+                setup_us, interpreter_arena, config.aot_arena_bytes, max_abs_delta);
+    CSVLogger::LogAot(config.name, config.quantization, config.batch_size,
+                      interpreter_stats.count(), setup_us, interpreter_stats.mean(),
+                      aot_stats.mean(), interpreter_stats.min(), aot_stats.min(),
+                      interpreter_arena, config.aot_arena_bytes, max_abs_delta);
+  }
+  MicroPrintf("=== Ahead-of-time comparison complete ===");
 }
 
-// Get model info based on CURRENT_MODEL
-void select_model() {
-  #if CURRENT_MODEL == MODEL_SINE_FLOAT32
-    model_data = g_sine_model_float32;
-    model_data_len = g_sine_model_float32_len;
-    current_model_name = "sine";
-    current_quantization = "float32";
-  #elif CURRENT_MODEL == MODEL_CNN_FLOAT32
-    model_data = g_cnn_model_float32;
-    model_data_len = g_cnn_model_float32_len;
-    current_model_name = "cnn";
-    current_quantization = "float32";
-  #elif CURRENT_MODEL == MODEL_CNN_INT8
-    model_data = g_cnn_model_int8;
-    model_data_len = g_cnn_model_int8_len;
-    current_model_name = "cnn";
-    current_quantization = "int8";
-  #elif CURRENT_MODEL == MODEL_RNN_FLOAT32
-    model_data = g_rnn_model_float32;
-    model_data_len = g_rnn_model_float32_len;
-    current_model_name = "rnn";
-    current_quantization = "float32";
-  #elif CURRENT_MODEL == MODEL_RNN_INT8
-    model_data = g_rnn_model_int8;
-    model_data_len = g_rnn_model_int8_len;
-    current_model_name = "rnn";
-    current_quantization = "int8";
-  #else
-    #error "Invalid CURRENT_MODEL selection"
-  #endif
+// Report the minimum arena for every model before the sweep starts
+void run_arena_sizing() {
+  MicroPrintf("=== Arena sizing (%d bytes configured) ===", kTensorArenaSize);
+  ArenaSizer::PrintCsvHeader();
+  for (int i = 0; i < kModelTypeCount; i++) {
+    ModelType type = ModelManager::GetModelType(i);
+    const ModelConfig& config = ModelManager::GetModelConfig(type);
+    ArenaSizeResult result =
+        ArenaSizer::FindMinimumArenaSize(type, tensor_arena, kTensorArenaSize);
+    if (result.fits) {
+      MicroPrintf("%s (%s): arena used %zu bytes, minimum %zu bytes (%d probes)",
+                  config.name, config.quantization, result.used_bytes,
+                  result.min_bytes, result.probes);
+    } else if (config.unsupported_ops != nullptr) {
+      MicroPrintf("%s (%s): skipped, unsupported ops", config.name, config.quantization);
+    } else {
+      MicroPrintf("%s (%s): does not allocate in %d bytes",
+                  config.name, config.quantization, kTensorArenaSize);
+    }
+    ArenaSizer::PrintCsv(config, result, kTensorArenaSize);
+  }
+}
+
+// Time AllocateTensors() with the online (greedy) and the embedded offline
+// memory plan of every model before the sweep starts. Arena bytes are not
+// compared: the offline plans match greedy for every current model.
+void run_offline_plan_comparison() {
+  MicroPrintf("=== Offline memory plan comparison (%d allocations each) ===",
+              kOfflinePlanRepeats);
+  MicroPrintf("CSV_OFFLINE_PLAN_HEADER,model_name,quantization,planned,online_alloc_us,offline_alloc_us,online_alloc_min_us,offline_alloc_min_us");
+  for (int i = 0; i < kModelTypeCount; i++) {
+    ModelType type = ModelManager::GetModelType(i);
+    const ModelConfig& config = ModelManager::GetModelConfig(type);
+    AllocationTiming online = ArenaSizer::TimeAllocation(
+        type, false, tensor_arena, kTensorArenaSize, kOfflinePlanRepeats);
+    AllocationTiming offline = ArenaSizer::TimeAllocation(
+        type, true, tensor_arena, kTensorArenaSize, kOfflinePlanRepeats);
+    if (!online.ok) {
+      MicroPrintf("%s (%s): skipped, does not allocate", config.name, config.quantization);
+      continue;
+    }
+    if (offline.ok) {
+      MicroPrintf("%s (%s): AllocateTensors %.1f -> %.1f us",
+                  config.name, config.quantization, online.avg_us, offline.avg_us);
+    } else {
+      MicroPrintf("%s (%s): no offline plan, online only", config.name, config.quantization);
+    }
+    MicroPrintf("CSV_OFFLINE_PLAN,%s,%s,%d,%.1f,%.1f,%.1f,%.1f",
+                config.name, config.quantization, offline.ok ? 1 : 0,
+                online.avg_us, offline.avg_us, online.min_us, offline.min_us);
+  }
+}
+
+bool benchmark_complete() {
+  return sweep_done;
+}
+
+bool benchmark_passed() {
+  return allocation_failures == 0 && allocation_unchecked == 0;
 }
 
 void setup() {
-  heap_before_init = esp_get_free_heap_size();
   tflite::InitializeTarget();
+  memory_tracker.Snapshot(MemoryPhase::BOOT);
 
   MicroPrintf("=== ESP32 ML Benchmark Framework ===");
-  
-  // Select model based on configuration
-  select_model();
-  MicroPrintf("Selected Model: %s (%s)", current_model_name, current_quantization);
-  MicroPrintf("Model size: %d bytes", model_data_len);
+  MicroPrintf("Models in sweep: %d", kModelTypeCount);
   
   OutputHandler::PrintSystemInfo();
-  
-  // Load model
-  model = tflite::GetModel(model_data);
-  if (model->version() != TFLITE_SCHEMA_VERSION) {
-    MicroPrintf("Model schema mismatch! Expected %d, got %d",
-                TFLITE_SCHEMA_VERSION, model->version());
-    return;
+  KernelBackends::PrintSelection();
+
+  // Calibrate the timing backend before any measurement
+  BenchTimer::Calibrate();
+  MicroPrintf("Timer: %s, %.3f ticks/us, overhead %lu ticks subtracted",
+              BenchTimer::BackendName(), BenchTimer::ticks_per_us(),
+              (unsigned long)BenchTimer::overhead_ticks());
+
+  CSVLogger::SetBinary(kLogFormat == LogFormat::BINARY);
+  CSVLogger::PrintHeader();
+  MemoryTracker::PrintCsvHeader();
+  CSVLogger::LogTimer(BenchTimer::BackendName(), BenchTimer::ticks_per_us(),
+                      (uint32_t)BenchTimer::overhead_ticks());
+  for (int i = 0; i < kModelTypeCount; i++) {
+    const ModelConfig& config = ModelManager::GetModelConfig(ModelManager::GetModelType(i));
+    CSVLogger::LogModel(i, config.name, config.quantization, config.batch_size);
   }
-  MicroPrintf("Model loaded successfully");
-  
-  // Set up operations resolver
-  // Increase size to accommodate all operations
-  static tflite::MicroMutableOpResolver<20> resolver;
-  
-  // Add operations (add more as needed for your models)
-  resolver.AddFullyConnected();
-  resolver.AddQuantize();
-  resolver.AddDequantize();
-  resolver.AddConv2D();
-  resolver.AddMaxPool2D();
-  resolver.AddReshape();
-  resolver.AddSoftmax();
-  resolver.AddUnidirectionalSequenceLSTM();
-  resolver.AddTanh();
-  resolver.AddLogistic();
-  resolver.AddMul();
-  resolver.AddAdd();
-  
-  // Build interpreter
-  static tflite::MicroInterpreter static_interpreter(
-      model, resolver, tensor_arena, kTensorArenaSize);
-  interpreter = &static_interpreter;
-  
-  // Allocate tensors
-  TfLiteStatus allocate_status = interpreter->AllocateTensors();
-  if (allocate_status != kTfLiteOk) {
-    MicroPrintf("AllocateTensors() failed!");
-    return;
+  if (kEnableOpProfiling) {
+    OpProfiler::PrintCsvHeader();
+  }
+  if (kCheckInvokeAllocations) {
+    AllocationGuard::PrintCsvHeader();
+  }
+  if (kDumpArenaPlan) {
+    ArenaPlan::PrintCsvHeader();
+  }
+  if (kBenchmarkMode == BenchmarkMode::FIXED_RATE) {
+    CSVLogger::PrintRateHeader();
+  }
+  if (kBenchmarkMode == BenchmarkMode::PIPELINE) {
+    CSVLogger::PrintPipelineHeader();
+  }
+  if (kEnableArenaSizing) {
+    run_arena_sizing();
+  }
+  if (kCompareOfflinePlan) {
+    run_offline_plan_comparison();
+  }
+  if (kLogFromTask && kBenchmarkMode == BenchmarkMode::LATENCY) {
+    // Prefer the core the benchmark task is not running on
+    const int logger_core = Platform::GetCoreCount() > 1 ? kResultLoggerCore : 0;
+    if (!result_logger.StartTask(logger_core)) {
+      MicroPrintf("Result logger task not started, flushing after each model");
+    }
   }
-  
-  // Get input/output tensors
-  input = interpreter->input(0);
-  output = interpreter->output(0);
-  
-  // Print tensor info
-  MicroPrintf("Input tensor: %d bytes, type=%d", 
-              input->bytes, input->type);
-  MicroPrintf("Output tensor: %d bytes, type=%d", 
-              output->bytes, output->type);
-  
-  heap_after_init = esp_get_free_heap_size();
-  min_free_heap = esp_get_minimum_free_heap_size();
-  
-  size_t memory_used = heap_before_init - heap_after_init;
-  
-  MicroPrintf("Memory Analysis:");
-  MicroPrintf("  Heap before init: %zu bytes", heap_before_init);
-  MicroPrintf("  Heap after init: %zu bytes", heap_after_init);
-  MicroPrintf("  Memory used by model: %zu bytes", memory_used);
-  MicroPrintf("  Arena used: %zu bytes", interpreter->arena_used_bytes());
-  MicroPrintf("  Min free heap ever: %zu bytes", min_free_heap);
-  MicroPrintf("Starting benchmark...");
-  CSVLogger::PrintHeader();
-}
 
-// Prepare input based on model type
-void prepare_input() {
-  #if CURRENT_MODEL == MODEL_SINE_FLOAT32
-    // Sine model: single float input
-    x_val += 0.1f;
-    if (x_val > 2.0f * 3.14159f) x_val = 0.0f;
-    input->data.f[0] = x_val;
-    
-  #elif CURRENT_MODEL == MODEL_CNN_FLOAT32
-    // CNN model: 8x8 image, generate random pattern
-    for (int i = 0; i < 64; i++) {
-      input->data.f[i] = (float)(rand() % 100) / 100.0f;
-    }
-    
-  #elif CURRENT_MODEL == MODEL_CNN_INT8
-    // CNN model int8: 8x8 image
-    for (int i = 0; i < 64; i++) {
-      input->data.int8[i] = (int8_t)(rand() % 256 - 128);
-    }
-    
-  #elif CURRENT_MODEL == MODEL_RNN_FLOAT32
-    // RNN model: sequence of 10 floats
-    for (int i = 0; i < 10; i++) {
-      input->data.f[i] = (float)(rand() % 100) / 10.0f;
-    }
-    
-  #elif CURRENT_MODEL == MODEL_RNN_INT8
-    // RNN model int8: sequence of 10 int8
-    for (int i = 0; i < 10; i++) {
-      input->data.int8[i] = (int8_t)(rand() % 256 - 128);
-    }
-  #endif
+  // CONCURRENT, KERNEL_AB and AOT modes run from loop() instead of the sweep
+  if (kBenchmarkMode != BenchmarkMode::CONCURRENT &&
+      kBenchmarkMode != BenchmarkMode::KERNEL_AB &&
+      kBenchmarkMode != BenchmarkMode::AOT) {
+    start_next_model();
+  }
 }
 
 void loop() {
-  if (interpreter == nullptr) {
-    vTaskDelay(pdMS_TO_TICKS(1000));
+  if (sweep_done) {
+    Platform::DelayMs(1000);
+    return;
+  }
+  if (kBenchmarkMode == BenchmarkMode::CONCURRENT) {
+    run_concurrent_tests();
+    sweep_done = true;
+    return;
+  }
+  if (kBenchmarkMode == BenchmarkMode::KERNEL_AB) {
+    run_kernel_comparison();
+    sweep_done = true;
+    return;
+  }
+  if (kBenchmarkMode == BenchmarkMode::AOT) {
+    run_aot_comparison();
+    sweep_done = true;
+    return;
+  }
+  if (!session.active()) {
+    start_next_model();
     return;
   }
   
+  if (kBenchmarkMode == BenchmarkMode::THROUGHPUT) {
+    run_throughput_test();
+    return;
+  }
+  if (kBenchmarkMode == BenchmarkMode::FIXED_RATE) {
+    // Also after a skipped model: the run busy-waits, so let the idle
+    // task in before the next one
+    run_fixed_rate_test();
+    Platform::DelayMs(10);
+    return;
+  }
+  if (kBenchmarkMode == BenchmarkMode::PIPELINE) {
+    run_pipeline_test();
+    return;
+  }
+
+  const ModelConfig& config = session.config();
+
   // Prepare input
-  prepare_input();
+  session.PrepareInput();
   
   // Measure inference time
-  int64_t start_time = esp_timer_get_time();
-  TfLiteStatus invoke_status = interpreter->Invoke();
-  int64_t end_time = esp_timer_get_time();
-  int64_t latency_us = end_time - start_time;
+  allocation_guard.Begin();
+  BenchTimer::Ticks start_ticks = BenchTimer::Now();
+  TfLiteStatus invoke_status = session.Invoke();
+  BenchTimer::Ticks end_ticks = BenchTimer::Now();
+  allocation_guard.End();
+  BenchTimer::Ticks latency_ticks = BenchTimer::Elapsed(start_ticks, end_ticks);
+  double latency_us = BenchTimer::ToMicros(latency_ticks);
   
   if (invoke_status != kTfLiteOk) {
-    MicroPrintf("Invoke failed!");
+    skip_current_model();
     return;
   }
   
+  // Warmup phase: discard samples entirely
+  if (!warmup_done) {
+    warmup_inferences++;
+    if (warmup_inferences == 1) {
+      memory_tracker.Snapshot(MemoryPhase::FIRST_INVOKE);
+    }
+    if (warmup_inferences == kWarmupInferences) {
+      MicroPrintf("Warmup complete, starting measurements...");
+      warmup_done = true;
+      op_profiler.Reset();
+      allocation_guard.Reset();
+    }
+    Platform::DelayMs(kDelayBetweenTests);
+    return;
+  }
+
   // Update statistics
-  total_inferences++;
-  total_latency_us += latency_us;
-  if (latency_us < min_latency_us) min_latency_us = latency_us;
-  if (latency_us > max_latency_us) max_latency_us = latency_us;
+  latency_stats.Add(latency_us);
+  window_stats.Add(latency_us);
+  latency_histogram.RecordUs(latency_us);
+  int64_t total_inferences = latency_stats.count();
+  float min_latency_us = (float)latency_stats.min();
+  float max_latency_us = (float)latency_stats.max();
   
-  // Store latency for stddev
-  latencies[latency_index] = latency_us;
-  latency_index = (latency_index + 1) % kMaxLatencyHistory;
-  
-  // Warmup phase
-  if (total_inferences == kWarmupInferences) {
-    MicroPrintf("Warmup complete, starting measurements...");
-    warmup_done = true;
-    total_inferences = 0;
-    total_latency_us = 0;
-    min_latency_us = INT64_MAX;
-    max_latency_us = 0;
+  // Report every 10 inferences, with the window summary every 100. The
+  // record is only copied into the result ring here; the logger task does
+  // the serial output off the measured path.
+  if (total_inferences % 10 == 0) {
+    InferenceRecord record = {};
+    record.model_id = current_model_index;
+    record.iteration = total_inferences;
+    record.model_name = config.name;
+    record.quantization = config.quantization;
+    record.latency_us = (float)latency_us;
+    record.latency_ticks = (uint32_t)latency_ticks;
+    record.min_us = min_latency_us;
+    record.max_us = max_latency_us;
+    record.avg_us = (float)latency_stats.mean();
+    record.stddev_us = (float)latency_stats.stddev();
+    record.percentiles = latency_histogram.Percentiles();
+    record.arena_bytes = session.interpreter()->arena_used_bytes();
+    record.free_heap = Platform::GetFreeHeapSize();
+    if (total_inferences % 100 == 0) {
+      record.window_count = window_stats.count();
+      record.window_avg_us = (float)window_stats.mean();
+      record.window_stddev_us = (float)window_stats.stddev();
+    }
+    if (kLogFromTask) {
+      result_logger.Log(record);
+    } else {
+      ResultLogger<kResultRingCapacity>::Print(record);
+    }
   }
-  
-  // Print results every 10 inferences
-  if (warmup_done && total_inferences > 0 && total_inferences % 10 == 0) {
-    int64_t average_latency = total_latency_us / total_inferences;
-    int sample_count = (total_inferences < kMaxLatencyHistory) ? total_inferences : kMaxLatencyHistory;
-    float stddev = calculate_stddev(latencies, sample_count, average_latency);
-    
-    MicroPrintf("=== Iteration %lld ===", total_inferences);
-    MicroPrintf("Latency: cur=%lld us, avg=%lld us, min=%lld us, max=%lld us, stddev=%.2f us",
-                latency_us, average_latency, min_latency_us, max_latency_us, stddev);
-
-    CSVLogger::LogInference(
-        total_inferences, current_model_name, current_quantization,
-        latency_us, min_latency_us, max_latency_us, average_latency,
-        stddev, interpreter->arena_used_bytes(), esp_get_free_heap_size()
-    );
-    
-    MicroPrintf("");
+
+  // Move on to the next model once this one has enough measurements
+  if (total_inferences == kInferencesPerTest) {
+    finish_current_model();
   }
-  
-  // Print summary every 100 inferences
-  if (warmup_done && total_inferences % 100 == 0) {
-    int64_t avg_latency = total_latency_us / total_inferences;
-    float stddev = calculate_stddev(latencies, kMaxLatencyHistory, avg_latency);
-    
-    OutputHandler::PrintBenchmarkResult(
-        current_model_name,
-        avg_latency,
-        interpreter->arena_used_bytes()
-    );
-    
-    MicroPrintf("Statistics over last 100 inferences:");
-    MicroPrintf("  Min: %lld us, Max: %lld us, StdDev: %.2f us", 
-                min_latency_us, max_latency_us, stddev);
-  }
-
-  vTaskDelay(pdMS_TO_TICKS(kDelayBetweenTests));
+
+  Platform::DelayMs(kDelayBetweenTests);
 }
\ No newline at end of file
@@ -9,6 +9,12 @@ extern "C" {
 void setup();
 void loop();
 
+// True once every model in the sweep has been benchmarked
+bool benchmark_complete();
+// False if a model failed a check that fails the run, or an enabled check
+// could not run on this platform (allocation check)
+bool benchmark_passed();
+
 #ifdef __cplusplus
 }
 #endif
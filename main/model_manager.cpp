@@ -1,58 +1,295 @@
 #include "model_manager.h"
-#include "models/sine/model.h"
-#include "models/person_detection/model.h"
+#include "models/sine/model8.h"
+#include "models/sine/model32.h"
+#include "models/cnn/model8.h"
+#include "models/cnn/model32.h"
+#include "models/rnn/model8.h"
+#include "models/rnn/model32.h"
 #include "tensorflow/lite/micro/micro_log.h"
 
-ModelConfig ModelManager::GetModelConfig(ModelType type) {
-  switch (type) {
-    case ModelType::SINE_FLOAT32:
-      return {
-        .name = "sine_float32",
-        .model_data = g_model,
-        .model_data_len = g_model_len,
-        .quantization = "float32",
-        .input_size = 1,
-        .output_size = 1
-      };
-      
-    case ModelType::PERSON_DETECTION_INT8:
-      return {
-        .name = "person_detection_int8",
-        .model_data = g_person_detect_model_data,
-        .model_data_len = g_person_detect_model_data_len,
-        .quantization = "int8",
-        .input_size = 96 * 96,  // 96x96 grayscale image
-        .output_size = 2        // person / no-person scores
-      };
-      
-    default:
-      MicroPrintf("Unknown model type!");
-      return {};
-  }
+// Generated at build time by scripts/generate_op_resolvers.py
+#include "model_op_resolvers.h"
+// Generated at build time by scripts/convert_model.py
+#include "offline_planned_models.h"
+// Generated at build time by scripts/aot_compile.py
+#include "aot_models.h"
+
+namespace {
+// Registry of every model linked into the image, indexed by ModelType.
+// The sweep runner in main_functions.cpp benchmarks them in this order.
+const ModelConfig kModelRegistry[] = {
+  {
+    .name = "sine",
+    .family = ModelFamily::SINE,
+    .model_data = g_sine_model_float32,
+    .model_data_len = g_sine_model_float32_len,
+    .offline_model_data = g_sine_model_float32_offline,
+    .offline_model_data_len = g_sine_model_float32_offline_len,
+    .quantization = "float32",
+    .input_size = kSineInputSize,
+    .output_size = 1,
+    .batch_size = 1,
+    .streaming = false,
+    .get_op_resolver = GetSineModelFloat32OpResolver,
+    .unsupported_ops = kSineModelFloat32UnsupportedOps,
+    .aot_invoke = kSineModelFloat32AotInvoke,
+    .aot_arena_bytes = kSineModelFloat32AotArenaBytes
+  },
+  {
+    .name = "sine",
+    .family = ModelFamily::SINE,
+    .model_data = g_sine_model_int8,
+    .model_data_len = g_sine_model_int8_len,
+    .offline_model_data = g_sine_model_int8_offline,
+    .offline_model_data_len = g_sine_model_int8_offline_len,
+    .quantization = "int8",
+    .input_size = kSineInputSize,
+    .output_size = 1,
+    .batch_size = 1,
+    .streaming = false,
+    .get_op_resolver = GetSineModelInt8OpResolver,
+    .unsupported_ops = kSineModelInt8UnsupportedOps,
+    .aot_invoke = kSineModelInt8AotInvoke,
+    .aot_arena_bytes = kSineModelInt8AotArenaBytes
+  },
+  {
+    .name = "cnn",
+    .family = ModelFamily::CNN,
+    .model_data = g_cnn_model_float32,
+    .model_data_len = g_cnn_model_float32_len,
+    .offline_model_data = g_cnn_model_float32_offline,
+    .offline_model_data_len = g_cnn_model_float32_offline_len,
+    .quantization = "float32",
+    .input_size = kCNNInputHeight * kCNNInputWidth * kCNNInputChannels,
+    .output_size = 4,       // horizontal / vertical / diagonal / cross
+    .batch_size = 1,
+    .streaming = false,
+    .get_op_resolver = GetCnnModelFloat32OpResolver,
+    .unsupported_ops = kCnnModelFloat32UnsupportedOps,
+    .aot_invoke = kCnnModelFloat32AotInvoke,
+    .aot_arena_bytes = kCnnModelFloat32AotArenaBytes
+  },
+  {
+    .name = "cnn",
+    .family = ModelFamily::CNN,
+    .model_data = g_cnn_model_int8,
+    .model_data_len = g_cnn_model_int8_len,
+    .offline_model_data = g_cnn_model_int8_offline,
+    .offline_model_data_len = g_cnn_model_int8_offline_len,
+    .quantization = "int8",
+    .input_size = kCNNInputHeight * kCNNInputWidth * kCNNInputChannels,
+    .output_size = 4,
+    .batch_size = 1,
+    .streaming = false,
+    .get_op_resolver = GetCnnModelInt8OpResolver,
+    .unsupported_ops = kCnnModelInt8UnsupportedOps,
+    .aot_invoke = kCnnModelInt8AotInvoke,
+    .aot_arena_bytes = kCnnModelInt8AotArenaBytes
+  },
+  {
+    .name = "rnn",
+    .family = ModelFamily::RNN,
+    .model_data = g_rnn_model_float32,
+    .model_data_len = g_rnn_model_float32_len,
+    .offline_model_data = g_rnn_model_float32_offline,
+    .offline_model_data_len = g_rnn_model_float32_offline_len,
+    .quantization = "float32",
+    .input_size = kRNNSequenceLength * kRNNFeatureSize,
+    .output_size = 3,       // increasing / decreasing / random
+    .batch_size = 1,
+    .streaming = false,
+    .get_op_resolver = GetRnnModelFloat32OpResolver,
+    .unsupported_ops = kRnnModelFloat32UnsupportedOps,
+    .aot_invoke = kRnnModelFloat32AotInvoke,
+    .aot_arena_bytes = kRnnModelFloat32AotArenaBytes
+  },
+  {
+    .name = "rnn",
+    .family = ModelFamily::RNN,
+    .model_data = g_rnn_model_int8,
+    .model_data_len = g_rnn_model_int8_len,
+    .offline_model_data = g_rnn_model_int8_offline,
+    .offline_model_data_len = g_rnn_model_int8_offline_len,
+    .quantization = "int8",
+    .input_size = kRNNSequenceLength * kRNNFeatureSize,
+    .output_size = 3,
+    .batch_size = 1,
+    .streaming = false,
+    .get_op_resolver = GetRnnModelInt8OpResolver,
+    .unsupported_ops = kRnnModelInt8UnsupportedOps,
+    .aot_invoke = kRnnModelInt8AotInvoke,
+    .aot_arena_bytes = kRnnModelInt8AotArenaBytes
+  },
+  {
+    .name = "cnn_b2",
+    .family = ModelFamily::CNN,
+    .model_data = g_cnn_b2_model_float32,
+    .model_data_len = g_cnn_b2_model_float32_len,
+    .offline_model_data = g_cnn_b2_model_float32_offline,
+    .offline_model_data_len = g_cnn_b2_model_float32_offline_len,
+    .quantization = "float32",
+    .input_size = kCNNInputHeight * kCNNInputWidth * kCNNInputChannels,
+    .output_size = 4,
+    .batch_size = 2,
+    .streaming = false,
+    .get_op_resolver = GetCnnB2ModelFloat32OpResolver,
+    .unsupported_ops = kCnnB2ModelFloat32UnsupportedOps,
+    .aot_invoke = kCnnB2ModelFloat32AotInvoke,
+    .aot_arena_bytes = kCnnB2ModelFloat32AotArenaBytes
+  },
+  {
+    .name = "cnn_b4",
+    .family = ModelFamily::CNN,
+    .model_data = g_cnn_b4_model_float32,
+    .model_data_len = g_cnn_b4_model_float32_len,
+    .offline_model_data = g_cnn_b4_model_float32_offline,
+    .offline_model_data_len = g_cnn_b4_model_float32_offline_len,
+    .quantization = "float32",
+    .input_size = kCNNInputHeight * kCNNInputWidth * kCNNInputChannels,
+    .output_size = 4,
+    .batch_size = 4,
+    .streaming = false,
+    .get_op_resolver = GetCnnB4ModelFloat32OpResolver,
+    .unsupported_ops = kCnnB4ModelFloat32UnsupportedOps,
+    .aot_invoke = kCnnB4ModelFloat32AotInvoke,
+    .aot_arena_bytes = kCnnB4ModelFloat32AotArenaBytes
+  },
+  {
+    .name = "cnn_b8",
+    .family = ModelFamily::CNN,
+    .model_data = g_cnn_b8_model_float32,
+    .model_data_len = g_cnn_b8_model_float32_len,
+    .offline_model_data = g_cnn_b8_model_float32_offline,
+    .offline_model_data_len = g_cnn_b8_model_float32_offline_len,
+    .quantization = "float32",
+    .input_size = kCNNInputHeight * kCNNInputWidth * kCNNInputChannels,
+    .output_size = 4,
+    .batch_size = 8,
+    .streaming = false,
+    .get_op_resolver = GetCnnB8ModelFloat32OpResolver,
+    .unsupported_ops = kCnnB8ModelFloat32UnsupportedOps,
+    .aot_invoke = kCnnB8ModelFloat32AotInvoke,
+    .aot_arena_bytes = kCnnB8ModelFloat32AotArenaBytes
+  },
+  {
+    .name = "cnn_b2",
+    .family = ModelFamily::CNN,
+    .model_data = g_cnn_b2_model_int8,
+    .model_data_len = g_cnn_b2_model_int8_len,
+    .offline_model_data = g_cnn_b2_model_int8_offline,
+    .offline_model_data_len = g_cnn_b2_model_int8_offline_len,
+    .quantization = "int8",
+    .input_size = kCNNInputHeight * kCNNInputWidth * kCNNInputChannels,
+    .output_size = 4,
+    .batch_size = 2,
+    .streaming = false,
+    .get_op_resolver = GetCnnB2ModelInt8OpResolver,
+    .unsupported_ops = kCnnB2ModelInt8UnsupportedOps,
+    .aot_invoke = kCnnB2ModelInt8AotInvoke,
+    .aot_arena_bytes = kCnnB2ModelInt8AotArenaBytes
+  },
+  {
+    .name = "cnn_b4",
+    .family = ModelFamily::CNN,
+    .model_data = g_cnn_b4_model_int8,
+    .model_data_len = g_cnn_b4_model_int8_len,
+    .offline_model_data = g_cnn_b4_model_int8_offline,
+    .offline_model_data_len = g_cnn_b4_model_int8_offline_len,
+    .quantization = "int8",
+    .input_size = kCNNInputHeight * kCNNInputWidth * kCNNInputChannels,
+    .output_size = 4,
+    .batch_size = 4,
+    .streaming = false,
+    .get_op_resolver = GetCnnB4ModelInt8OpResolver,
+    .unsupported_ops = kCnnB4ModelInt8UnsupportedOps,
+    .aot_invoke = kCnnB4ModelInt8AotInvoke,
+    .aot_arena_bytes = kCnnB4ModelInt8AotArenaBytes
+  },
+  {
+    .name = "cnn_b8",
+    .family = ModelFamily::CNN,
+    .model_data = g_cnn_b8_model_int8,
+    .model_data_len = g_cnn_b8_model_int8_len,
+    .offline_model_data = g_cnn_b8_model_int8_offline,
+    .offline_model_data_len = g_cnn_b8_model_int8_offline_len,
+    .quantization = "int8",
+    .input_size = kCNNInputHeight * kCNNInputWidth * kCNNInputChannels,
+    .output_size = 4,
+    .batch_size = 8,
+    .streaming = false,
+    .get_op_resolver = GetCnnB8ModelInt8OpResolver,
+    .unsupported_ops = kCnnB8ModelInt8UnsupportedOps,
+    .aot_invoke = kCnnB8ModelInt8AotInvoke,
+    .aot_arena_bytes = kCnnB8ModelInt8AotArenaBytes
+  },
+  {
+    .name = "rnn_stream",
+    .family = ModelFamily::RNN,
+    .model_data = g_rnn_stream_model_float32,
+    .model_data_len = g_rnn_stream_model_float32_len,
+    .offline_model_data = g_rnn_stream_model_float32_offline,
+    .offline_model_data_len = g_rnn_stream_model_float32_offline_len,
+    .quantization = "float32",
+    .input_size = kRNNFeatureSize,  // One timestep
+    .output_size = 3,
+    .batch_size = 1,
+    .streaming = true,
+    .get_op_resolver = GetRnnStreamModelFloat32OpResolver,
+    .unsupported_ops = kRnnStreamModelFloat32UnsupportedOps,
+    .aot_invoke = kRnnStreamModelFloat32AotInvoke,
+    .aot_arena_bytes = kRnnStreamModelFloat32AotArenaBytes
+  },
+  {
+    .name = "cnn_fused",
+    .family = ModelFamily::CNN,
+    .model_data = g_cnn_fused_model_float32,
+    .model_data_len = g_cnn_fused_model_float32_len,
+    .offline_model_data = g_cnn_fused_model_float32_offline,
+    .offline_model_data_len = g_cnn_fused_model_float32_offline_len,
+    .quantization = "float32",
+    .input_size = kCNNInputHeight * kCNNInputWidth * kCNNInputChannels,
+    .output_size = 4,
+    .batch_size = 1,
+    .streaming = false,
+    .get_op_resolver = GetCnnFusedModelFloat32OpResolver,
+    .unsupported_ops = kCnnFusedModelFloat32UnsupportedOps,
+    .aot_invoke = kCnnFusedModelFloat32AotInvoke,
+    .aot_arena_bytes = kCnnFusedModelFloat32AotArenaBytes
+  },
+  {
+    .name = "cnn_fused",
+    .family = ModelFamily::CNN,
+    .model_data = g_cnn_fused_model_int8,
+    .model_data_len = g_cnn_fused_model_int8_len,
+    .offline_model_data = g_cnn_fused_model_int8_offline,
+    .offline_model_data_len = g_cnn_fused_model_int8_offline_len,
+    .quantization = "int8",
+    .input_size = kCNNInputHeight * kCNNInputWidth * kCNNInputChannels,
+    .output_size = 4,
+    .batch_size = 1,
+    .streaming = false,
+    .get_op_resolver = GetCnnFusedModelInt8OpResolver,
+    .unsupported_ops = kCnnFusedModelInt8UnsupportedOps,
+    .aot_invoke = kCnnFusedModelInt8AotInvoke,
+    .aot_arena_bytes = kCnnFusedModelInt8AotArenaBytes
+  },
+};
+static_assert(sizeof(kModelRegistry) / sizeof(kModelRegistry[0]) == kModelTypeCount,
+              "kModelRegistry needs exactly one row per ModelType");
+}  // namespace
+
+const ModelConfig& ModelManager::GetModelConfig(ModelType type) {
+  return kModelRegistry[static_cast<int>(type)];
 }
 
-bool ModelManager::SetupOpResolver(ModelType type, 
-                                   tflite::MicroMutableOpResolver<20>* resolver) {
-  switch (type) {
-    case ModelType::SINE_FLOAT32:
-      // Sine model operations
-      if (resolver->AddFullyConnected() != kTfLiteOk) return false;
-      if (resolver->AddQuantize() != kTfLiteOk) return false;
-      if (resolver->AddDequantize() != kTfLiteOk) return false;
-      return true;
-      
-    case ModelType::PERSON_DETECTION_INT8:
-      // Person detection operations
-      if (resolver->AddConv2D() != kTfLiteOk) return false;
-      if (resolver->AddDepthwiseConv2D() != kTfLiteOk) return false;
-      if (resolver->AddAveragePool2D() != kTfLiteOk) return false;
-      if (resolver->AddReshape() != kTfLiteOk) return false;
-      if (resolver->AddSoftmax() != kTfLiteOk) return false;
-      if (resolver->AddFullyConnected() != kTfLiteOk) return false;
-      return true;
-      
-    default:
-      MicroPrintf("Unknown model type for op resolver!");
-      return false;
+ModelType ModelManager::GetModelType(int index) {
+  if (index < 0 || index >= kModelTypeCount) {
+    MicroPrintf("Unknown model index %d!", index);
+    return ModelType::SINE_FLOAT32;
   }
-}
\ No newline at end of file
+  return static_cast<ModelType>(index);
+}
+
+const tflite::MicroOpResolver* ModelManager::GetOpResolver(ModelType type) {
+  return GetModelConfig(type).get_op_resolver();
+}
@@ -1,28 +1,72 @@
 #ifndef MODEL_MANAGER_H_
 #define MODEL_MANAGER_H_
 
-#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/micro/micro_op_resolver.h"
+
+#include "constants.h"
 
 enum class ModelType {
   SINE_FLOAT32,
-  PERSON_DETECTION_INT8,
+  SINE_INT8,
+  CNN_FLOAT32,
+  CNN_INT8,
+  RNN_FLOAT32,
+  RNN_INT8,
+  CNN_FLOAT32_B2,
+  CNN_FLOAT32_B4,
+  CNN_FLOAT32_B8,
+  CNN_INT8_B2,
+  CNN_INT8_B4,
+  CNN_INT8_B8,
+  RNN_STREAM_FLOAT32,
+  CNN_FUSED_FLOAT32,
+  CNN_FUSED_INT8,
   // Add more models here as you implement them
+  COUNT,  // Not a model
+};
+
+// Number of models in one benchmark sweep
+constexpr int kModelTypeCount = static_cast<int>(ModelType::COUNT);
+
+// Model family decides how input tensors are filled
+enum class ModelFamily {
+  SINE,
+  CNN,
+  RNN,
 };
 
 struct ModelConfig {
   const char* name;
+  ModelFamily family;
   const unsigned char* model_data;
   int model_data_len;
+  // Same model with an OfflineMemoryAllocation arena plan embedded
+  // (generated by scripts/convert_model.py); length 0 when not plannable
+  const unsigned char* offline_model_data;
+  int offline_model_data_len;
   const char* quantization;
-  int input_size;
-  int output_size;
+  int input_size;          // Elements per sample
+  int output_size;         // Elements per sample
+  int batch_size;          // Samples per Invoke()
+  // Recurrent state persists across Invoke() calls (one timestep per call).
+  // Full-sequence RNNs have their state reset before every Invoke().
+  bool streaming;
+  // Generated per-model resolver (model_op_resolvers.h); null when the
+  // model needs ops TFLite Micro does not provide
+  const tflite::MicroOpResolver* (*get_op_resolver)();
+  const char* unsupported_ops;
+  // Ahead-of-time compiled twin (aot_models.h, scripts/aot_compile.py):
+  // one inference from an input-tensor-shaped buffer into an output-shaped
+  // one, and its activation arena; null when the model was not compiled
+  void (*aot_invoke)(const void* input, void* output);
+  size_t aot_arena_bytes;
 };
 
 class ModelManager {
  public:
-  static ModelConfig GetModelConfig(ModelType type);
-  static bool SetupOpResolver(ModelType type, 
-                              tflite::MicroMutableOpResolver<20>* resolver);
+  static const ModelConfig& GetModelConfig(ModelType type);
+  static ModelType GetModelType(int index);
+  static const tflite::MicroOpResolver* GetOpResolver(ModelType type);
 };
 
-#endif  // MODEL_MANAGER_H_
\ No newline at end of file
+#endif  // MODEL_MANAGER_H_
@@ -0,0 +1,194 @@
+/**
+ * @file model_session.cpp
+ * @brief Per-model interpreter lifecycle and input generation
+ */
+
+#include "model_session.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <new>
+
+#include "tensorflow/lite/micro/micro_allocator.h"
+#include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+ModelSession::ModelSession(uint8_t* tensor_arena, size_t tensor_arena_size)
+    : tensor_arena_(tensor_arena), tensor_arena_size_(tensor_arena_size) {}
+
+ModelSession::~ModelSession() { End(); }
+
+bool ModelSession::Begin(ModelType type, OpProfiler* profiler, MemoryTracker* memory,
+                         ArenaPlan* plan) {
+  End();
+  type_ = type;
+  profiler_ = profiler;
+  const ModelConfig& model_config = config();
+
+  MicroPrintf("Selected Model: %s (%s)", model_config.name, model_config.quantization);
+  // Offline-planned twin when asked for and the model could be planned
+  const bool offline = kUseOfflinePlan && model_config.offline_model_data_len > 0;
+  MicroPrintf("Model size: %d bytes%s",
+              offline ? model_config.offline_model_data_len : model_config.model_data_len,
+              offline ? " (offline memory plan)" : "");
+
+  // Load model
+  const tflite::Model* model = tflite::GetModel(
+      offline ? model_config.offline_model_data : model_config.model_data);
+  if (model->version() != TFLITE_SCHEMA_VERSION) {
+    MicroPrintf("Model schema mismatch! Expected %d, got %d",
+                TFLITE_SCHEMA_VERSION, model->version());
+    return false;
+  }
+  MicroPrintf("Model loaded successfully");
+  if (memory != nullptr) memory->Snapshot(MemoryPhase::MODEL_LOADED);
+
+  // Generated resolver holding exactly the ops this model uses
+  if (model_config.unsupported_ops != nullptr) {
+    MicroPrintf("Model needs ops not available in TFLite Micro: %s",
+                model_config.unsupported_ops);
+    return false;
+  }
+  const tflite::MicroOpResolver* resolver = ModelManager::GetOpResolver(type);
+  if (resolver == nullptr) {
+    MicroPrintf("Op resolver setup failed!");
+    return false;
+  }
+
+  // Build interpreter. The allocator lives in the arena either way; only
+  // its planner differs when recording the plan.
+  if (plan != nullptr) {
+    plan->Reset();
+    tflite::MicroAllocator* allocator =
+        tflite::MicroAllocator::Create(tensor_arena_, tensor_arena_size_, plan);
+    if (allocator == nullptr) {
+      MicroPrintf("MicroAllocator setup failed!");
+      return false;
+    }
+    interpreter_ = new (interpreter_buffer_) tflite::MicroInterpreter(
+        model, *resolver, allocator, nullptr, profiler_);
+  } else {
+    interpreter_ = new (interpreter_buffer_) tflite::MicroInterpreter(
+        model, *resolver, tensor_arena_, tensor_arena_size_,
+        nullptr, profiler_);
+  }
+
+  // Packed kernels look their weights up in Prepare(), so before allocation
+  if (packed_weights_.Bind(model)) {
+    if (interpreter_->SetMicroExternalContext(&packed_weights_) != kTfLiteOk) {
+      MicroPrintf("SetMicroExternalContext() failed!");
+      End();
+      return false;
+    }
+    MicroPrintf("Packed weights: %d filters", packed_weights_.count());
+  }
+
+  // Allocate tensors
+  TfLiteStatus allocate_status = interpreter_->AllocateTensors();
+  if (allocate_status != kTfLiteOk) {
+    MicroPrintf("AllocateTensors() failed!");
+    End();
+    return false;
+  }
+  if (memory != nullptr) memory->Snapshot(MemoryPhase::TENSORS_ALLOCATED);
+
+  // Get input/output tensors
+  input_ = interpreter_->input(0);
+  output_ = interpreter_->output(0);
+
+  // GenerateInput() writes input_size * batch_size elements
+  const size_t element_bytes = (input_->type == kTfLiteInt8) ? 1 : sizeof(float);
+  const size_t expected_bytes =
+      (size_t)model_config.input_size * model_config.batch_size * element_bytes;
+  if (input_->bytes < expected_bytes) {
+    MicroPrintf("Input tensor is %zu bytes, registry expects %zu!",
+                input_->bytes, expected_bytes);
+    End();
+    return false;
+  }
+  x_val_ = 0.0f;
+  reset_state_ = model_config.family == ModelFamily::RNN && !model_config.streaming;
+  if (profiler_ != nullptr) profiler_->Reset();
+
+  // Print tensor info
+  MicroPrintf("Input tensor: %d bytes, type=%d",
+              input_->bytes, input_->type);
+  MicroPrintf("Output tensor: %d bytes, type=%d",
+              output_->bytes, output_->type);
+  return true;
+}
+
+void ModelSession::End() {
+  if (interpreter_ != nullptr) {
+    interpreter_->~MicroInterpreter();
+    interpreter_ = nullptr;
+  }
+  packed_weights_.Clear();
+  profiler_ = nullptr;
+  input_ = nullptr;
+  output_ = nullptr;
+}
+
+void ModelSession::PrepareInput() {
+  GenerateInput(input_->data.raw);
+  ResetState();
+}
+
+void ModelSession::ResetState() {
+  if (reset_state_) interpreter_->Reset();
+}
+
+// Generate input based on model family and input tensor type
+void ModelSession::GenerateInput(void* buffer) {
+  const ModelConfig& model_config = config();
+  const bool is_int8 = (input_->type == kTfLiteInt8);
+  int8_t* data_int8 = static_cast<int8_t*>(buffer);
+  float* data_f = static_cast<float*>(buffer);
+  // Batched models take batch_size samples back to back
+  const int elements = model_config.input_size * model_config.batch_size;
+
+  switch (model_config.family) {
+    case ModelFamily::SINE:
+      // Sine model: single input sweeping 0..2*pi
+      x_val_ += 0.1f;
+      if (x_val_ > 2.0f * 3.14159f) x_val_ = 0.0f;
+      if (is_int8) {
+        int32_t q = (int32_t)roundf(x_val_ / input_->params.scale) +
+                    input_->params.zero_point;
+        if (q < -128) q = -128;
+        if (q > 127) q = 127;
+        data_int8[0] = (int8_t)q;
+      } else {
+        data_f[0] = x_val_;
+      }
+      break;
+
+    case ModelFamily::CNN:
+      // CNN model: 8x8 image, generate random pattern
+      for (int i = 0; i < elements; i++) {
+        if (is_int8) {
+          data_int8[i] = (int8_t)(rand() % 256 - 128);
+        } else {
+          data_f[i] = (float)(rand() % 100) / 100.0f;
+        }
+      }
+      break;
+
+    case ModelFamily::RNN:
+      // RNN model: sequence of 10 values, or one value per Invoke() for
+      // the streaming variant
+      for (int i = 0; i < elements; i++) {
+        if (is_int8) {
+          data_int8[i] = (int8_t)(rand() % 256 - 128);
+        } else {
+          data_f[i] = (float)(rand() % 100) / 10.0f;
+        }
+      }
+      break;
+  }
+}
+
+TfLiteStatus ModelSession::Invoke() {
+  if (profiler_ != nullptr) profiler_->BeginInvoke();
+  return interpreter_->Invoke();
+}
@@ -0,0 +1,70 @@
+#ifndef MODEL_SESSION_H_
+#define MODEL_SESSION_H_
+
+#include "tensorflow/lite/micro/micro_interpreter.h"
+
+#include "constants.h"
+#include "model_manager.h"
+#include "arena_plan.h"
+#include "memory_tracker.h"
+#include "op_profiler.h"
+#include "packed_weights.h"
+
+// Owns the MicroInterpreter for one model at a time. The interpreter is
+// placement-constructed into static storage so a sweep can tear it down and
+// rebuild it on the same tensor arena without touching the heap. Op
+// resolvers are generated per model and live for the whole program. The
+// model's pre-packed weights, if any, reach the packed kernels as the
+// interpreter's external context.
+class ModelSession {
+ public:
+  ModelSession(uint8_t* tensor_arena, size_t tensor_arena_size);
+  ~ModelSession();
+
+  // Load model, build interpreter and allocate tensors. When a profiler is
+  // given it is attached to the interpreter for per-op timing; a memory
+  // tracker gets the MODEL_LOADED and TENSORS_ALLOCATED snapshots; an
+  // arena plan becomes the allocator's memory planner and records the
+  // layout.
+  bool Begin(ModelType type, OpProfiler* profiler = nullptr,
+             MemoryTracker* memory = nullptr, ArenaPlan* plan = nullptr);
+  // Destroy interpreter and release the arena for the next model
+  void End();
+
+  // Fill the input tensor with the next synthetic sample, then ResetState()
+  void PrepareInput();
+  // Full-sequence RNNs get their LSTM state cleared so every window starts
+  // from zero; streaming models carry it over. Callers that fill the input
+  // some other way call this before starting the timer.
+  void ResetState();
+  // Write the next synthetic sample into a buffer laid out like the input
+  // tensor (input()->bytes), e.g. from a producer task in PIPELINE mode
+  void GenerateInput(void* buffer);
+  // Run the model; nothing but the interpreter's Invoke() is timed
+  TfLiteStatus Invoke();
+
+  bool active() const { return interpreter_ != nullptr; }
+  ModelType type() const { return type_; }
+  const ModelConfig& config() const { return ModelManager::GetModelConfig(type_); }
+  tflite::MicroInterpreter* interpreter() { return interpreter_; }
+  TfLiteTensor* input() { return input_; }
+  TfLiteTensor* output() { return output_; }
+
+ private:
+  uint8_t* tensor_arena_;
+  size_t tensor_arena_size_;
+
+  alignas(tflite::MicroInterpreter)
+      uint8_t interpreter_buffer_[sizeof(tflite::MicroInterpreter)];
+  tflite::MicroInterpreter* interpreter_ = nullptr;
+  OpProfiler* profiler_ = nullptr;
+  PackedWeights packed_weights_;
+
+  ModelType type_ = ModelType::SINE_FLOAT32;
+  TfLiteTensor* input_ = nullptr;
+  TfLiteTensor* output_ = nullptr;
+  float x_val_ = 0.0f;  // For sine model
+  bool reset_state_ = false;
+};
+
+#endif  // MODEL_SESSION_H_
@@ -0,0 +1,871 @@
+#include "model32.h"
+
+alignas(8) const unsigned char g_cnn_fused_model_float32[] = {
+    0x20, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x14, 0x00, 0x20, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
+    0x70, 0x1e, 0x00, 0x00, 0x28, 0x04, 0x00, 0x00, 0xc8, 0x03, 0x00, 0x00,
+    0x9c, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x34, 0x28, 0x00, 0x00,
+    0x0c, 0x28, 0x00, 0x00, 0xfc, 0x27, 0x00, 0x00, 0xec, 0x27, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x10, 0x00, 0x04, 0x00,
+    0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x43, 0x4f, 0x4e, 0x56,
+    0x5f, 0x52, 0x45, 0x4c, 0x55, 0x5f, 0x50, 0x4f, 0x4f, 0x4c, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+    0x58, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x28, 0x1e, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0xf0, 0x26, 0x00, 0x00, 0x9c, 0x26, 0x00, 0x00,
+    0x3c, 0x26, 0x00, 0x00, 0xfc, 0x25, 0x00, 0x00, 0xbc, 0x25, 0x00, 0x00,
+    0x80, 0x25, 0x00, 0x00, 0x44, 0x25, 0x00, 0x00, 0x04, 0x25, 0x00, 0x00,
+    0x90, 0x24, 0x00, 0x00, 0x08, 0x24, 0x00, 0x00, 0xe4, 0x22, 0x00, 0x00,
+    0x10, 0x22, 0x00, 0x00, 0xb0, 0x21, 0x00, 0x00, 0x1c, 0x21, 0x00, 0x00,
+    0x9c, 0x20, 0x00, 0x00, 0x40, 0x20, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
+    0xd8, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x48, 0x01, 0x00, 0x00,
+    0x84, 0x01, 0x00, 0x00, 0x12, 0x00, 0x18, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x18, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x14, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+    0x38, 0x1e, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x18, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x14, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+    0x5c, 0x1d, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x00, 0xe0, 0x1c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x18, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x14, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x90, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+    0x54, 0x46, 0x4c, 0x33, 0x14, 0x00, 0x20, 0x00, 0x1c, 0x00, 0x18, 0x00,
+    0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00,
+    0xe4, 0x00, 0x00, 0x00, 0x24, 0x1b, 0x00, 0x00, 0x34, 0x1b, 0x00, 0x00,
+    0xa0, 0x24, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0xd6, 0xe3, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61,
+    0x75, 0x6c, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x90, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5f, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0xba, 0xe4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x6b, 0x65, 0x72, 0x61, 0x73, 0x5f, 0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xff, 0xff, 0x13, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x43, 0x4f, 0x4e, 0x56,
+    0x45, 0x52, 0x53, 0x49, 0x4f, 0x4e, 0x5f, 0x4d, 0x45, 0x54, 0x41, 0x44,
+    0x41, 0x54, 0x41, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x13, 0x00, 0x00, 0x00, 0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x75, 0x6e, 0x74,
+    0x69, 0x6d, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x3c, 0x1a, 0x00, 0x00, 0x34, 0x1a, 0x00, 0x00,
+    0xe4, 0x19, 0x00, 0x00, 0xd4, 0x07, 0x00, 0x00, 0xc4, 0x06, 0x00, 0x00,
+    0xb4, 0x02, 0x00, 0x00, 0x64, 0x02, 0x00, 0x00, 0x44, 0x02, 0x00, 0x00,
+    0x2c, 0x02, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00,
+    0xc4, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00,
+    0xac, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
+    0x94, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x86, 0xe5, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00,
+    0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x04, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0xcf, 0xcf, 0x9e, 0xd8, 0xca, 0xa5, 0xe7, 0x8d,
+    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x32, 0x2e, 0x31, 0x39, 0x2e, 0x30, 0x00, 0x00,
+    0xf2, 0xe5, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x31, 0x2e, 0x35, 0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x54, 0xdd, 0xff, 0xff, 0x58, 0xdd, 0xff, 0xff,
+    0x5c, 0xdd, 0xff, 0xff, 0x60, 0xdd, 0xff, 0xff, 0x64, 0xdd, 0xff, 0xff,
+    0x68, 0xdd, 0xff, 0xff, 0x6c, 0xdd, 0xff, 0xff, 0x2a, 0xe6, 0xff, 0xff,
+    0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x55, 0x74, 0x01, 0x3e,
+    0xca, 0xf3, 0x5b, 0x3e, 0xa1, 0xdd, 0xc5, 0x3d, 0x77, 0xdb, 0x20, 0x3e,
+    0xc2, 0xbb, 0xbe, 0x3d, 0xfd, 0x8c, 0x39, 0x3e, 0x8c, 0x4b, 0xf0, 0x3d,
+    0x67, 0x60, 0x50, 0x3e, 0x56, 0xe6, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+    0x20, 0x01, 0x00, 0x00, 0x69, 0x9e, 0x89, 0x3d, 0x2b, 0x92, 0x22, 0x3e,
+    0xb9, 0x71, 0x26, 0xbe, 0x49, 0x5c, 0x03, 0x3f, 0x06, 0xc7, 0x07, 0xbf,
+    0xca, 0x5d, 0xe6, 0x3e, 0x59, 0x85, 0xb4, 0x3e, 0xcf, 0x6d, 0xdd, 0x3d,
+    0x96, 0x48, 0xd2, 0xbe, 0xc9, 0xd6, 0x09, 0xbf, 0xb3, 0x74, 0x6f, 0xbc,
+    0x7a, 0x40, 0x1a, 0x3d, 0xfb, 0xc2, 0xcf, 0x3e, 0x5f, 0xcd, 0xd9, 0xbd,
+    0x57, 0x2f, 0xe3, 0x3e, 0xed, 0x66, 0x68, 0x3e, 0x95, 0x46, 0x59, 0xbe,
+    0xbf, 0x4a, 0xe3, 0x3e, 0x27, 0x42, 0x83, 0x3e, 0xec, 0xe2, 0x3e, 0x3e,
+    0x24, 0x91, 0x9f, 0x3e, 0x05, 0x96, 0x89, 0x3e, 0x1d, 0x1a, 0xf8, 0x3e,
+    0xb5, 0xc2, 0x97, 0x3e, 0xc3, 0x29, 0xfc, 0x3b, 0x5b, 0xf8, 0xdf, 0x3e,
+    0x1c, 0x40, 0xa9, 0x3d, 0xcf, 0xe6, 0x6e, 0xbe, 0x55, 0xd5, 0x06, 0x3f,
+    0xbd, 0x4d, 0x76, 0xbe, 0xa2, 0x97, 0xa4, 0xbe, 0xb4, 0x07, 0x48, 0xbd,
+    0x22, 0x99, 0xd7, 0xbe, 0xad, 0xc8, 0xaf, 0x3d, 0xdf, 0x58, 0xed, 0x3e,
+    0xe7, 0x87, 0x92, 0x3d, 0x26, 0x22, 0x4f, 0x3d, 0xea, 0x43, 0x02, 0x3f,
+    0xf9, 0x1e, 0x84, 0x3e, 0x89, 0x32, 0x94, 0xbe, 0x47, 0x78, 0x41, 0xbe,
+    0xfd, 0xf0, 0x3d, 0xbe, 0x46, 0xdb, 0xe8, 0x3e, 0x40, 0xfa, 0xd2, 0x3e,
+    0x3d, 0x87, 0xbf, 0x3e, 0x81, 0x8c, 0xe3, 0xbe, 0x80, 0x73, 0x94, 0xbe,
+    0x9f, 0x03, 0xe2, 0x3d, 0x50, 0xec, 0x8e, 0x3e, 0xe7, 0x15, 0xbb, 0x3e,
+    0x5a, 0xc9, 0xf7, 0x3e, 0xf2, 0x07, 0x7c, 0xbd, 0x6d, 0x96, 0x79, 0xbe,
+    0x03, 0xaf, 0xeb, 0x3e, 0xf4, 0x39, 0x08, 0xbf, 0x41, 0x00, 0x42, 0xbe,
+    0xf8, 0xdc, 0x83, 0x3e, 0x4f, 0xb4, 0x8c, 0x3e, 0xdf, 0x99, 0x65, 0xbe,
+    0xdb, 0xc3, 0xd0, 0xbe, 0xd8, 0x6b, 0x9a, 0x3e, 0xad, 0xa9, 0xe2, 0x3e,
+    0xc8, 0x49, 0x76, 0x3e, 0xcf, 0xec, 0xb2, 0xbe, 0x92, 0x55, 0xc4, 0xbe,
+    0xc8, 0x60, 0xb7, 0x3e, 0x6c, 0xcd, 0xb7, 0xbe, 0x3a, 0xf5, 0x87, 0xbe,
+    0xf2, 0xf8, 0xe4, 0x3e, 0x08, 0x52, 0xdb, 0x3e, 0x04, 0x31, 0xb5, 0x3e,
+    0x95, 0xe2, 0xed, 0x3e, 0x82, 0xe7, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
+    0x96, 0xe7, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x11, 0xc6, 0xcf, 0xbd, 0xe9, 0xbc, 0x16, 0x3d, 0x49, 0x6a, 0x00, 0x3e,
+    0x18, 0x78, 0xa8, 0xbd, 0xb2, 0xe7, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x0f, 0xeb, 0x3c,
+    0x15, 0x1d, 0x7a, 0x3d, 0xff, 0x88, 0xa6, 0x3d, 0x34, 0x4a, 0x00, 0xbd,
+    0x30, 0x3e, 0x70, 0x3d, 0x35, 0x93, 0xe6, 0xbc, 0x1b, 0x18, 0xa5, 0xbb,
+    0x72, 0xc3, 0xbe, 0x3c, 0x96, 0x0f, 0x95, 0x3d, 0x3f, 0x7c, 0xa2, 0x3d,
+    0xfb, 0xc5, 0xd3, 0x3d, 0xd6, 0x55, 0xb9, 0xbc, 0x0b, 0x51, 0xc5, 0x3d,
+    0xf9, 0x53, 0xa9, 0xbc, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe7, 0xff, 0xff,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xc0, 0xf5, 0x8e, 0xbd,
+    0x8c, 0x99, 0xa1, 0xbd, 0x70, 0xb5, 0xd0, 0xbe, 0x05, 0x64, 0xa5, 0x3e,
+    0x5d, 0x14, 0x9d, 0x3e, 0x48, 0x0d, 0x85, 0xbe, 0x34, 0xb3, 0x00, 0xbe,
+    0x96, 0xfa, 0x5f, 0x3e, 0x4c, 0x83, 0xc1, 0xbd, 0x24, 0xdd, 0x49, 0xbe,
+    0x90, 0x7a, 0xc4, 0x3c, 0xc0, 0x52, 0xae, 0xbe, 0x10, 0x40, 0xdf, 0x3c,
+    0x45, 0x36, 0x3c, 0xbe, 0xa4, 0xf6, 0xd5, 0xbd, 0xa3, 0x81, 0x4d, 0xbe,
+    0xe2, 0xbc, 0x2e, 0x3f, 0x97, 0x06, 0x1c, 0xbe, 0x62, 0xf9, 0xa3, 0xbe,
+    0xc5, 0xab, 0xe0, 0x3e, 0xe7, 0x75, 0x9c, 0x3d, 0x8e, 0xf8, 0xc7, 0x3d,
+    0x82, 0x6b, 0x27, 0xbe, 0x95, 0x4d, 0xe4, 0x3e, 0xf4, 0xe7, 0xa8, 0x3e,
+    0xef, 0xe9, 0x21, 0x3e, 0xe3, 0x40, 0x87, 0xbe, 0xf3, 0x31, 0xb2, 0xbe,
+    0x91, 0xb3, 0x07, 0xbf, 0x90, 0x35, 0x00, 0x3f, 0x7d, 0x08, 0x0a, 0x3f,
+    0x11, 0x5d, 0x93, 0xbe, 0x1a, 0x52, 0x7e, 0xbc, 0x1a, 0x29, 0x83, 0xbd,
+    0x57, 0x36, 0x07, 0xbf, 0x39, 0x0b, 0x32, 0x3f, 0xd7, 0x2f, 0xf1, 0x3c,
+    0x8f, 0x05, 0x01, 0xbf, 0xab, 0xce, 0x1c, 0x3f, 0xa6, 0x19, 0xf6, 0x3e,
+    0xc5, 0x30, 0x1d, 0xbe, 0x09, 0x8d, 0x12, 0x3e, 0x10, 0x3e, 0x69, 0x3c,
+    0xeb, 0x14, 0x58, 0xbe, 0xa1, 0x29, 0x00, 0xbd, 0x28, 0x6f, 0xa6, 0xbe,
+    0x68, 0x15, 0x0a, 0x3f, 0xd9, 0x67, 0x8d, 0xbe, 0x8e, 0xea, 0x2b, 0xbf,
+    0x75, 0xa6, 0x2b, 0xbf, 0x76, 0x21, 0x11, 0x3f, 0x12, 0x68, 0x41, 0xbe,
+    0xbb, 0x8d, 0xf1, 0x3e, 0xcc, 0xc7, 0x5f, 0x3d, 0xe3, 0x3b, 0xca, 0x3d,
+    0x9d, 0xc2, 0x93, 0x3e, 0xf5, 0xff, 0x76, 0x3e, 0xdd, 0x20, 0x51, 0xbe,
+    0xec, 0xc7, 0x9a, 0x3e, 0xc1, 0x03, 0x26, 0x3f, 0x42, 0x8c, 0xf7, 0x3e,
+    0x24, 0x74, 0x22, 0xbe, 0x5f, 0x9e, 0xfa, 0xbe, 0xe4, 0xba, 0xa7, 0xbd,
+    0xcf, 0xb7, 0xdf, 0x3d, 0x97, 0xcb, 0x50, 0x3e, 0x1a, 0x6f, 0x16, 0xbf,
+    0xbd, 0xf5, 0x0a, 0xbf, 0x8c, 0xd2, 0x6f, 0x3d, 0x2e, 0x68, 0x10, 0x3f,
+    0x02, 0x8f, 0x12, 0xbf, 0x92, 0x6b, 0xac, 0x3e, 0xb5, 0x81, 0xfd, 0xbc,
+    0x75, 0xd2, 0xbe, 0x3e, 0xfa, 0xec, 0x10, 0xbf, 0xe5, 0x9e, 0x12, 0x3f,
+    0xdc, 0xa2, 0xef, 0xbe, 0xca, 0x1e, 0x14, 0x3f, 0x9b, 0x57, 0xc6, 0x3d,
+    0xce, 0x76, 0x51, 0xbe, 0x0a, 0x85, 0x29, 0xbf, 0x58, 0x6b, 0x44, 0x3e,
+    0x1e, 0xc1, 0xee, 0xbe, 0xdc, 0x37, 0x0e, 0x3f, 0x9d, 0x0f, 0x2b, 0x3f,
+    0xd9, 0xd6, 0x9d, 0x3d, 0xed, 0x55, 0x58, 0xbe, 0xae, 0x10, 0x8e, 0x3e,
+    0x9f, 0x4e, 0x68, 0x3e, 0x06, 0xb1, 0x0f, 0x3f, 0x38, 0xb8, 0x00, 0x3f,
+    0xd6, 0x32, 0x41, 0x3e, 0x05, 0xf7, 0x8c, 0xbe, 0xf0, 0x13, 0xcf, 0xbe,
+    0x18, 0x81, 0x31, 0x3e, 0x00, 0x1f, 0xf1, 0x3a, 0xaf, 0x38, 0x62, 0x3e,
+    0x13, 0x8b, 0x31, 0xbd, 0x38, 0x99, 0xb5, 0xbd, 0x46, 0xf8, 0x9f, 0xba,
+    0x1d, 0x69, 0xb3, 0xbe, 0xf1, 0xb7, 0x09, 0xbe, 0x85, 0x67, 0x91, 0xbe,
+    0x95, 0x60, 0x3f, 0xbe, 0x3a, 0x3c, 0xff, 0x3d, 0x72, 0xae, 0xdd, 0xbc,
+    0xeb, 0xff, 0x40, 0x3e, 0xdc, 0x66, 0x4d, 0xbd, 0xa7, 0x9d, 0xc9, 0xbe,
+    0x0f, 0x95, 0xab, 0xbe, 0x3d, 0x56, 0x5f, 0xbe, 0xd2, 0xc7, 0x6d, 0x3e,
+    0x0f, 0xf5, 0x02, 0xbf, 0xe8, 0xeb, 0x95, 0x3e, 0x0e, 0xa5, 0xa5, 0x3e,
+    0x0d, 0xbe, 0xa9, 0x3e, 0x69, 0xbd, 0x9f, 0x3e, 0xc0, 0xa0, 0x39, 0xbe,
+    0xfc, 0x17, 0x80, 0xbd, 0xb2, 0x32, 0x17, 0xbe, 0x5d, 0x5a, 0xc9, 0x3d,
+    0x16, 0x9d, 0x88, 0xbe, 0xa7, 0xb9, 0xff, 0x3e, 0x26, 0xb2, 0x6f, 0x3c,
+    0x46, 0xfb, 0x66, 0xbe, 0xcd, 0x35, 0x06, 0x3f, 0xa0, 0x85, 0xa4, 0xbe,
+    0x00, 0xa1, 0x18, 0xbd, 0xcd, 0x16, 0xeb, 0x3e, 0xd7, 0x95, 0x86, 0xbd,
+    0x8c, 0x76, 0x8c, 0xbe, 0x9f, 0x7e, 0x25, 0x3d, 0xf4, 0xc4, 0xed, 0x3e,
+    0x14, 0x08, 0xb0, 0x3e, 0x6b, 0x9e, 0xa1, 0x3e, 0x14, 0xc0, 0x7a, 0x3d,
+    0xc3, 0x3b, 0x9f, 0xbe, 0x36, 0xdc, 0x20, 0x3e, 0x1a, 0x65, 0x6b, 0x3e,
+    0xdd, 0xd5, 0xc4, 0xbe, 0x34, 0x58, 0xdc, 0xbe, 0x41, 0xab, 0xd6, 0x3d,
+    0x93, 0x6c, 0x85, 0xbe, 0xe0, 0xb8, 0x8f, 0xbc, 0x28, 0x44, 0x03, 0x3f,
+    0xba, 0xd2, 0xf9, 0x3e, 0xf3, 0x80, 0x35, 0xbd, 0x97, 0xc9, 0x1a, 0x3e,
+    0xaf, 0x02, 0xff, 0xbe, 0xa1, 0x74, 0xc6, 0xbe, 0xa7, 0x0b, 0x35, 0x3f,
+    0xa3, 0x0b, 0x10, 0x3f, 0x5a, 0x19, 0xe7, 0x3d, 0x5e, 0x20, 0x63, 0x3d,
+    0x7f, 0x21, 0x21, 0xbd, 0x96, 0xfc, 0x17, 0xbe, 0xcc, 0x14, 0x38, 0xbe,
+    0xcf, 0x2f, 0x78, 0x3e, 0x4a, 0xc8, 0x7f, 0x3d, 0xea, 0x32, 0x60, 0xbe,
+    0x4c, 0x51, 0x16, 0xbe, 0xfe, 0xd3, 0xc0, 0xbe, 0x47, 0xbc, 0x41, 0x3f,
+    0xfd, 0x62, 0xbd, 0x3e, 0xa3, 0x80, 0x03, 0x3f, 0x9f, 0x1e, 0xfb, 0x3e,
+    0x07, 0x37, 0x9f, 0x3e, 0x5b, 0xc3, 0xb3, 0xbe, 0xe1, 0x01, 0x04, 0x3f,
+    0xa6, 0xa5, 0x41, 0xbe, 0x03, 0x01, 0x45, 0x3e, 0xd3, 0x9a, 0xa2, 0x3e,
+    0xd5, 0x76, 0x2a, 0x3f, 0x58, 0xf2, 0xb3, 0xbd, 0x13, 0xf5, 0x08, 0xbf,
+    0x18, 0xca, 0x15, 0xbd, 0x6d, 0x5a, 0xe7, 0x3e, 0xf4, 0x5d, 0x2f, 0xbe,
+    0x3f, 0xcc, 0xc1, 0x3e, 0xf8, 0xfa, 0x76, 0xbe, 0xd4, 0xf4, 0xa4, 0x3e,
+    0x7e, 0x36, 0x0e, 0x3e, 0x67, 0x89, 0xfc, 0x3e, 0xf4, 0x8a, 0xc1, 0x3c,
+    0x2c, 0x9c, 0x27, 0xbe, 0x1f, 0xcb, 0xe6, 0x3d, 0xef, 0xb4, 0x1c, 0xbd,
+    0xd2, 0xac, 0x97, 0xbe, 0x93, 0x07, 0xa4, 0x3e, 0x79, 0x4f, 0x89, 0xbd,
+    0x01, 0x6c, 0x84, 0x3e, 0x47, 0x55, 0xa9, 0x3e, 0x15, 0xec, 0xb3, 0x3e,
+    0x38, 0xdf, 0x3c, 0xbe, 0x4e, 0xee, 0xec, 0x3d, 0x6e, 0x89, 0xcb, 0x3c,
+    0xb6, 0xea, 0x70, 0x3e, 0xba, 0x33, 0xb4, 0xbe, 0x8f, 0x9d, 0x1d, 0xbe,
+    0x82, 0x93, 0x4b, 0x3e, 0x12, 0xf2, 0x84, 0xbe, 0x1a, 0x04, 0x82, 0xbe,
+    0x13, 0xe2, 0x2b, 0x3e, 0x4c, 0xf2, 0x17, 0xbd, 0x55, 0x5a, 0xa0, 0x3b,
+    0xfa, 0x56, 0x9d, 0xbd, 0x08, 0xf5, 0xa4, 0xbe, 0x70, 0xed, 0x0e, 0xbe,
+    0x4f, 0x44, 0x01, 0xbf, 0xcd, 0xe9, 0x86, 0xbc, 0xe6, 0x49, 0xee, 0xbe,
+    0xaf, 0x51, 0xb5, 0xbd, 0x78, 0x88, 0x1c, 0x3f, 0x76, 0x6a, 0x55, 0xbe,
+    0x8b, 0x2e, 0x00, 0x3e, 0xcb, 0x32, 0x4d, 0x3b, 0x94, 0xd0, 0x01, 0xbe,
+    0x94, 0x1d, 0xe7, 0x3e, 0x87, 0xd9, 0x14, 0x3f, 0x31, 0x9c, 0xc6, 0x3e,
+    0x8b, 0x4b, 0x9d, 0x3d, 0xb3, 0x6b, 0x3d, 0xbd, 0x9b, 0x70, 0x88, 0x3e,
+    0x11, 0xff, 0x9d, 0x3e, 0x28, 0x46, 0xcd, 0x3e, 0x54, 0x45, 0x79, 0x3d,
+    0x2b, 0xd1, 0x6d, 0x3e, 0x18, 0x7f, 0x87, 0xbe, 0x18, 0xa2, 0x15, 0x3d,
+    0x90, 0x20, 0x2e, 0xbe, 0x4b, 0xf7, 0x9b, 0x3d, 0x21, 0xf2, 0x0e, 0xbd,
+    0x94, 0xb0, 0x8b, 0x3c, 0xb8, 0xea, 0x95, 0xbe, 0x78, 0x31, 0x1f, 0xbe,
+    0xb7, 0x99, 0x5e, 0xbe, 0x21, 0xa0, 0xd4, 0xbd, 0x3a, 0xb3, 0x35, 0xbe,
+    0xff, 0x9f, 0x1a, 0xbe, 0xa4, 0x84, 0xba, 0xbd, 0xaa, 0xc2, 0xba, 0xbe,
+    0x79, 0xb5, 0xbd, 0xbe, 0x40, 0x19, 0x57, 0xbd, 0xab, 0x12, 0xaa, 0x3e,
+    0x98, 0xdc, 0x92, 0xbd, 0xf0, 0xec, 0x04, 0xbd, 0x80, 0x05, 0x6e, 0xbc,
+    0x20, 0x8a, 0x00, 0xbe, 0x04, 0xd8, 0xfe, 0xbd, 0x86, 0x95, 0x2c, 0x3e,
+    0x74, 0xcd, 0xaa, 0xbd, 0x8c, 0x0f, 0xd3, 0xbd, 0x50, 0x40, 0xb9, 0xbd,
+    0x82, 0x37, 0xa1, 0xbe, 0x7c, 0xbe, 0xa5, 0xbd, 0xd8, 0x23, 0x99, 0xbe,
+    0x0a, 0xec, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x24, 0x82, 0x4f, 0xbe, 0xe0, 0x58, 0x8c, 0xbe, 0xa5, 0xcc, 0xb8, 0xbc,
+    0xc0, 0x7e, 0xd7, 0x3e, 0xa5, 0xdc, 0xeb, 0xbc, 0xa8, 0xff, 0x33, 0x3f,
+    0xc1, 0x85, 0x4d, 0x3d, 0xe5, 0x4c, 0x2c, 0x3f, 0xa6, 0xd2, 0x48, 0xbf,
+    0x62, 0x8c, 0x64, 0xbf, 0x3b, 0x10, 0x9e, 0x3e, 0xe3, 0xd1, 0xb3, 0xbe,
+    0x3f, 0x1b, 0xe5, 0xbe, 0xd6, 0xb0, 0x25, 0x3f, 0x2e, 0x6c, 0x99, 0x3e,
+    0x18, 0x59, 0x68, 0x3e, 0x61, 0xd3, 0x87, 0xbe, 0xf7, 0x7a, 0xed, 0x3e,
+    0xfb, 0x73, 0x05, 0x3f, 0x56, 0xdc, 0x61, 0xbf, 0x36, 0x4f, 0x33, 0xbf,
+    0xac, 0x4c, 0xc2, 0x3e, 0xbb, 0x3e, 0x0a, 0xbe, 0x82, 0xf7, 0x2d, 0xbf,
+    0x03, 0x17, 0xc3, 0x3e, 0x2c, 0x26, 0xe5, 0x3e, 0xc9, 0x78, 0xbd, 0xbe,
+    0x32, 0xca, 0x5a, 0x3f, 0xe3, 0xba, 0x80, 0x3e, 0x88, 0x48, 0xa7, 0x3e,
+    0x13, 0x8f, 0x9e, 0x3e, 0xa4, 0x17, 0x75, 0x3e, 0x3c, 0xc8, 0x65, 0x3e,
+    0x3b, 0xbc, 0x4c, 0xbf, 0x83, 0x2d, 0x7e, 0xbe, 0xad, 0xda, 0x34, 0x3f,
+    0xb9, 0x49, 0x26, 0xbf, 0xb7, 0x4c, 0x49, 0xbf, 0x5a, 0x25, 0x43, 0xbc,
+    0xf8, 0x5e, 0xd5, 0xbe, 0x9a, 0xc4, 0x9f, 0x3e, 0xbe, 0x68, 0x64, 0x3d,
+    0xc4, 0x5d, 0x00, 0x3f, 0x7c, 0x32, 0x12, 0x3f, 0x3b, 0xb2, 0xda, 0x3d,
+    0x28, 0xd0, 0x42, 0xbf, 0x52, 0xde, 0x03, 0xbe, 0xe0, 0x20, 0xad, 0x3e,
+    0x48, 0xe1, 0x07, 0x3e, 0x2e, 0x5e, 0xc1, 0x3e, 0x3b, 0x8a, 0x5f, 0xbf,
+    0x51, 0x65, 0x29, 0xbf, 0x96, 0xe5, 0x3b, 0x3f, 0xb9, 0x5b, 0x29, 0xbe,
+    0x41, 0xa9, 0x14, 0xbe, 0x74, 0xf7, 0x93, 0xbe, 0x4e, 0x72, 0x1f, 0xbf,
+    0x46, 0xb2, 0x81, 0x3e, 0x99, 0x44, 0xd3, 0xbe, 0xa3, 0x7e, 0x17, 0xbf,
+    0x19, 0x52, 0xbc, 0x3e, 0x30, 0x57, 0x7c, 0xbe, 0x6e, 0xa4, 0x0c, 0xbf,
+    0x1c, 0xd3, 0xca, 0xbe, 0x16, 0xed, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x12, 0x00, 0x00, 0xeb, 0xe3, 0x59, 0xbe, 0x6f, 0xfb, 0xf3, 0x3d,
+    0xa0, 0xbc, 0x10, 0x3d, 0x48, 0xf0, 0xbc, 0x3d, 0x24, 0x68, 0x8b, 0xbe,
+    0xda, 0x3b, 0x07, 0x3c, 0xf2, 0x10, 0x7a, 0xbe, 0x8e, 0x22, 0x80, 0xbd,
+    0x64, 0x6f, 0x32, 0x3e, 0xb9, 0xa8, 0xb7, 0x3e, 0x76, 0x29, 0x88, 0x3d,
+    0x79, 0x38, 0xd4, 0x3c, 0xe1, 0x2a, 0x3d, 0xbe, 0x1f, 0x3e, 0xf3, 0x3d,
+    0x16, 0xad, 0xda, 0x3d, 0xad, 0x5f, 0x56, 0x3d, 0xeb, 0x12, 0x6d, 0x3e,
+    0xd5, 0xf7, 0x42, 0x3e, 0x7b, 0xeb, 0xdd, 0x3b, 0xd5, 0x02, 0xf8, 0xbd,
+    0x50, 0x49, 0xcd, 0xbd, 0xac, 0x37, 0x03, 0xbd, 0xf2, 0x02, 0x03, 0xbe,
+    0xcb, 0x2a, 0x4c, 0xbc, 0x35, 0x52, 0xe6, 0xbd, 0x56, 0x81, 0x95, 0x3e,
+    0xcb, 0x51, 0x38, 0xbe, 0x96, 0xf6, 0x97, 0x3c, 0xca, 0xf2, 0x25, 0xbc,
+    0x0f, 0x0d, 0x0b, 0x3e, 0x30, 0x08, 0x85, 0xbd, 0x4a, 0x1b, 0xdb, 0x3c,
+    0x08, 0x30, 0xcb, 0x3e, 0x32, 0xd1, 0x1d, 0xbd, 0x2b, 0x71, 0x8f, 0x3d,
+    0x31, 0xd0, 0x2e, 0xbc, 0xf8, 0xe6, 0x82, 0xbe, 0x26, 0xa1, 0x97, 0x3d,
+    0x71, 0x7d, 0x56, 0xbe, 0x1b, 0x29, 0x4c, 0xbc, 0x15, 0xc9, 0x83, 0x3e,
+    0x63, 0x41, 0x1a, 0xbe, 0xb1, 0xbc, 0x9a, 0x3c, 0xce, 0xb8, 0x48, 0xbe,
+    0x76, 0x41, 0xa5, 0xbd, 0xd5, 0xe5, 0x2b, 0xbe, 0x6e, 0x2a, 0x7e, 0xbe,
+    0x95, 0xb6, 0xe8, 0xbd, 0xa2, 0x01, 0xbb, 0xbd, 0x90, 0xdd, 0x4f, 0x3e,
+    0x31, 0x17, 0x72, 0x3c, 0x65, 0xe1, 0xe6, 0x3d, 0x9a, 0xec, 0x1c, 0xbe,
+    0xe6, 0xb8, 0x0a, 0x3d, 0x6d, 0xe3, 0xde, 0xbc, 0xcf, 0x86, 0x76, 0x3e,
+    0xdc, 0x08, 0xcb, 0x3e, 0x41, 0x74, 0xaf, 0xbd, 0x03, 0xf4, 0xd7, 0x3d,
+    0xe0, 0xb7, 0xab, 0x3e, 0x99, 0xa3, 0x15, 0xbe, 0x69, 0x3f, 0x79, 0xbd,
+    0xa7, 0x5c, 0x6d, 0x3e, 0xf0, 0x62, 0xf0, 0x3e, 0x03, 0x77, 0xb1, 0x3e,
+    0xff, 0x7c, 0xad, 0x3d, 0xb5, 0x9e, 0x15, 0x3e, 0x1c, 0x6c, 0xd5, 0x3d,
+    0x28, 0x1e, 0xc0, 0x3d, 0x09, 0x9f, 0x11, 0xbe, 0x08, 0xac, 0xae, 0xbd,
+    0x78, 0x19, 0x95, 0xbe, 0x6e, 0x72, 0x89, 0xbe, 0x98, 0x63, 0x93, 0x3e,
+    0xcf, 0xf0, 0x86, 0xbd, 0xa6, 0x1e, 0x56, 0xbe, 0x85, 0x18, 0x06, 0xbe,
+    0x95, 0x6d, 0xfc, 0x3d, 0x50, 0xfa, 0xcb, 0xbd, 0xf9, 0x60, 0x2d, 0xbd,
+    0x88, 0x97, 0x84, 0x3c, 0x01, 0xab, 0xaa, 0x3e, 0x98, 0xb8, 0x55, 0x3e,
+    0x2b, 0xed, 0xc3, 0x3d, 0x78, 0xa1, 0x01, 0xbe, 0xb2, 0xf9, 0x64, 0x3e,
+    0x95, 0x2e, 0x49, 0x3e, 0x28, 0x20, 0x88, 0x3e, 0x0b, 0xd5, 0x03, 0x3e,
+    0x10, 0x71, 0xe8, 0x3d, 0xe7, 0x1f, 0xe9, 0xbd, 0xf5, 0x79, 0x8c, 0x3d,
+    0xcc, 0xff, 0x29, 0x3e, 0x57, 0xd0, 0xbf, 0x3d, 0x31, 0xe9, 0x7e, 0x3c,
+    0xd2, 0x72, 0x20, 0xbd, 0xb8, 0xde, 0x97, 0xbd, 0xb5, 0x20, 0xc0, 0x3d,
+    0xe9, 0x54, 0xfb, 0x3d, 0xfd, 0x40, 0x80, 0x3e, 0xe4, 0xc5, 0xa9, 0xbc,
+    0xbb, 0x01, 0x0e, 0x3e, 0xf0, 0xf6, 0x1e, 0xbe, 0x26, 0xa2, 0x8b, 0x3e,
+    0xde, 0x49, 0xaa, 0x3e, 0x76, 0x0b, 0x90, 0x3d, 0x4f, 0x5d, 0x3f, 0x3e,
+    0x6c, 0x87, 0x61, 0x3e, 0x62, 0xf9, 0xe4, 0xbc, 0xfe, 0x9f, 0x4a, 0xbc,
+    0xd0, 0x88, 0x47, 0xbe, 0x62, 0xbb, 0x6e, 0x3d, 0xa3, 0x19, 0x0d, 0xbe,
+    0x0f, 0x58, 0x35, 0xbe, 0xe9, 0xc1, 0x23, 0xbe, 0xfb, 0xeb, 0xf8, 0xbd,
+    0xf2, 0xca, 0x98, 0xbd, 0xce, 0xf6, 0x9d, 0xbe, 0xfd, 0x68, 0x95, 0xbe,
+    0xae, 0x9b, 0xaf, 0xbe, 0x6e, 0x39, 0x34, 0xbb, 0xc5, 0x03, 0xf4, 0x3d,
+    0xf7, 0xf4, 0x27, 0x3d, 0xb2, 0x09, 0x4d, 0xbd, 0x8a, 0x1e, 0xbc, 0x3d,
+    0x45, 0x03, 0x5e, 0x3e, 0x15, 0x81, 0x40, 0x3e, 0xfe, 0x12, 0x0f, 0x3e,
+    0x82, 0xb9, 0x94, 0x3e, 0x9a, 0xc2, 0x30, 0xbd, 0xd9, 0xc4, 0x0d, 0x3d,
+    0x97, 0x6e, 0xa3, 0x3e, 0x7d, 0xd4, 0x36, 0xbe, 0x55, 0x7e, 0xd6, 0xbd,
+    0xf3, 0x10, 0x74, 0xbb, 0x70, 0xd5, 0x35, 0x3e, 0x7a, 0x68, 0x59, 0x3d,
+    0xac, 0xa6, 0xed, 0xbd, 0xc4, 0x19, 0x08, 0xbe, 0x65, 0xdf, 0x8b, 0xbe,
+    0x9c, 0xb8, 0x75, 0xbe, 0xe0, 0x3b, 0xf8, 0xbd, 0x03, 0xdb, 0x75, 0xbe,
+    0xc7, 0x2e, 0x22, 0x3e, 0x29, 0xa7, 0xa6, 0x3e, 0xe1, 0x95, 0x21, 0x3e,
+    0xcc, 0x4f, 0x11, 0x3e, 0x4f, 0x77, 0x30, 0x3e, 0x8c, 0x2a, 0x8a, 0x3e,
+    0xa9, 0x23, 0xc9, 0x3d, 0x18, 0x40, 0x55, 0x3e, 0x06, 0x12, 0x11, 0x3e,
+    0xf0, 0xc0, 0x1b, 0x3e, 0x19, 0x9f, 0xfd, 0xbd, 0xa8, 0x6b, 0x6c, 0x3e,
+    0xec, 0x4e, 0x4b, 0xbd, 0xe2, 0xdf, 0xb0, 0x3d, 0x1f, 0x91, 0x0b, 0xbe,
+    0xf4, 0x13, 0x57, 0x3d, 0x65, 0x66, 0x44, 0x3e, 0x14, 0xf8, 0x25, 0x3c,
+    0xcc, 0x09, 0x8e, 0xbe, 0xa5, 0x05, 0xa3, 0xbd, 0xf4, 0xea, 0x14, 0x3d,
+    0x63, 0x48, 0xaf, 0x3d, 0xfd, 0x6f, 0x92, 0x3e, 0x5c, 0xec, 0x35, 0xbe,
+    0xd4, 0x09, 0xad, 0x3c, 0x0a, 0x36, 0xae, 0x3e, 0x3f, 0x70, 0xc4, 0x3d,
+    0x83, 0x00, 0x17, 0x3d, 0x20, 0xcf, 0xb5, 0xbd, 0x84, 0xf3, 0x08, 0x3e,
+    0x53, 0xda, 0xa0, 0xbe, 0xf4, 0x98, 0x8e, 0x3e, 0x41, 0xb0, 0x8f, 0xbe,
+    0x7b, 0xb6, 0x98, 0xbd, 0x6e, 0x89, 0x36, 0xbd, 0x11, 0x97, 0xfc, 0x3d,
+    0x46, 0x0f, 0x89, 0xbe, 0x16, 0x83, 0xe1, 0xbd, 0x8e, 0x90, 0x70, 0xbe,
+    0x1a, 0x5e, 0x9d, 0x3e, 0x84, 0x89, 0xbc, 0xbe, 0x3d, 0x7a, 0x3d, 0x3e,
+    0x29, 0x1e, 0xc9, 0x3b, 0x89, 0x0b, 0x28, 0x3e, 0x53, 0xe1, 0x3c, 0x3c,
+    0xc5, 0xe8, 0xe3, 0x3d, 0xd6, 0xa3, 0x1b, 0x3e, 0x3e, 0xa6, 0xb6, 0x3e,
+    0xe4, 0xb6, 0xa6, 0x3e, 0xdc, 0x80, 0x89, 0xbe, 0xf3, 0x09, 0xdb, 0xbd,
+    0x51, 0x74, 0xa7, 0xbe, 0x0f, 0xb9, 0x80, 0xbe, 0xe6, 0x4f, 0x80, 0x3c,
+    0xbd, 0xfb, 0xa1, 0xbe, 0x0d, 0xbc, 0x99, 0xbc, 0xd5, 0xb3, 0xd3, 0xbd,
+    0x3e, 0xc3, 0x02, 0x3e, 0xb7, 0xbd, 0x94, 0x3e, 0x9d, 0x96, 0xd3, 0xbd,
+    0x16, 0xfe, 0xb2, 0xbd, 0xce, 0x06, 0xee, 0x3d, 0x62, 0x5b, 0x36, 0xbe,
+    0xf6, 0x34, 0x54, 0x3e, 0xeb, 0x87, 0xd6, 0x3d, 0x72, 0x9c, 0xb0, 0xbb,
+    0xfc, 0x01, 0x47, 0x3e, 0x07, 0x68, 0xda, 0x3d, 0x87, 0x6e, 0x3b, 0x3e,
+    0xe0, 0x9c, 0x8b, 0x3e, 0x50, 0x31, 0x2a, 0x3e, 0xc8, 0x69, 0xcc, 0x3e,
+    0x8a, 0x5f, 0xfd, 0xbd, 0x45, 0x7e, 0xc5, 0xbd, 0x75, 0xdc, 0x3b, 0x3d,
+    0x03, 0x69, 0x6a, 0x3e, 0xc1, 0xaf, 0xe2, 0x3d, 0x9b, 0xe8, 0x40, 0x3e,
+    0xb6, 0x4e, 0x2e, 0x3e, 0x81, 0xf3, 0x9a, 0x3e, 0x17, 0x2d, 0x33, 0x3e,
+    0x78, 0x0f, 0x6d, 0x3e, 0x39, 0x51, 0x49, 0x3e, 0xf7, 0x4c, 0x25, 0x3e,
+    0x2d, 0x36, 0x9e, 0x3d, 0xc3, 0xab, 0xe1, 0x3d, 0x2e, 0x43, 0xa6, 0x3d,
+    0x0a, 0xea, 0x06, 0x3e, 0x94, 0xca, 0x85, 0x3e, 0x4a, 0x79, 0x93, 0x3d,
+    0xb8, 0xd2, 0x36, 0x3e, 0x45, 0xd8, 0x94, 0x3e, 0xf9, 0xf9, 0x41, 0x3e,
+    0x2f, 0xc9, 0xb0, 0x3e, 0x98, 0x6b, 0x01, 0x3e, 0xe7, 0x23, 0x59, 0x3e,
+    0x71, 0xca, 0x37, 0x3d, 0xe5, 0xd6, 0xca, 0xbe, 0xfc, 0xff, 0xad, 0x3d,
+    0xd3, 0x34, 0xa0, 0x3d, 0x64, 0x65, 0x1e, 0x3c, 0x8a, 0x72, 0x44, 0x3c,
+    0x48, 0xfd, 0x21, 0xbd, 0x58, 0x3e, 0x30, 0xbe, 0xac, 0xfb, 0x0c, 0x3d,
+    0x3f, 0xe8, 0x02, 0xbe, 0xcd, 0x60, 0x1f, 0xbe, 0xa5, 0x27, 0x14, 0x3e,
+    0x6e, 0x73, 0x46, 0x3e, 0x46, 0xd3, 0x55, 0xbe, 0x1e, 0x4d, 0x34, 0xbe,
+    0xa3, 0x14, 0xe2, 0xbe, 0x5d, 0x1a, 0x80, 0xbd, 0xbc, 0x1c, 0x42, 0xbe,
+    0x4e, 0x98, 0xf2, 0xbd, 0xd9, 0x22, 0x99, 0xbe, 0xae, 0x31, 0x18, 0x3e,
+    0x79, 0xda, 0x2d, 0xbe, 0x1a, 0xa2, 0xaa, 0x3d, 0x94, 0x51, 0xcc, 0xbe,
+    0xbf, 0x97, 0x77, 0xbe, 0x25, 0xc5, 0xdb, 0x3e, 0x0e, 0x5e, 0xb4, 0x3e,
+    0x56, 0x72, 0x32, 0x3e, 0xbe, 0x9e, 0xd6, 0x3d, 0xf1, 0xcf, 0x45, 0xbe,
+    0xde, 0x56, 0x6d, 0x3e, 0xa4, 0xf2, 0x95, 0xbc, 0xd3, 0xca, 0x00, 0x3e,
+    0x6f, 0x5d, 0xb0, 0xbc, 0xb2, 0x69, 0x5a, 0x3c, 0x65, 0xa8, 0x6c, 0xbc,
+    0xd9, 0xa2, 0x2f, 0x3e, 0x44, 0x73, 0x80, 0x3d, 0x47, 0x4b, 0x99, 0x3e,
+    0xa5, 0x3e, 0x95, 0xbd, 0xdd, 0xd3, 0x53, 0x3e, 0x38, 0xdd, 0x96, 0xbe,
+    0x7c, 0xf2, 0x77, 0xba, 0xff, 0x44, 0xaa, 0xbe, 0xa1, 0xd5, 0x0c, 0xbe,
+    0xfc, 0x37, 0x82, 0xbe, 0x4a, 0xb4, 0xa8, 0x3c, 0xfd, 0x56, 0x4c, 0xbd,
+    0x0b, 0xba, 0xd4, 0x3e, 0x47, 0xca, 0xbe, 0xb9, 0x5f, 0x54, 0x49, 0xbd,
+    0xe9, 0x47, 0xfa, 0x3d, 0x30, 0x40, 0xc9, 0x3d, 0x86, 0xfe, 0x9b, 0x3e,
+    0x1d, 0xa3, 0x3f, 0x3d, 0x3b, 0x6f, 0x74, 0x3e, 0x62, 0x70, 0x2d, 0x3e,
+    0xfd, 0x92, 0x42, 0xbe, 0x0f, 0x2f, 0x7a, 0x3b, 0xe3, 0x4b, 0x66, 0x3e,
+    0x0b, 0xdf, 0x37, 0x3e, 0xce, 0x44, 0x8b, 0x3e, 0x24, 0x9e, 0x85, 0x3e,
+    0xd5, 0xa4, 0x3e, 0x3e, 0xfa, 0xe0, 0x88, 0x3e, 0x4a, 0x48, 0xa3, 0x3d,
+    0xa5, 0x88, 0xe2, 0x3d, 0xe7, 0x0b, 0x9c, 0x3e, 0xa7, 0x51, 0x87, 0x3e,
+    0xb6, 0xed, 0x6a, 0x3d, 0x10, 0x77, 0x30, 0x3e, 0xb7, 0xb7, 0x97, 0x3e,
+    0x1e, 0x24, 0xee, 0x3d, 0x35, 0x5e, 0xbb, 0xbd, 0xc4, 0xc4, 0xe0, 0xbd,
+    0xcd, 0xac, 0xca, 0xbd, 0x3a, 0x81, 0xfb, 0x3d, 0xe2, 0xc9, 0x9b, 0x3d,
+    0xde, 0xb6, 0x14, 0xbe, 0xbc, 0x21, 0x98, 0xbd, 0x70, 0x84, 0xa3, 0xbd,
+    0x47, 0x78, 0x40, 0xbe, 0xf7, 0x39, 0xe0, 0xbc, 0x65, 0x85, 0x17, 0x3e,
+    0xc6, 0x66, 0xd1, 0x3d, 0x5d, 0xab, 0x15, 0xbe, 0xd0, 0xcc, 0x00, 0x3e,
+    0xb2, 0x4a, 0x06, 0xbe, 0x0c, 0x5c, 0x04, 0xbe, 0xfd, 0x83, 0x69, 0x3d,
+    0xeb, 0x00, 0x10, 0xbe, 0xdc, 0x77, 0x85, 0xbd, 0x98, 0x11, 0xe0, 0x3d,
+    0x84, 0x79, 0x13, 0x3d, 0x5f, 0x36, 0x38, 0x3e, 0xe0, 0x2f, 0x2a, 0xbe,
+    0xc1, 0xda, 0x4b, 0xbe, 0x01, 0x25, 0x22, 0x3d, 0x72, 0x18, 0x16, 0x3d,
+    0x3b, 0x81, 0x37, 0xbe, 0xa1, 0x38, 0x74, 0xbe, 0xb0, 0x48, 0x07, 0xbe,
+    0x31, 0xc5, 0x7d, 0xbe, 0x5c, 0x99, 0xcc, 0xbd, 0x74, 0x84, 0x89, 0xbd,
+    0xf1, 0xfd, 0x52, 0xbe, 0xa8, 0x54, 0x35, 0x3e, 0x55, 0xc5, 0xaf, 0xbe,
+    0x5e, 0x69, 0x64, 0xbc, 0x53, 0x93, 0x45, 0xbe, 0x6c, 0x67, 0x8a, 0x3e,
+    0xf0, 0x0f, 0x47, 0x3d, 0x0c, 0xf4, 0x09, 0x3e, 0x93, 0xd5, 0x52, 0xbe,
+    0xa0, 0x53, 0xb3, 0xbd, 0x57, 0x29, 0x59, 0xbe, 0x73, 0x2a, 0x19, 0xbe,
+    0xc8, 0xf8, 0x76, 0xbe, 0x57, 0x79, 0xd2, 0x3c, 0xe1, 0x97, 0xff, 0xbd,
+    0xed, 0x08, 0x12, 0x3e, 0x46, 0x80, 0xac, 0x3b, 0xeb, 0x11, 0x1c, 0xbe,
+    0x8a, 0x46, 0x3f, 0xbe, 0x84, 0x6f, 0x38, 0xbe, 0x69, 0x97, 0x07, 0x3c,
+    0x87, 0x5a, 0x95, 0xbe, 0x16, 0xeb, 0x55, 0xbe, 0xf6, 0x3e, 0x4c, 0xbe,
+    0x4c, 0x60, 0x6f, 0xbe, 0xca, 0xc7, 0x17, 0xbd, 0x20, 0x7f, 0x56, 0xbd,
+    0xd5, 0x70, 0xbd, 0xbd, 0x48, 0x16, 0x35, 0xbe, 0xb8, 0x9d, 0x45, 0x3e,
+    0x60, 0x5a, 0x8f, 0xbd, 0x99, 0xa0, 0xff, 0x3d, 0x11, 0x84, 0x5b, 0x3d,
+    0x86, 0x62, 0xda, 0x3d, 0x60, 0xc0, 0x89, 0xbe, 0xb8, 0xb1, 0xe8, 0xbd,
+    0x41, 0xc5, 0x45, 0x3d, 0xda, 0x16, 0x74, 0xbd, 0xa8, 0xc7, 0x3d, 0x3e,
+    0x52, 0xe7, 0x5f, 0x3d, 0xa8, 0x42, 0xa9, 0x3e, 0xe6, 0xae, 0x1c, 0xbe,
+    0xbf, 0xc4, 0x05, 0x3e, 0xc1, 0xc0, 0x15, 0x3e, 0xd8, 0x9e, 0xed, 0x3d,
+    0x7b, 0x4b, 0xb7, 0xbc, 0xee, 0x7b, 0xd4, 0x3e, 0xad, 0x1f, 0xd6, 0xbd,
+    0xba, 0xdf, 0x33, 0x3e, 0xd9, 0xfc, 0x02, 0x3e, 0xb4, 0xa7, 0x90, 0x3e,
+    0x63, 0xdf, 0x01, 0x3d, 0x24, 0x5c, 0xf8, 0x3c, 0xab, 0x54, 0x1e, 0x3e,
+    0xc3, 0x8d, 0xc1, 0x3e, 0xe1, 0x3f, 0xbb, 0x3c, 0x04, 0x51, 0xeb, 0x3a,
+    0x81, 0xed, 0xbd, 0x3e, 0x13, 0xd3, 0x55, 0x3e, 0xe5, 0x7b, 0x11, 0xbc,
+    0x23, 0x2f, 0xa6, 0x3e, 0xce, 0xc5, 0x48, 0x3e, 0x89, 0x96, 0x02, 0x3e,
+    0xa4, 0x09, 0xb0, 0x3e, 0x7d, 0xf5, 0x56, 0xbe, 0x29, 0x7b, 0x21, 0xbe,
+    0x27, 0xfd, 0x20, 0x3e, 0x5d, 0x91, 0x66, 0x3e, 0x69, 0xe0, 0xa9, 0x3e,
+    0x7f, 0x79, 0xc4, 0xbc, 0xc3, 0x63, 0xe5, 0x3d, 0x42, 0x40, 0x44, 0xbe,
+    0xd5, 0x70, 0x12, 0xbe, 0x22, 0x8f, 0xd1, 0x3c, 0x48, 0xfb, 0x1c, 0x3e,
+    0x4a, 0xd1, 0x30, 0x3e, 0xff, 0xbd, 0x3e, 0x3e, 0x51, 0x42, 0xb2, 0xbd,
+    0xce, 0xff, 0x40, 0x3e, 0xdc, 0x46, 0x70, 0xbe, 0x04, 0x01, 0x31, 0x3e,
+    0xd9, 0xc9, 0x01, 0xbe, 0xfa, 0xb0, 0x86, 0x3e, 0x64, 0x6d, 0x5e, 0x3d,
+    0x45, 0xc8, 0x80, 0x3e, 0x81, 0x77, 0xf9, 0x3d, 0xb8, 0x46, 0x92, 0x3d,
+    0x73, 0x8a, 0x4f, 0x3c, 0x7b, 0x48, 0xd8, 0x3e, 0xcd, 0x67, 0xbe, 0x3e,
+    0x85, 0xb4, 0x68, 0x3e, 0x90, 0x2d, 0x5b, 0x3e, 0x3d, 0x8c, 0x25, 0x3d,
+    0x41, 0x04, 0x9f, 0x3e, 0x12, 0x1e, 0x8a, 0x3d, 0xc4, 0xce, 0x3b, 0x3e,
+    0xb8, 0xf7, 0x94, 0x3e, 0xcf, 0x9c, 0x62, 0x3d, 0x71, 0x27, 0x30, 0x3e,
+    0xa4, 0xc2, 0xb4, 0xbb, 0x4d, 0x53, 0x39, 0x3d, 0x88, 0x30, 0xb3, 0xbd,
+    0x26, 0x4f, 0xc4, 0x3e, 0x89, 0xa0, 0x56, 0x3e, 0xcc, 0x71, 0x39, 0x3d,
+    0x4a, 0x39, 0xc4, 0x3d, 0xe0, 0x6d, 0x15, 0x3e, 0x63, 0x4e, 0x30, 0x3e,
+    0x4e, 0x1d, 0x7f, 0xbd, 0x3f, 0xe5, 0xfd, 0xbd, 0x3a, 0x0d, 0x82, 0x3d,
+    0x83, 0x48, 0x26, 0xbe, 0x8a, 0x37, 0x3c, 0xbe, 0xa2, 0xe4, 0x72, 0x3d,
+    0xb6, 0x55, 0xac, 0xbe, 0xe4, 0x63, 0x77, 0xbe, 0x7e, 0x3a, 0xd4, 0xbe,
+    0x00, 0xea, 0x3d, 0xbe, 0x76, 0xb8, 0x47, 0xbe, 0x4f, 0x14, 0x35, 0xbe,
+    0x68, 0xa9, 0x80, 0x3e, 0xb8, 0x41, 0xdb, 0x3d, 0x41, 0x01, 0x5d, 0xbe,
+    0xc4, 0xd8, 0xc9, 0xb8, 0x63, 0x15, 0xcc, 0xbd, 0x7c, 0xe7, 0x64, 0xbd,
+    0xab, 0x30, 0x48, 0xbd, 0x93, 0x6c, 0x04, 0xbd, 0x83, 0xe9, 0xa1, 0x3e,
+    0xe3, 0x4a, 0x8f, 0xbe, 0x5f, 0x2c, 0x0a, 0x3d, 0x08, 0x86, 0xa3, 0x3d,
+    0xa6, 0x38, 0x17, 0x3d, 0x53, 0x01, 0x9d, 0xbe, 0x35, 0x92, 0x39, 0x3c,
+    0xb8, 0xa9, 0x8c, 0xbd, 0x34, 0x97, 0xc6, 0x3e, 0xb7, 0xf9, 0xd3, 0x3e,
+    0x2d, 0x04, 0xb0, 0xbe, 0x24, 0x70, 0x72, 0xbc, 0x4a, 0xbb, 0x79, 0xbe,
+    0xfc, 0xe5, 0x0c, 0x3e, 0x33, 0xf6, 0x64, 0xbd, 0xb5, 0xc6, 0xea, 0x3c,
+    0xe6, 0x04, 0x88, 0x3e, 0x6d, 0x2a, 0xed, 0x3e, 0x6d, 0x18, 0x61, 0xbd,
+    0x6f, 0xfb, 0x95, 0x3b, 0x63, 0xc3, 0x8b, 0x3c, 0xdf, 0xb3, 0xab, 0x3e,
+    0xc0, 0x35, 0x94, 0x3e, 0x35, 0xf0, 0xca, 0x3e, 0xba, 0xa5, 0xa4, 0x3d,
+    0x84, 0xd3, 0x86, 0x3e, 0xb4, 0x13, 0x3a, 0x3e, 0x14, 0x46, 0xd3, 0x3e,
+    0x12, 0x20, 0x46, 0x3e, 0x4a, 0x00, 0xde, 0x3e, 0xef, 0x4a, 0xf1, 0x3d,
+    0xda, 0x71, 0xa9, 0xbb, 0xc2, 0x23, 0x89, 0xbd, 0x77, 0x33, 0x24, 0x3e,
+    0x6b, 0xc8, 0x33, 0x3e, 0x20, 0x70, 0x18, 0xbd, 0x78, 0xdb, 0x74, 0xbd,
+    0x36, 0xbf, 0x83, 0x3e, 0x95, 0x81, 0xbc, 0x3c, 0x43, 0xeb, 0xd6, 0xbc,
+    0xd2, 0x81, 0xa2, 0x3e, 0x45, 0xa2, 0x8f, 0x3e, 0xe3, 0x39, 0x28, 0x3e,
+    0x0b, 0xee, 0x4c, 0x3e, 0x4a, 0x00, 0xfb, 0xbd, 0x43, 0x94, 0x89, 0x3d,
+    0xc2, 0x6d, 0x85, 0x3d, 0x2e, 0xfa, 0x1b, 0x3e, 0x3c, 0xbb, 0x58, 0x3d,
+    0x23, 0xa2, 0x9b, 0x3e, 0x77, 0x31, 0xbd, 0xbd, 0xee, 0x1e, 0xce, 0xbc,
+    0x79, 0xee, 0x85, 0xbd, 0xa2, 0xb4, 0xe8, 0x3d, 0x3e, 0x99, 0xab, 0x3d,
+    0xa6, 0x69, 0x09, 0x3e, 0xe1, 0xf5, 0x9a, 0xbd, 0x71, 0x40, 0x29, 0x3d,
+    0x18, 0x52, 0x0c, 0x3e, 0xa2, 0x0d, 0x84, 0x3e, 0x48, 0x70, 0x11, 0xbe,
+    0x47, 0x2e, 0xa9, 0x3d, 0x61, 0xc7, 0x53, 0xbc, 0x8d, 0xe3, 0xac, 0x3e,
+    0xe5, 0x13, 0x82, 0x3e, 0x05, 0x93, 0x98, 0x3e, 0x4d, 0x7c, 0x94, 0x3e,
+    0x9c, 0x1e, 0x8e, 0x3e, 0x90, 0x5b, 0x59, 0x3e, 0x6d, 0xc8, 0x21, 0x3d,
+    0x3c, 0x55, 0x34, 0x3d, 0x55, 0x0d, 0x7a, 0x3e, 0xa2, 0xe4, 0xa9, 0x3e,
+    0x6d, 0x96, 0x11, 0xbd, 0x7a, 0x1d, 0x1f, 0x3e, 0x85, 0xfb, 0x8a, 0x3d,
+    0x46, 0x72, 0x80, 0x3d, 0x43, 0x89, 0x03, 0xbe, 0x6a, 0xc8, 0x6b, 0xbe,
+    0x92, 0x93, 0x32, 0xbd, 0x1e, 0x87, 0x03, 0x3e, 0x20, 0xa7, 0x9e, 0x3d,
+    0x6b, 0xb7, 0xf8, 0x3d, 0x60, 0x9c, 0x52, 0x3e, 0xcd, 0x19, 0x3c, 0x3d,
+    0xdf, 0xed, 0xce, 0x3d, 0x0a, 0xa5, 0x23, 0x3e, 0x4b, 0x12, 0xe5, 0x3d,
+    0x5e, 0xae, 0xa6, 0x3e, 0x52, 0x4e, 0x04, 0x3e, 0x4b, 0xaf, 0x86, 0x3e,
+    0x48, 0xf9, 0x55, 0x3e, 0x2a, 0xf3, 0x6f, 0x3d, 0x34, 0xdb, 0x81, 0x3e,
+    0x96, 0xe9, 0x3b, 0x3d, 0xe9, 0xeb, 0x92, 0x3e, 0x9c, 0x86, 0x67, 0x3e,
+    0xa8, 0xe3, 0x0c, 0xbe, 0x28, 0x2d, 0xa1, 0x3d, 0x7a, 0xd2, 0xd2, 0xbd,
+    0x58, 0x60, 0xda, 0xbc, 0xf4, 0x2d, 0x50, 0xbc, 0x42, 0x58, 0x48, 0x3d,
+    0x47, 0x36, 0x7b, 0x3e, 0x07, 0x75, 0x5d, 0x3d, 0x21, 0xb4, 0x09, 0xbd,
+    0xba, 0x52, 0x50, 0x3e, 0x01, 0x46, 0xcf, 0x3d, 0x0f, 0x8f, 0x7b, 0x3e,
+    0xca, 0x32, 0x18, 0x3e, 0x1d, 0x9f, 0x7a, 0x3e, 0xd7, 0x00, 0x9c, 0x3e,
+    0x97, 0x1c, 0x3f, 0x3e, 0xcc, 0x34, 0x9a, 0x3d, 0xfe, 0x6c, 0x84, 0x3d,
+    0x06, 0x19, 0x9f, 0x3e, 0xc9, 0x73, 0x6c, 0x3e, 0x6d, 0xcf, 0xb6, 0x3d,
+    0x01, 0xd3, 0x3a, 0x3e, 0xba, 0x01, 0x09, 0x3c, 0xde, 0x3f, 0x5d, 0xbe,
+    0x28, 0xa3, 0xcd, 0xbd, 0x7d, 0xb0, 0xa1, 0xbd, 0x91, 0x5a, 0x4b, 0x3d,
+    0x17, 0xdc, 0xd9, 0x3c, 0x60, 0xda, 0xa8, 0x3e, 0x3f, 0x78, 0x27, 0xbc,
+    0xda, 0xf4, 0xd8, 0x3d, 0x8d, 0x5b, 0x6d, 0x3e, 0x55, 0x15, 0xbd, 0x3b,
+    0x4a, 0x40, 0xd7, 0x3d, 0xf2, 0xcc, 0xbb, 0x3e, 0x7e, 0x0b, 0x58, 0x3e,
+    0x3e, 0x6c, 0x40, 0x3e, 0x04, 0x53, 0x45, 0x3e, 0x2c, 0x9a, 0xa7, 0x3e,
+    0xbf, 0x3f, 0x62, 0x3e, 0x6e, 0x77, 0xa9, 0x3d, 0x59, 0x00, 0xfd, 0x3d,
+    0x6c, 0xf2, 0x92, 0x3d, 0x1e, 0x10, 0x86, 0x3d, 0x3d, 0x6b, 0x9e, 0x3b,
+    0x28, 0xa4, 0xd4, 0x3d, 0x03, 0xba, 0x03, 0x3e, 0x66, 0xba, 0xd9, 0xbd,
+    0xad, 0xea, 0x36, 0x3c, 0xb1, 0xb2, 0xa0, 0xbd, 0xf9, 0xed, 0x04, 0xbd,
+    0x25, 0xcf, 0x50, 0x3e, 0x53, 0xbb, 0x51, 0x3e, 0xa7, 0x02, 0x63, 0x3e,
+    0x7e, 0xfb, 0xc0, 0x3e, 0xdd, 0x6f, 0x74, 0x3e, 0x30, 0xc5, 0x88, 0x3e,
+    0x53, 0xae, 0x6d, 0x3d, 0x68, 0x7c, 0xd3, 0x3d, 0x4e, 0xbe, 0xa2, 0x3e,
+    0x2a, 0x9e, 0xbd, 0x3d, 0xa6, 0x2d, 0x33, 0x3e, 0x80, 0xe3, 0x81, 0x3e,
+    0x5c, 0xec, 0x0c, 0xbe, 0x42, 0x07, 0xb6, 0x3d, 0x60, 0xf7, 0x4f, 0x3e,
+    0xc8, 0xf1, 0x62, 0xbe, 0x72, 0x98, 0x03, 0x3e, 0xef, 0x63, 0xdf, 0x3a,
+    0x97, 0xc5, 0x27, 0xbe, 0xd7, 0x72, 0xa8, 0xbe, 0xab, 0x1c, 0xd7, 0xbd,
+    0x37, 0x43, 0x30, 0x3e, 0x7e, 0x7f, 0x4f, 0xbc, 0x41, 0x41, 0x33, 0x3e,
+    0x41, 0x26, 0x76, 0x3e, 0x89, 0x7b, 0x27, 0x3e, 0xc7, 0xc8, 0x5f, 0x3e,
+    0x9f, 0x43, 0x4e, 0x3e, 0x08, 0x17, 0xa6, 0xbe, 0x16, 0xef, 0x70, 0xbc,
+    0x08, 0x86, 0xaf, 0xbd, 0x8c, 0x50, 0x8a, 0xbe, 0x0b, 0xa0, 0x77, 0xbe,
+    0x52, 0xfe, 0x3f, 0xbe, 0x05, 0x60, 0x65, 0xbe, 0x7d, 0x74, 0x61, 0xbb,
+    0x97, 0xf4, 0x48, 0xbc, 0x2d, 0x72, 0x9d, 0x3d, 0xe8, 0x6a, 0x28, 0xbe,
+    0x35, 0x4c, 0x14, 0x3d, 0x53, 0xed, 0x9e, 0xbb, 0x51, 0xc8, 0x5f, 0x3e,
+    0x96, 0x14, 0xe1, 0xbd, 0x55, 0x7c, 0xc5, 0xbd, 0xad, 0x48, 0x6f, 0x3d,
+    0x09, 0xe0, 0x7e, 0x3e, 0x97, 0xa4, 0x21, 0x3e, 0x6e, 0x42, 0x57, 0x3e,
+    0x7d, 0xd0, 0xb9, 0x3c, 0x8b, 0x44, 0x98, 0xbd, 0x84, 0xe1, 0xca, 0x3d,
+    0x96, 0xa7, 0x3d, 0x3e, 0x5b, 0x1c, 0x95, 0xbe, 0x46, 0x27, 0x6f, 0x3e,
+    0x67, 0xcf, 0x55, 0xbd, 0x50, 0x9a, 0xb2, 0x3e, 0xd2, 0x6c, 0x1c, 0x3c,
+    0x6d, 0x40, 0xf3, 0x3d, 0x79, 0xc7, 0x9a, 0xbd, 0x45, 0xdb, 0xbf, 0x3d,
+    0x58, 0xd2, 0x75, 0xbe, 0x73, 0xd4, 0xa5, 0xbc, 0x3a, 0xa7, 0x4b, 0x3d,
+    0x91, 0x09, 0xba, 0x3e, 0xbf, 0x54, 0xc0, 0xbc, 0xa0, 0x53, 0x76, 0x3e,
+    0x9d, 0x59, 0xcc, 0xbd, 0x29, 0x76, 0xbb, 0x3e, 0x7d, 0x08, 0x04, 0x3d,
+    0xba, 0xeb, 0x05, 0xbc, 0xba, 0x2d, 0x41, 0xbb, 0xe0, 0xd4, 0x70, 0x3e,
+    0x06, 0x0b, 0x23, 0x3e, 0xd2, 0x09, 0x55, 0x3d, 0x5b, 0xa1, 0x73, 0xbd,
+    0x8f, 0xca, 0xb2, 0x3d, 0x18, 0xe7, 0x69, 0x3e, 0x2f, 0x81, 0x71, 0x3e,
+    0x09, 0xa2, 0xc4, 0x3e, 0x38, 0x17, 0xa6, 0x3e, 0x68, 0x6c, 0xd4, 0x3d,
+    0x39, 0xb8, 0x99, 0x3e, 0x88, 0xb1, 0xb5, 0x3d, 0x12, 0x1e, 0x8c, 0x3e,
+    0x11, 0xc6, 0x8e, 0x3d, 0xc9, 0xe6, 0x20, 0xbd, 0xb5, 0xb3, 0xa0, 0x3e,
+    0xb1, 0x15, 0x05, 0x3e, 0xf3, 0x6e, 0xa7, 0xbd, 0x6a, 0x83, 0x86, 0x3e,
+    0x9b, 0x41, 0x38, 0xbe, 0x31, 0x45, 0xfc, 0x3d, 0x90, 0x62, 0x1f, 0xbe,
+    0xed, 0xb5, 0xa7, 0x3c, 0xd9, 0xeb, 0x8f, 0x3c, 0x2e, 0x3d, 0xcc, 0x3a,
+    0xde, 0x79, 0x09, 0x3e, 0x54, 0xa7, 0xd0, 0xbd, 0x49, 0x02, 0x5d, 0xbe,
+    0xe5, 0x28, 0x3a, 0x3e, 0xd8, 0x48, 0x6d, 0x3d, 0x2b, 0x02, 0x50, 0x3e,
+    0xa0, 0x5d, 0x32, 0x3e, 0x36, 0x18, 0xaa, 0xbd, 0xf5, 0xfd, 0xa3, 0x3e,
+    0x8f, 0x88, 0x5e, 0x3d, 0x9b, 0x03, 0x09, 0x3e, 0x54, 0x15, 0x76, 0x3e,
+    0xba, 0x71, 0x70, 0x3d, 0xf0, 0x85, 0xa4, 0x3c, 0xc4, 0x6a, 0x44, 0xbd,
+    0x6e, 0x39, 0xd7, 0x3d, 0x2a, 0xd8, 0xe9, 0x3d, 0xa0, 0x0b, 0x1c, 0xbe,
+    0xee, 0x67, 0x0a, 0xbd, 0x82, 0x2f, 0x22, 0x3e, 0x1c, 0x04, 0x65, 0xbd,
+    0x34, 0x6d, 0x86, 0xbd, 0xdf, 0xff, 0x1a, 0x3e, 0x7d, 0xff, 0x27, 0x3e,
+    0x2a, 0xb1, 0x78, 0x3e, 0xca, 0x0c, 0xb0, 0x3e, 0xdd, 0x41, 0x00, 0xbe,
+    0x7c, 0x87, 0x29, 0x3e, 0xc9, 0x89, 0xe4, 0xbd, 0x06, 0xc2, 0x11, 0x3d,
+    0x8a, 0x11, 0x1b, 0xbd, 0xd6, 0xa0, 0x35, 0x3d, 0xd1, 0x6a, 0xa3, 0x3d,
+    0xed, 0x7a, 0x99, 0xbd, 0x6d, 0xbf, 0xc8, 0x3d, 0x03, 0x96, 0x8f, 0x3d,
+    0x0a, 0xcd, 0xbb, 0xbe, 0x20, 0xb4, 0x75, 0xbd, 0x1c, 0xea, 0x09, 0xbe,
+    0xad, 0xd6, 0x37, 0xbe, 0xe4, 0x6f, 0x30, 0xbe, 0x22, 0xa7, 0x5c, 0x3d,
+    0x3c, 0x64, 0x8d, 0xbb, 0x9f, 0xb7, 0x0c, 0xbd, 0x0a, 0x1f, 0x94, 0x3d,
+    0x73, 0x43, 0xde, 0xbd, 0x50, 0xbb, 0xf5, 0x3d, 0x63, 0xb1, 0x8d, 0x3e,
+    0x0f, 0xdb, 0x54, 0x3e, 0xe7, 0x4a, 0xc5, 0x3e, 0x1f, 0x34, 0x19, 0xbd,
+    0x2c, 0x7e, 0xd0, 0xbd, 0x4c, 0x14, 0xb6, 0x3e, 0x15, 0xa6, 0x14, 0x3e,
+    0x3c, 0x3b, 0xe9, 0x3d, 0x53, 0xe5, 0xa1, 0xbd, 0xac, 0x8f, 0xfa, 0x3b,
+    0x40, 0x70, 0x42, 0x3e, 0x08, 0x37, 0xda, 0x3d, 0x08, 0x04, 0xf7, 0x3d,
+    0xf0, 0xbf, 0xb3, 0xbe, 0x66, 0x3d, 0x75, 0x3e, 0xa6, 0x79, 0x49, 0xbe,
+    0x05, 0x24, 0x60, 0x39, 0xcc, 0x46, 0x06, 0x3e, 0x42, 0xa7, 0xbd, 0x3e,
+    0xaf, 0xdb, 0x05, 0xbd, 0xb9, 0x2f, 0x03, 0xbe, 0x54, 0x0a, 0x0d, 0xbe,
+    0x03, 0x4e, 0x4b, 0x3e, 0xe3, 0x47, 0x15, 0xbe, 0x7b, 0xa9, 0x72, 0x3e,
+    0xb3, 0x37, 0x47, 0x3d, 0xe9, 0xab, 0xcd, 0x3d, 0x3b, 0x00, 0xf6, 0x3d,
+    0x72, 0x7a, 0x70, 0x3e, 0x89, 0x2f, 0xa5, 0x3e, 0x0a, 0x7f, 0x8c, 0xbe,
+    0xc1, 0x3d, 0x39, 0x3c, 0xdf, 0x26, 0x8b, 0x3d, 0x74, 0xf7, 0x9a, 0x3e,
+    0xe5, 0x68, 0x92, 0xbd, 0xaa, 0xe7, 0x07, 0x3e, 0x38, 0xa1, 0xa4, 0xbd,
+    0x1b, 0x13, 0xdd, 0xbc, 0x05, 0xa7, 0x99, 0xbe, 0xec, 0x03, 0x78, 0x3d,
+    0x3b, 0xae, 0x19, 0x3e, 0x7e, 0x3f, 0x39, 0x3e, 0xfc, 0x41, 0x97, 0x3c,
+    0xb5, 0x92, 0x29, 0x3d, 0x05, 0xba, 0xe2, 0xbd, 0x52, 0x00, 0x5e, 0xbe,
+    0x50, 0xa2, 0x52, 0xbd, 0xd3, 0x0e, 0xc2, 0x3d, 0xee, 0xbd, 0x85, 0x3e,
+    0xc3, 0x94, 0x60, 0x3e, 0x4f, 0xdb, 0x7b, 0x3e, 0x96, 0x3d, 0xc9, 0xbd,
+    0x04, 0xc3, 0x11, 0x3e, 0x08, 0x6c, 0xdd, 0x3d, 0x84, 0x08, 0x36, 0xbd,
+    0x9e, 0x56, 0xab, 0x3e, 0x08, 0xb4, 0x92, 0x3e, 0x3f, 0xcf, 0x18, 0x3e,
+    0x0f, 0xb4, 0x0c, 0x3e, 0x06, 0xaf, 0x9a, 0x3e, 0x3c, 0xe0, 0x49, 0x3e,
+    0xae, 0xbb, 0xbb, 0xbb, 0xa4, 0xac, 0x7d, 0x3e, 0x0e, 0x54, 0xa4, 0x3d,
+    0xe4, 0x81, 0x86, 0xbc, 0x30, 0x06, 0xc9, 0x3e, 0xa1, 0xda, 0x41, 0x3e,
+    0x87, 0x81, 0x81, 0x3e, 0x0a, 0xb8, 0x40, 0x3e, 0xb8, 0x67, 0x0b, 0xbe,
+    0x74, 0x03, 0xc5, 0x3e, 0xfa, 0x72, 0x66, 0x3e, 0x62, 0x41, 0x33, 0x3e,
+    0xf8, 0x8c, 0x17, 0x3e, 0x45, 0xfe, 0xad, 0x3e, 0x0a, 0x48, 0x1c, 0x3e,
+    0x4a, 0xf6, 0xc6, 0x3e, 0x5e, 0x51, 0xf7, 0x3c, 0xcf, 0xbb, 0x29, 0xbe,
+    0x66, 0x17, 0x1f, 0x3e, 0x4d, 0xce, 0x92, 0x3c, 0xa6, 0x90, 0xc5, 0x3e,
+    0x02, 0xe7, 0x55, 0xb9, 0xe4, 0x97, 0x8e, 0x3d, 0x7b, 0x7d, 0xf3, 0x3d,
+    0x9d, 0xd3, 0x4d, 0xbe, 0xda, 0x89, 0xc9, 0x3d, 0xb2, 0x4b, 0x3f, 0x3e,
+    0x74, 0x5e, 0x82, 0xbc, 0xd9, 0x05, 0x20, 0x3d, 0x99, 0xfc, 0x1b, 0xbe,
+    0x6c, 0x56, 0x21, 0xbe, 0x48, 0xc3, 0xc8, 0xbe, 0xc9, 0x0a, 0x0c, 0xbe,
+    0x2c, 0xbc, 0x53, 0x3e, 0x7a, 0xb8, 0x6e, 0x3e, 0xc0, 0xa0, 0x39, 0xbd,
+    0xfb, 0x60, 0x13, 0x3e, 0xd8, 0x08, 0x0e, 0x3e, 0xd9, 0xd1, 0x35, 0x3e,
+    0x7b, 0x35, 0x04, 0x3e, 0xc9, 0x0f, 0x5d, 0x3e, 0x11, 0x35, 0xd2, 0xbd,
+    0x46, 0x07, 0x45, 0x3d, 0x3c, 0xe1, 0x65, 0x3e, 0x92, 0x7c, 0x88, 0x3e,
+    0x34, 0x4c, 0x6d, 0x3e, 0x7e, 0x19, 0x38, 0x3e, 0xa9, 0x5a, 0x35, 0x3e,
+    0xa3, 0x8e, 0x4b, 0x3e, 0x39, 0xb4, 0x1f, 0xbe, 0x58, 0x9f, 0xd3, 0xbd,
+    0x4c, 0x7e, 0x32, 0xbd, 0x24, 0xf8, 0x8c, 0x3e, 0x97, 0x2a, 0x0b, 0xbe,
+    0xf6, 0xdf, 0xc0, 0xbc, 0xe7, 0xfb, 0xfb, 0xbd, 0xbb, 0xc5, 0x7f, 0xbe,
+    0x34, 0xee, 0x5e, 0xbe, 0x74, 0xa6, 0xe2, 0xbd, 0xc9, 0xc7, 0x27, 0x3e,
+    0x82, 0x2d, 0xb7, 0xbd, 0x29, 0x0c, 0x83, 0x3e, 0xdd, 0xee, 0xcd, 0xbd,
+    0xa5, 0x00, 0x19, 0xbd, 0x68, 0x18, 0xc9, 0x3e, 0xb5, 0xf7, 0xdb, 0x3c,
+    0xf1, 0xc0, 0x60, 0x3d, 0x87, 0x56, 0x33, 0xbd, 0x20, 0x56, 0x4d, 0x3c,
+    0x72, 0x57, 0xb6, 0x3c, 0x11, 0xc0, 0x0e, 0x3e, 0x05, 0x4c, 0xb2, 0xbd,
+    0x78, 0x3d, 0xac, 0xbb, 0xa1, 0x9b, 0xf3, 0xbd, 0x21, 0x58, 0x38, 0x3e,
+    0x6e, 0x40, 0x8f, 0xbd, 0x28, 0x14, 0x68, 0x3c, 0x18, 0x36, 0x80, 0xbe,
+    0x85, 0xd7, 0x8d, 0x3e, 0xe5, 0x6d, 0x60, 0xbe, 0x64, 0x5b, 0x3c, 0x3d,
+    0xea, 0xeb, 0x0e, 0x3e, 0x91, 0xf2, 0xe8, 0x3d, 0x3e, 0x8f, 0x3b, 0x3e,
+    0x84, 0xb2, 0x75, 0x3e, 0xad, 0xf8, 0x4f, 0x3e, 0x51, 0xd4, 0xaa, 0x3d,
+    0x02, 0x77, 0xa6, 0x3e, 0xeb, 0x77, 0x2a, 0xbe, 0x44, 0xcd, 0x13, 0x3d,
+    0x97, 0x8d, 0x0c, 0xbe, 0x83, 0xb7, 0x55, 0xbd, 0x44, 0xe6, 0xef, 0xbd,
+    0x12, 0xd9, 0x4f, 0xbe, 0x02, 0xc3, 0x1b, 0xbe, 0x82, 0xba, 0x29, 0x3d,
+    0x53, 0x8f, 0xee, 0xbc, 0x19, 0xfd, 0xd3, 0x3d, 0x8e, 0xfa, 0x32, 0xbe,
+    0x1d, 0x8e, 0x71, 0xbe, 0x39, 0xc6, 0x8a, 0x3e, 0xd4, 0x8f, 0x68, 0x3d,
+    0x15, 0x74, 0xca, 0xbd, 0xca, 0x83, 0x78, 0xbb, 0x60, 0x5c, 0x02, 0x3a,
+    0xd9, 0x87, 0xa7, 0x3e, 0xd4, 0xba, 0x54, 0x3e, 0xf1, 0x8d, 0x29, 0x3e,
+    0x50, 0x15, 0x78, 0x3e, 0x39, 0x65, 0xbf, 0x3e, 0xbb, 0x40, 0x80, 0x3e,
+    0x0b, 0x92, 0x2e, 0xbe, 0xf5, 0x6a, 0x53, 0xbe, 0x55, 0x2c, 0x49, 0xbe,
+    0x75, 0x35, 0x78, 0xbe, 0x11, 0x40, 0x07, 0xbe, 0x1e, 0x89, 0x7e, 0xbe,
+    0x06, 0x41, 0x69, 0xbe, 0x31, 0x35, 0x61, 0xbe, 0x9d, 0xc4, 0x7c, 0xbe,
+    0x9b, 0x85, 0x29, 0xbe, 0xd5, 0xe8, 0x06, 0x3e, 0x04, 0xd6, 0xa2, 0x3e,
+    0x67, 0x18, 0xa9, 0x3d, 0x83, 0x7b, 0x6a, 0x3e, 0xe8, 0xed, 0x7c, 0x3d,
+    0xb5, 0x9e, 0x1a, 0x3e, 0x3c, 0x17, 0x97, 0x3e, 0xda, 0x78, 0x2e, 0x3d,
+    0x97, 0x2d, 0xf7, 0x3d, 0x78, 0x87, 0x00, 0xbd, 0xff, 0x24, 0x0a, 0xbd,
+    0x77, 0xce, 0xd3, 0x3d, 0x5c, 0xaf, 0x64, 0x3c, 0xe8, 0xec, 0x5a, 0x3e,
+    0xd9, 0x35, 0x61, 0x3e, 0x92, 0x14, 0x7b, 0x3e, 0x47, 0x9f, 0x50, 0x3d,
+    0x12, 0x66, 0x75, 0x3d, 0xd0, 0x59, 0xe3, 0xbc, 0xb0, 0x8d, 0x18, 0x3d,
+    0xd9, 0x53, 0xd1, 0xbc, 0x40, 0x0e, 0x0c, 0x3e, 0x34, 0x60, 0xd3, 0xbd,
+    0x9c, 0xc5, 0x11, 0x3d, 0x1c, 0x65, 0x8e, 0x3e, 0x53, 0xdb, 0xb9, 0x3d,
+    0x89, 0x95, 0x5b, 0x3e, 0x6b, 0x39, 0xb5, 0x3d, 0x72, 0x74, 0x37, 0x3e,
+    0xa0, 0x33, 0xfe, 0x3d, 0xc6, 0xed, 0xd6, 0x3d, 0xfe, 0xd1, 0x5e, 0x3e,
+    0xb8, 0xb2, 0xcd, 0x3d, 0x71, 0xb3, 0x88, 0x3d, 0x1b, 0x44, 0x80, 0xbe,
+    0x85, 0xda, 0x7e, 0xbd, 0x23, 0x83, 0xbe, 0xbc, 0x87, 0xd2, 0x12, 0xbe,
+    0x79, 0x5f, 0xd8, 0xbd, 0x27, 0x79, 0x55, 0xbe, 0x98, 0x0f, 0x41, 0xbe,
+    0xe4, 0xb3, 0xa0, 0x3d, 0x16, 0xe0, 0x8d, 0x3d, 0xce, 0x09, 0x8c, 0x3d,
+    0x5d, 0x69, 0x13, 0xbd, 0x8f, 0x2b, 0x6e, 0xbc, 0xa7, 0xc4, 0x2b, 0xbe,
+    0x40, 0xbb, 0xbb, 0x3d, 0x2e, 0x63, 0x06, 0xbe, 0x5c, 0x17, 0x84, 0x3e,
+    0x38, 0xbf, 0x76, 0x3e, 0xef, 0xc6, 0x0a, 0x3e, 0x55, 0x0a, 0xda, 0xbe,
+    0x88, 0x19, 0x4a, 0x3e, 0x9c, 0xa8, 0x3f, 0x3d, 0xfe, 0x4c, 0x8e, 0x3e,
+    0xbf, 0x7b, 0xa5, 0xbe, 0xa1, 0xc2, 0x08, 0x3e, 0xdc, 0xbd, 0x1d, 0xbe,
+    0xd3, 0x27, 0xc7, 0xbd, 0xcc, 0xd6, 0x22, 0xbe, 0xe9, 0x22, 0xa8, 0xbe,
+    0x9d, 0x4d, 0xc5, 0x3d, 0x22, 0xbb, 0x93, 0xbe, 0x45, 0x93, 0x67, 0x3e,
+    0xa3, 0x7a, 0x05, 0x3e, 0x4e, 0x13, 0x5c, 0xbe, 0x33, 0x42, 0x45, 0xbd,
+    0x6b, 0xa7, 0x0e, 0xbe, 0x7d, 0x2a, 0xc2, 0xbd, 0x16, 0xd2, 0x09, 0x3d,
+    0xad, 0xd7, 0x90, 0x3e, 0xb3, 0x68, 0x4f, 0x3e, 0x7a, 0xad, 0x67, 0x3d,
+    0x0e, 0xdf, 0xa8, 0xbd, 0xfb, 0x73, 0xde, 0x3a, 0x51, 0x47, 0x84, 0x3e,
+    0xb8, 0xcc, 0x32, 0xbe, 0xa9, 0x7c, 0x80, 0xbd, 0x25, 0x4f, 0x9a, 0x3e,
+    0x8c, 0xf5, 0x62, 0xbc, 0x33, 0xde, 0x67, 0x3d, 0xf5, 0xff, 0xd3, 0x3c,
+    0x64, 0xe5, 0xae, 0xbc, 0x64, 0xf1, 0x64, 0xbd, 0x2a, 0x1c, 0xa9, 0xbc,
+    0x9a, 0x79, 0x06, 0xbe, 0x21, 0xf8, 0x80, 0xbe, 0x98, 0x5c, 0x00, 0x3c,
+    0x16, 0x8c, 0x0c, 0x3c, 0xeb, 0xf2, 0x72, 0x3d, 0x92, 0x80, 0x1e, 0xbd,
+    0x7c, 0xbd, 0x0f, 0x3e, 0x80, 0x31, 0x4e, 0xbe, 0xbe, 0xab, 0xaa, 0x3d,
+    0x53, 0x23, 0xd5, 0xbc, 0x36, 0x95, 0x85, 0xbd, 0x18, 0x1b, 0x38, 0x3e,
+    0x0e, 0xcf, 0xb1, 0x3d, 0x02, 0xad, 0x48, 0xbe, 0x55, 0xe2, 0xad, 0x3c,
+    0x8d, 0xda, 0x0d, 0xbd, 0xce, 0x2e, 0x90, 0x3e, 0x07, 0x3f, 0xa3, 0x3d,
+    0x31, 0x60, 0x55, 0xbd, 0x62, 0x66, 0xed, 0xbd, 0xed, 0x11, 0x95, 0x3c,
+    0xc1, 0x60, 0x81, 0xbe, 0x66, 0x84, 0x80, 0xbe, 0x94, 0x43, 0xa9, 0xbe,
+    0xb3, 0x44, 0xa8, 0xbe, 0x79, 0x62, 0x69, 0x3e, 0xee, 0x25, 0xa8, 0x3e,
+    0x98, 0xa6, 0x9a, 0x3e, 0x83, 0x33, 0x5e, 0x3e, 0x70, 0x14, 0xc4, 0x3d,
+    0x7f, 0x79, 0x8e, 0x3e, 0x05, 0xf6, 0x15, 0xbd, 0xf8, 0xca, 0x8f, 0x3e,
+    0x0f, 0x54, 0x7a, 0x3e, 0x17, 0xc1, 0x87, 0x3d, 0x93, 0x00, 0x3c, 0x3e,
+    0x9c, 0x5c, 0x09, 0x3e, 0xa3, 0x0e, 0x96, 0x3d, 0x69, 0xfe, 0x4d, 0x3e,
+    0x97, 0xd1, 0xb2, 0xbd, 0x7a, 0x04, 0x0e, 0x3e, 0xfb, 0xd1, 0xa4, 0xbd,
+    0xf9, 0x26, 0xf0, 0xbc, 0x7f, 0xb0, 0xd2, 0x3d, 0x29, 0x7c, 0x5a, 0xbe,
+    0x06, 0x73, 0x01, 0xbc, 0x8e, 0x93, 0x41, 0xbe, 0xbe, 0x8d, 0x3b, 0xbe,
+    0x4d, 0x5d, 0xdf, 0x3d, 0x46, 0x70, 0x19, 0xbe, 0x9b, 0x0c, 0x24, 0x3e,
+    0xd0, 0x5a, 0xb3, 0xbd, 0x16, 0x97, 0xcc, 0xbd, 0x86, 0x43, 0x98, 0xbd,
+    0xf6, 0xdf, 0x7f, 0xbd, 0xe0, 0xf6, 0x8f, 0xbd, 0x0b, 0xd9, 0x1a, 0xbe,
+    0x4c, 0x84, 0x26, 0x3d, 0x40, 0x07, 0x98, 0x3d, 0xcb, 0x63, 0xdd, 0xbd,
+    0xe0, 0x3d, 0x4f, 0xbd, 0xe8, 0x77, 0xdb, 0xbc, 0xa5, 0x4e, 0x0a, 0x3e,
+    0xa8, 0x72, 0x1c, 0xbe, 0xdb, 0xc9, 0xa3, 0xbd, 0x8c, 0xb6, 0x47, 0x3d,
+    0xa0, 0xd2, 0xe9, 0xbd, 0x00, 0xc2, 0x7b, 0x3b, 0x98, 0x71, 0xdf, 0xbc,
+    0x1b, 0x33, 0xc4, 0xbd, 0x96, 0x04, 0x9c, 0xbd, 0xab, 0x92, 0x05, 0x3e,
+    0x00, 0xa0, 0x73, 0xbc, 0xb1, 0xe2, 0x11, 0x3e, 0xa0, 0xf3, 0x96, 0xbd,
+    0xb6, 0x34, 0x90, 0x3d, 0xa0, 0xfd, 0x7d, 0xbd, 0xc6, 0x00, 0xe6, 0xbd,
+    0x70, 0xa2, 0xe9, 0xbd, 0x6b, 0xbc, 0x01, 0xbe, 0x5a, 0xf9, 0xb8, 0x3d,
+    0x1b, 0x1d, 0xdd, 0xbd, 0x28, 0x6d, 0xb1, 0x3c, 0xc8, 0x0b, 0x14, 0xbe,
+    0xac, 0xef, 0x09, 0x3d, 0x70, 0x9e, 0xd4, 0xbd, 0x66, 0xd5, 0x9e, 0x3d,
+    0xd4, 0xcb, 0x06, 0x3d, 0x30, 0xa6, 0x18, 0xbe, 0xd6, 0x64, 0xc0, 0xbd,
+    0xb5, 0x10, 0x20, 0x3e, 0x98, 0x96, 0x18, 0xbe, 0x70, 0x7a, 0xdd, 0xbd,
+    0x70, 0xd5, 0xe5, 0xbd, 0xe8, 0x02, 0x9f, 0x3c, 0xb6, 0x0f, 0x00, 0xbe,
+    0x80, 0xe7, 0x23, 0x3c, 0xda, 0xf7, 0xae, 0x3d, 0x50, 0x3c, 0x5c, 0xbc,
+    0xda, 0x78, 0x91, 0x3d, 0x76, 0xa1, 0xcf, 0x3d, 0x92, 0xc9, 0xba, 0x3d,
+    0xf6, 0xa5, 0x55, 0xbd, 0xf6, 0xf1, 0xcd, 0xbd, 0x42, 0x32, 0xc3, 0x3d,
+    0xba, 0x1f, 0x8d, 0x3d, 0xa8, 0x34, 0xa5, 0xbc, 0x63, 0xa3, 0x0e, 0x3e,
+    0xfb, 0xdf, 0x02, 0x3e, 0x32, 0xdf, 0xf5, 0x3d, 0x4d, 0x1d, 0x23, 0x3e,
+    0xa0, 0x14, 0x77, 0xbd, 0x80, 0xb1, 0x38, 0x3d, 0x7b, 0x24, 0xd4, 0xbd,
+    0x70, 0x1b, 0xcf, 0xbd, 0x34, 0xc0, 0x12, 0x3d, 0xb6, 0x2b, 0xaf, 0xbd,
+    0xca, 0xfa, 0xec, 0x3d, 0xcc, 0xd5, 0x21, 0x3d, 0x26, 0x9c, 0xd0, 0xbd,
+    0x60, 0xaa, 0x9e, 0xbb, 0x22, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x98, 0xb3, 0x1f, 0x3c, 0x98, 0x7f, 0x01, 0xbc,
+    0x16, 0xef, 0x5f, 0x3d, 0x6a, 0x8a, 0xdf, 0x3d, 0x28, 0x40, 0x78, 0x3d,
+    0xcb, 0xa7, 0x07, 0xbc, 0xb3, 0xe5, 0x24, 0x3e, 0x63, 0xec, 0xc6, 0x3d,
+    0x6e, 0x6f, 0x89, 0x3d, 0x2e, 0x41, 0xa2, 0x3d, 0xfa, 0x74, 0xb2, 0x3d,
+    0x06, 0x80, 0x5b, 0x3d, 0xd3, 0x3b, 0xb0, 0x3d, 0xa8, 0x98, 0x42, 0xbd,
+    0xa9, 0xf7, 0x26, 0x3d, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xf6, 0xff, 0xff,
+    0xb8, 0xf6, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x4d, 0x4c, 0x49, 0x52,
+    0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x2e, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+    0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
+    0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+    0x10, 0x02, 0x00, 0x00, 0x14, 0x02, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00,
+    0xf0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xe2, 0xfe, 0xff, 0xff,
+    0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1c, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f,
+    0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x7c, 0xf7, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xff, 0xff,
+    0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x08, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
+    0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+    0x5e, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x14, 0x00,
+    0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x34, 0x00, 0x00, 0x00,
+    0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+    0x18, 0x00, 0x17, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
+    0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x00,
+    0x2c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x13, 0x00, 0x0c, 0x00,
+    0x08, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0xb8, 0x06, 0x00, 0x00,
+    0x64, 0x06, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0xc4, 0x05, 0x00, 0x00,
+    0x84, 0x05, 0x00, 0x00, 0x48, 0x05, 0x00, 0x00, 0x0c, 0x05, 0x00, 0x00,
+    0xcc, 0x04, 0x00, 0x00, 0x58, 0x04, 0x00, 0x00, 0xd0, 0x03, 0x00, 0x00,
+    0x20, 0x03, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x00, 0xd4, 0x01, 0x00, 0x00,
+    0x74, 0x01, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0xa2, 0xf9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+    0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+    0x11, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x84, 0xf9, 0xff, 0xff,
+    0x1b, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x74, 0x65, 0x66, 0x75, 0x6c,
+    0x50, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x65, 0x64, 0x43,
+    0x61, 0x6c, 0x6c, 0x5f, 0x31, 0x3a, 0x30, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xfa, 0xf9, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+    0xdc, 0xf9, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+    0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e,
+    0x73, 0x65, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75,
+    0x6c, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c,
+    0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x5f, 0x32,
+    0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x76, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x6c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x10, 0x00, 0x00, 0x00, 0x58, 0xfa, 0xff, 0xff, 0x52, 0x00, 0x00, 0x00,
+    0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31,
+    0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x74,
+    0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+    0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31,
+    0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e,
+    0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65,
+    0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x06, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+    0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x10, 0x00, 0x00, 0x00, 0xe8, 0xfa, 0xff, 0xff, 0x1e, 0x00, 0x00, 0x00,
+    0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31,
+    0x2f, 0x66, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x5f, 0x31, 0x2f, 0x52,
+    0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x62, 0xfb, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x4c, 0xfb, 0xff, 0xff,
+    0x80, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+    0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
+    0x31, 0x5f, 0x32, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71,
+    0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f,
+    0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61,
+    0x73, 0x41, 0x64, 0x64, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74,
+    0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
+    0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74,
+    0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
+    0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x53, 0x71, 0x75, 0x65, 0x65, 0x7a, 0x65,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x32, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x48, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x1c, 0xfc, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+    0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x6d, 0x61, 0x78,
+    0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x32, 0x64, 0x5f, 0x31,
+    0x2f, 0x4d, 0x61, 0x78, 0x50, 0x6f, 0x6f, 0x6c, 0x32, 0x64, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xa6, 0xfc, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x90, 0xfc, 0xff, 0xff,
+    0x5c, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+    0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
+    0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65,
+    0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
+    0x32, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
+    0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f,
+    0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x63,
+    0x6f, 0x6e, 0x76, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3b, 0x31,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0xa2, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+    0x24, 0xfd, 0xff, 0xff, 0x5b, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+    0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e,
+    0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73,
+    0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f,
+    0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61,
+    0x73, 0x41, 0x64, 0x64, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74,
+    0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
+    0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x6f, 0x6c, 0x75, 0x74, 0x69,
+    0x6f, 0x6e, 0x3b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x26, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+    0xa8, 0xfd, 0xff, 0xff, 0x21, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+    0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e,
+    0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x18, 0x00,
+    0x17, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0xfe, 0xff, 0xff,
+    0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f,
+    0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x36, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0xd2, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x00, 0x54, 0xfe, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
+    0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61,
+    0x6e, 0x74, 0x35, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x0a, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+    0x8c, 0xfe, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74,
+    0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x34, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x42, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xc4, 0xfe, 0xff, 0xff,
+    0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f,
+    0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x33, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x7e, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+    0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f,
+    0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x32, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xba, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x3c, 0xff, 0xff, 0xff,
+    0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f,
+    0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x31, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x18, 0x00, 0x14, 0x00,
+    0x00, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x00, 0x98, 0xff, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00,
+    0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61,
+    0x6e, 0x74, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x00, 0x00, 0x14, 0x00,
+    0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00,
+    0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+    0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61,
+    0x75, 0x6c, 0x74, 0x5f, 0x6b, 0x65, 0x72, 0x61, 0x73, 0x5f, 0x74, 0x65,
+    0x6e, 0x73, 0x6f, 0x72, 0x3a, 0x30, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+    0x34, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0xdc, 0xff, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xe8, 0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x16, 0xf4, 0xff, 0xff, 0xff, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x0c, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03,
+};
+
+const int g_cnn_fused_model_float32_len = 10372;
@@ -0,0 +1,613 @@
+#include "model8.h"
+
+alignas(8) const unsigned char g_cnn_fused_model_int8[] = {
+    0x20, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x14, 0x00, 0x20, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
+    0xa4, 0x0c, 0x00, 0x00, 0x54, 0x04, 0x00, 0x00, 0xcc, 0x03, 0x00, 0x00,
+    0x9c, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x00, 0x00,
+    0xf0, 0x1b, 0x00, 0x00, 0xd0, 0x1b, 0x00, 0x00, 0xbc, 0x1b, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x10, 0x00, 0x04, 0x00,
+    0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x43, 0x4f, 0x4e, 0x56,
+    0x5f, 0x52, 0x45, 0x4c, 0x55, 0x5f, 0x50, 0x4f, 0x4f, 0x4c, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+    0x58, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x5c, 0x0c, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x94, 0x1a, 0x00, 0x00, 0x38, 0x1a, 0x00, 0x00,
+    0x98, 0x19, 0x00, 0x00, 0x0c, 0x19, 0x00, 0x00, 0xf8, 0x17, 0x00, 0x00,
+    0xdc, 0x16, 0x00, 0x00, 0xc8, 0x15, 0x00, 0x00, 0xa4, 0x14, 0x00, 0x00,
+    0xf0, 0x13, 0x00, 0x00, 0x2c, 0x13, 0x00, 0x00, 0xc0, 0x11, 0x00, 0x00,
+    0xcc, 0x10, 0x00, 0x00, 0x48, 0x10, 0x00, 0x00, 0x94, 0x0f, 0x00, 0x00,
+    0xf0, 0x0e, 0x00, 0x00, 0x74, 0x0e, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
+    0xd8, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x48, 0x01, 0x00, 0x00,
+    0x84, 0x01, 0x00, 0x00, 0x12, 0x00, 0x18, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x18, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x14, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+    0x6c, 0x0c, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x18, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x14, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+    0x90, 0x0b, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x00, 0x14, 0x0b, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x18, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x14, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xa4, 0x0a, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x94, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x54, 0x46, 0x4c, 0x33, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x20, 0x00,
+    0x1c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+    0x8c, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x54, 0x09, 0x00, 0x00,
+    0x64, 0x09, 0x00, 0x00, 0x6c, 0x18, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xa6, 0xf5, 0xff, 0xff,
+    0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f,
+    0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x68, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x70,
+    0x75, 0x74, 0x5f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x8a, 0xf6, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x72, 0x61, 0x73, 0x5f, 0x74, 0x65,
+    0x6e, 0x73, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x5c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0xb8, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x13, 0x00, 0x00, 0x00, 0x43, 0x4f, 0x4e, 0x56, 0x45, 0x52, 0x53, 0x49,
+    0x4f, 0x4e, 0x5f, 0x4d, 0x45, 0x54, 0x41, 0x44, 0x41, 0x54, 0x41, 0x00,
+    0xdc, 0xff, 0xff, 0xff, 0x13, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x13, 0x00, 0x00, 0x00, 0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x75, 0x6e, 0x74,
+    0x69, 0x6d, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00,
+    0x08, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+    0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x5f,
+    0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00, 0x15, 0x00, 0x00, 0x00,
+    0x44, 0x08, 0x00, 0x00, 0x3c, 0x08, 0x00, 0x00, 0x24, 0x08, 0x00, 0x00,
+    0x04, 0x08, 0x00, 0x00, 0xb4, 0x07, 0x00, 0x00, 0x64, 0x07, 0x00, 0x00,
+    0x54, 0x06, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00,
+    0x44, 0x01, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00,
+    0xdc, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00,
+    0xc4, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00,
+    0x94, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x82, 0xf7, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x04, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xeb, 0x03, 0x00, 0x00,
+    0x0c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x04, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x9b, 0x4e, 0xcf, 0x5f, 0x30, 0xae, 0x48, 0xf2,
+    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x32, 0x2e, 0x31, 0x39, 0x2e, 0x30, 0x00, 0x00,
+    0xee, 0xf7, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0xf8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x31, 0x34, 0x2e, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xea, 0xff, 0xff,
+    0x6c, 0xea, 0xff, 0xff, 0x70, 0xea, 0xff, 0xff, 0x74, 0xea, 0xff, 0xff,
+    0x78, 0xea, 0xff, 0xff, 0x7c, 0xea, 0xff, 0xff, 0x80, 0xea, 0xff, 0xff,
+    0x42, 0xf8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+    0x10, 0x26, 0xd9, 0x7b, 0x81, 0x6c, 0x54, 0x1a, 0x9e, 0x81, 0xfd, 0x09,
+    0x60, 0xe7, 0x69, 0x36, 0xce, 0x69, 0x43, 0x31, 0x52, 0x46, 0x7f, 0x4e,
+    0x02, 0x73, 0x16, 0xc8, 0x7f, 0xc6, 0xb2, 0xf4, 0x9a, 0x15, 0x70, 0x11,
+    0x0d, 0x7f, 0x40, 0xb8, 0xd1, 0xd2, 0x72, 0x67, 0x5d, 0x8b, 0xb4, 0x1d,
+    0x49, 0x60, 0x7f, 0xf0, 0xc0, 0x79, 0x81, 0xd3, 0x3d, 0x42, 0xca, 0x9f,
+    0x48, 0x6a, 0x39, 0xa0, 0x97, 0x62, 0x9e, 0xb7, 0x7a, 0x75, 0x61, 0x7f,
+    0x96, 0xf8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x27, 0x1e, 0x00, 0x00, 0x77, 0x32, 0x00, 0x00, 0x39, 0x19, 0x00, 0x00,
+    0xbb, 0x25, 0x00, 0x00, 0x27, 0x17, 0x00, 0x00, 0x5d, 0x2f, 0x00, 0x00,
+    0xe5, 0x1b, 0x00, 0x00, 0x68, 0x37, 0x00, 0x00, 0xc2, 0xf8, 0xff, 0xff,
+    0x04, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0xc6, 0x20, 0x0a, 0x19,
+    0xb6, 0x02, 0xbe, 0xef, 0x2f, 0x61, 0x12, 0x07, 0xce, 0x20, 0x1d, 0x0e,
+    0x3f, 0x34, 0x02, 0xdf, 0xe5, 0xf7, 0xdd, 0xfd, 0xe2, 0x4f, 0xcf, 0x05,
+    0xfd, 0x25, 0xee, 0x07, 0x6b, 0xf6, 0x13, 0xfd, 0xbb, 0x14, 0xc7, 0xfd,
+    0x46, 0xd7, 0x05, 0xcb, 0xea, 0xd3, 0xbd, 0xe1, 0xe7, 0x37, 0x04, 0x1e,
+    0xd7, 0x09, 0xf9, 0x41, 0x6b, 0xe9, 0x1d, 0x5b, 0xd8, 0xf0, 0x3f, 0x7f,
+    0x5e, 0x17, 0x28, 0x1c, 0x19, 0xda, 0xe9, 0xb1, 0x9d, 0x6b, 0xe8, 0xb3,
+    0xd0, 0x2e, 0xdb, 0xf0, 0x06, 0x7b, 0x4d, 0x23, 0xd1, 0x53, 0x49, 0x62,
+    0x30, 0x2a, 0xd6, 0x19, 0x3d, 0x23, 0x06, 0xf1, 0xe5, 0x23, 0x2d, 0x5d,
+    0xf8, 0x33, 0xc7, 0x65, 0x7b, 0x1a, 0x45, 0x52, 0xf6, 0xfb, 0xb8, 0x16,
+    0xcd, 0xbe, 0xc5, 0xd3, 0xe4, 0x8e, 0x94, 0x81, 0xff, 0x2c, 0x0f, 0xed,
+    0x22, 0x50, 0x46, 0x34, 0x6c, 0xf0, 0x0d, 0x76, 0xbe, 0xd9, 0xff, 0x42,
+    0x14, 0xd5, 0xcf, 0x9b, 0xa7, 0xd3, 0xa7, 0x3b, 0x68, 0x32, 0x2d, 0x37,
+    0x56, 0x1f, 0x42, 0x2d, 0x30, 0xd9, 0x49, 0xf0, 0x1b, 0xd5, 0x11, 0x3d,
+    0x03, 0xa8, 0xe7, 0x0c, 0x1b, 0x5b, 0xc7, 0x07, 0x6c, 0x1f, 0x0c, 0xe4,
+    0x2b, 0x9c, 0x59, 0xa7, 0xe8, 0xf2, 0x27, 0xab, 0xdd, 0xb5, 0x62, 0x8b,
+    0x3b, 0x02, 0x34, 0x04, 0x23, 0x30, 0x71, 0x68, 0xab, 0xde, 0x98, 0xb0,
+    0x05, 0x9b, 0xfa, 0xdf, 0x29, 0x5c, 0xdf, 0xe4, 0x25, 0xc7, 0x42, 0x21,
+    0xfe, 0x3e, 0x22, 0x3a, 0x57, 0x35, 0x7f, 0xd9, 0xe4, 0x0d, 0x42, 0x20,
+    0x36, 0x31, 0x57, 0x32, 0x43, 0x39, 0x2e, 0x16, 0x20, 0x17, 0x26, 0x4b,
+    0x15, 0x33, 0x54, 0x36, 0x63, 0x24, 0x3d, 0x0d, 0x8e, 0x18, 0x16, 0x03,
+    0x03, 0xf5, 0xce, 0x0a, 0xdb, 0xd3, 0x2a, 0x38, 0xc4, 0xcd, 0x81, 0xee,
+    0xc9, 0xde, 0xaa, 0x2b, 0xcf, 0x18, 0x8d, 0xba, 0x7b, 0x65, 0x32, 0x1e,
+    0xc8, 0x43, 0xfb, 0x24, 0xfa, 0x04, 0xfc, 0x31, 0x12, 0x56, 0xeb, 0x3b,
+    0xab, 0x00, 0xa0, 0xd8, 0xb7, 0x06, 0xf2, 0x77, 0x00, 0xee, 0x2d, 0x24,
+    0x71, 0x11, 0x58, 0x3f, 0xba, 0x01, 0x53, 0x42, 0x65, 0x61, 0x45, 0x63,
+    0x1d, 0x29, 0x71, 0x62, 0x15, 0x40, 0x6e, 0x2b, 0xde, 0xd7, 0xdb, 0x2d,
+    0x1c, 0xca, 0xe5, 0xe2, 0xba, 0xf6, 0x37, 0x26, 0xca, 0x2f, 0xcf, 0xd0,
+    0x15, 0xcc, 0xe8, 0x28, 0x0d, 0x43, 0xc3, 0xb6, 0x0f, 0x0e, 0xbe, 0xa8,
+    0xcf, 0xa4, 0xdb, 0xe7, 0xb4, 0x42, 0x81, 0xfb, 0xb9, 0x64, 0x12, 0x32,
+    0xb4, 0xe0, 0xb2, 0xc9, 0xa7, 0x0a, 0xd2, 0x35, 0x02, 0xd1, 0xc7, 0xc9,
+    0x03, 0xa7, 0xc0, 0xc3, 0xb8, 0xf5, 0xf0, 0xe4, 0xca, 0x3b, 0xeb, 0x26,
+    0x10, 0x21, 0xae, 0xdd, 0x0f, 0xee, 0x39, 0x11, 0x65, 0xd1, 0x28, 0x2d,
+    0x24, 0xf9, 0x7f, 0xe0, 0x36, 0x27, 0x56, 0x0a, 0x09, 0x2f, 0x74, 0x07,
+    0x01, 0x72, 0x40, 0xfd, 0x63, 0x3c, 0x27, 0x69, 0xc0, 0xd0, 0x30, 0x45,
+    0x66, 0xf9, 0x22, 0xc5, 0xd4, 0x08, 0x2f, 0x35, 0x39, 0xe5, 0x3a, 0xb8,
+    0x35, 0xd9, 0x51, 0x11, 0x4d, 0x25, 0x16, 0x04, 0x74, 0x66, 0x3e, 0x3b,
+    0x0b, 0x55, 0x12, 0x32, 0x50, 0x0f, 0x2f, 0xfe, 0x0c, 0xe8, 0x69, 0x39,
+    0x0c, 0x1a, 0x28, 0x2f, 0xef, 0xde, 0x11, 0xd3, 0xce, 0x10, 0xa4, 0xbe,
+    0x8e, 0xcd, 0xcb, 0xd0, 0x45, 0x1d, 0xc5, 0x00, 0xe5, 0xf1, 0xf3, 0xf7,
+    0x57, 0xb3, 0x09, 0x16, 0x0a, 0xac, 0x03, 0xed, 0x6a, 0x72, 0xa2, 0xfc,
+    0xbd, 0x26, 0xf1, 0x08, 0x49, 0x7f, 0xf1, 0x01, 0x05, 0x5c, 0x4f, 0x6d,
+    0x16, 0x48, 0x32, 0x71, 0x35, 0x77, 0x20, 0xff, 0xe7, 0x3c, 0x42, 0xf2,
+    0xea, 0x61, 0x09, 0xf6, 0x77, 0x6a, 0x3e, 0x4b, 0xd2, 0x19, 0x19, 0x39,
+    0x14, 0x72, 0xdd, 0xf7, 0xe7, 0x2b, 0x20, 0x32, 0xe4, 0x10, 0x34, 0x61,
+    0xcb, 0x1f, 0xfb, 0x7f, 0x60, 0x70, 0x6d, 0x68, 0x50, 0x0f, 0x11, 0x5c,
+    0x7d, 0xf3, 0x3a, 0x1a, 0x18, 0xd0, 0xa9, 0xf0, 0x30, 0x1d, 0x2e, 0x4d,
+    0x11, 0x26, 0x3c, 0x2a, 0x7a, 0x31, 0x63, 0x4f, 0x16, 0x5f, 0x11, 0x6c,
+    0x55, 0xcc, 0x1e, 0xd9, 0xf6, 0xfb, 0x12, 0x5c, 0x12, 0xf5, 0x45, 0x22,
+    0x53, 0x32, 0x52, 0x67, 0x3f, 0x19, 0x16, 0x69, 0x4e, 0x1e, 0x3d, 0x03,
+    0xb7, 0xde, 0xe5, 0x11, 0x09, 0x6f, 0xfd, 0x24, 0x4e, 0x02, 0x23, 0x7c,
+    0x47, 0x3f, 0x41, 0x6e, 0x4a, 0x1c, 0x2a, 0x18, 0x16, 0x02, 0x23, 0x2b,
+    0xdc, 0x04, 0xe6, 0xf5, 0x45, 0x45, 0x4b, 0x7f, 0x50, 0x5a, 0x14, 0x23,
+    0x6b, 0x1f, 0x3b, 0x55, 0xd2, 0x1e, 0x44, 0xb5, 0x2b, 0x01, 0xc9, 0x91,
+    0xdd, 0x3a, 0xfc, 0x3b, 0x51, 0x37, 0x4a, 0x44, 0x95, 0xfb, 0xe4, 0xa7,
+    0xb0, 0xc2, 0xb6, 0xff, 0xfc, 0x19, 0xca, 0x0c, 0xfe, 0x48, 0xdc, 0xe0,
+    0x13, 0x52, 0x34, 0x46, 0x08, 0xe7, 0x21, 0x3d, 0xa0, 0x4d, 0xef, 0x73,
+    0x03, 0x27, 0xe7, 0x1f, 0xb1, 0xf9, 0x10, 0x78, 0xf8, 0x50, 0xdf, 0x79,
+    0x0b, 0xfd, 0xff, 0x4e, 0x35, 0x11, 0xec, 0x1d, 0x4c, 0x4e, 0x7f, 0x6b,
+    0x22, 0x63, 0x1d, 0x5a, 0x17, 0xf3, 0x68, 0x2b, 0xe5, 0x57, 0xc4, 0x29,
+    0xcd, 0x07, 0x06, 0x01, 0x2c, 0xde, 0xb9, 0x3c, 0x13, 0x43, 0x39, 0xe5,
+    0x6a, 0x12, 0x2c, 0x4f, 0x13, 0x07, 0xf0, 0x23, 0x26, 0xce, 0xf5, 0x34,
+    0xee, 0xea, 0x32, 0x36, 0x50, 0x71, 0xd7, 0x37, 0xdb, 0x0c, 0xf4, 0x0f,
+    0x1a, 0xe7, 0x20, 0x17, 0x87, 0xec, 0xd4, 0xc5, 0xc7, 0x12, 0xff, 0xf5,
+    0x18, 0xdc, 0x28, 0x5b, 0x45, 0x7f, 0xf4, 0xde, 0x75, 0x30, 0x26, 0xe6,
+    0x03, 0x3f, 0x23, 0x28, 0x8c, 0x4f, 0xbf, 0x00, 0x2b, 0x7a, 0xf5, 0xd6,
+    0xd3, 0x41, 0xd0, 0x4e, 0x10, 0x21, 0x28, 0x4d, 0x68, 0xa7, 0x04, 0x16,
+    0x62, 0xe9, 0x2b, 0xe6, 0xf7, 0x9f, 0x14, 0x31, 0x3b, 0x06, 0x0d, 0xdc,
+    0xba, 0xef, 0x1f, 0x54, 0x47, 0x50, 0xe0, 0x2e, 0x23, 0xf2, 0x6c, 0x5d,
+    0x30, 0x2c, 0x62, 0x40, 0xfe, 0x50, 0x1a, 0xfb, 0x7f, 0x3d, 0x52, 0x3d,
+    0xd4, 0x7c, 0x49, 0x39, 0x30, 0x6e, 0x31, 0x7e, 0x0a, 0xca, 0x32, 0x06,
+    0x7d, 0x00, 0x17, 0x26, 0xbf, 0x20, 0x3c, 0xfb, 0x0d, 0xcf, 0xcd, 0x81,
+    0xd4, 0x43, 0x4b, 0xf1, 0x2f, 0x2d, 0x39, 0x2a, 0x46, 0xdf, 0x10, 0x49,
+    0x56, 0x4b, 0x3a, 0x39, 0x40, 0xce, 0xdf, 0xf2, 0x59, 0xd4, 0xf8, 0xd8,
+    0xaf, 0xba, 0xdc, 0x35, 0xe3, 0x53, 0xdf, 0xf4, 0x7f, 0x09, 0x12, 0xf2,
+    0x04, 0x07, 0x2d, 0xe4, 0xfe, 0xda, 0x3a, 0xe9, 0x05, 0xaf, 0x5a, 0xb9,
+    0x0f, 0x2d, 0x25, 0x3b, 0x4e, 0x42, 0x1b, 0x69, 0xca, 0x0c, 0xd4, 0xef,
+    0xda, 0xbe, 0xcf, 0x0d, 0xf7, 0x21, 0xc7, 0xb4, 0x58, 0x12, 0xe0, 0xff,
+    0x00, 0x6a, 0x43, 0x36, 0x4e, 0x79, 0x51, 0xc9, 0xc2, 0xc5, 0xb8, 0xd9,
+    0xb6, 0xbc, 0xbe, 0xb6, 0xcf, 0x27, 0x5f, 0x19, 0x44, 0x12, 0x2d, 0x58,
+    0x0d, 0x24, 0xf7, 0xf6, 0x1f, 0x04, 0x40, 0x42, 0x49, 0x0f, 0x12, 0xf8,
+    0x0b, 0xf8, 0x29, 0xe1, 0x0b, 0x53, 0x1b, 0x40, 0x1a, 0x35, 0x25, 0x1f,
+    0x41, 0x1e, 0x14, 0xb5, 0xed, 0xf9, 0xd5, 0xe0, 0xc2, 0xc8, 0x17, 0x15,
+    0x14, 0xf5, 0xfc, 0xce, 0x1b, 0xd9, 0x4d, 0x48, 0x28, 0x81, 0x3b, 0x0e,
+    0x53, 0xa0, 0x28, 0xd2, 0xe3, 0xd1, 0x9e, 0x1d, 0x91, 0x57, 0x32, 0xad,
+    0xed, 0xca, 0xdc, 0x0d, 0x6d, 0x4e, 0x16, 0xe0, 0x01, 0x63, 0xbd, 0xe8,
+    0x74, 0xfb, 0x16, 0x0a, 0xf8, 0xeb, 0xf8, 0xce, 0x9f, 0x03, 0x03, 0x17,
+    0xf1, 0x36, 0xb3, 0x20, 0xf6, 0xe7, 0x45, 0x21, 0xb5, 0x08, 0xf3, 0x6c,
+    0x1f, 0xec, 0xd3, 0x07, 0x9f, 0xa0, 0x81, 0x82, 0x58, 0x7e, 0x74, 0x53,
+    0x25, 0x6b, 0xf2, 0x6c, 0x5e, 0x19, 0x47, 0x34, 0x1c, 0x4d, 0xde, 0x35,
+    0xe1, 0xf5, 0x28, 0xae, 0xfd, 0xb7, 0xba, 0x2a, 0x89, 0x7f, 0xbb, 0xb1,
+    0xc5, 0xce, 0xc8, 0x88, 0x20, 0x3b, 0xaa, 0xd8, 0xeb, 0x6b, 0x87, 0xc1,
+    0x27, 0xa5, 0x03, 0xea, 0xb4, 0xc4, 0x67, 0xf4, 0x71, 0xc6, 0x38, 0xcf,
+    0xa7, 0xa6, 0x9c, 0x48, 0xaa, 0x11, 0x8d, 0x1b, 0xae, 0x3d, 0x1a, 0x8a,
+    0xb6, 0x7c, 0x8a, 0xaa, 0xa7, 0x0f, 0x9d, 0x08, 0x44, 0xf5, 0x38, 0x50,
+    0x48, 0xd7, 0xb0, 0x4c, 0x37, 0xf0, 0x6e, 0x65, 0x5f, 0x7e, 0xd0, 0x24,
+    0xae, 0xb0, 0x1c, 0xbc, 0x5c, 0x1f, 0xaf, 0xfc, 0x4e, 0xfd, 0xff, 0xff,
+    0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2b, 0x01, 0x00, 0x00,
+    0xb4, 0xfe, 0xff, 0xff, 0xb3, 0x07, 0x00, 0x00, 0xe6, 0x0d, 0x00, 0x00,
+    0xed, 0x09, 0x00, 0x00, 0xe1, 0xfe, 0xff, 0xff, 0x8c, 0x13, 0x00, 0x00,
+    0x2c, 0x10, 0x00, 0x00, 0x03, 0x0a, 0x00, 0x00, 0x99, 0x0b, 0x00, 0x00,
+    0xb7, 0x0c, 0x00, 0x00, 0xad, 0x07, 0x00, 0x00, 0x51, 0x0c, 0x00, 0x00,
+    0xba, 0xf9, 0xff, 0xff, 0xef, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9a, 0xfd, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0xea, 0xe7, 0x81, 0x65, 0x60, 0xaf, 0xd9, 0x44, 0xe3, 0xc3, 0x07, 0x96,
+    0x08, 0xc7, 0xdf, 0xc1, 0x7f, 0xe4, 0xc4, 0x52, 0x0e, 0x12, 0xe2, 0x53,
+    0x3d, 0x1d, 0xcf, 0xbf, 0x9d, 0x5d, 0x64, 0xca, 0xfd, 0xf4, 0xa0, 0x7f,
+    0x05, 0xa4, 0x70, 0x58, 0xe4, 0x1a, 0x03, 0xd9, 0xfa, 0xc5, 0x62, 0xce,
+    0x81, 0x81, 0x6b, 0xdc, 0x59, 0x0a, 0x13, 0x37, 0x2e, 0xd9, 0x39, 0x7b,
+    0x5b, 0xe2, 0xa3, 0xf1, 0x18, 0x2c, 0x81, 0x8b, 0x0d, 0x7a, 0x84, 0x49,
+    0xf9, 0x51, 0x86, 0x7c, 0x9b, 0x7d, 0x15, 0xd4, 0x82, 0x24, 0xa7, 0x6a,
+    0x7f, 0x0f, 0xd8, 0x35, 0x2b, 0x6b, 0x60, 0x24, 0xcc, 0xb3, 0x21, 0x00,
+    0x47, 0xf2, 0xe3, 0x00, 0x8f, 0xd5, 0xa4, 0xc4, 0x28, 0xf7, 0x3d, 0xf0,
+    0x81, 0x94, 0xba, 0x4b, 0x84, 0x47, 0x4e, 0x50, 0x4c, 0xd4, 0xf1, 0xdc,
+    0x18, 0xbf, 0x79, 0x04, 0xc9, 0x7f, 0xb2, 0xf7, 0x7e, 0xee, 0xb5, 0x0b,
+    0x7f, 0x5e, 0x56, 0x11, 0xab, 0x2b, 0x3f, 0x97, 0x8a, 0x1d, 0xb9, 0xfb,
+    0x5c, 0x58, 0xf8, 0x1b, 0xa7, 0xba, 0x7f, 0x65, 0x14, 0x0a, 0xf9, 0xe5,
+    0xe0, 0x2c, 0x0b, 0xd9, 0xe7, 0xc1, 0x7f, 0x3e, 0x56, 0x52, 0x34, 0xc5,
+    0x57, 0xe0, 0x20, 0x35, 0x70, 0xf1, 0xa6, 0xfa, 0x74, 0xd4, 0x61, 0xc2,
+    0x53, 0x24, 0x7f, 0x06, 0xd6, 0x1d, 0xf6, 0xb4, 0x52, 0xef, 0x43, 0x55,
+    0x7f, 0xbd, 0x2a, 0x09, 0x55, 0x81, 0xc8, 0x48, 0xa2, 0xa4, 0x3d, 0xf3,
+    0x02, 0xe4, 0x8c, 0xce, 0x97, 0xfd, 0x9f, 0xee, 0x7f, 0xd5, 0x1a, 0x01,
+    0xe6, 0x5e, 0x79, 0x51, 0x10, 0xf6, 0x37, 0x40, 0x7f, 0x13, 0x4a, 0xac,
+    0x0c, 0xca, 0x18, 0xf5, 0x05, 0xa3, 0xcf, 0xbb, 0xdf, 0xc8, 0xd0, 0xe3,
+    0x83, 0x81, 0xee, 0x72, 0xe7, 0xf5, 0xfb, 0xd5, 0xd5, 0x3a, 0xe3, 0xdd,
+    0xe1, 0x94, 0xe4, 0x99, 0xa6, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00,
+    0xab, 0x01, 0x00, 0x00, 0x4d, 0x02, 0x00, 0x00, 0xfd, 0xfe, 0xff, 0xff,
+    0xab, 0x01, 0x00, 0x00, 0xa4, 0xfe, 0xff, 0xff, 0xd1, 0xff, 0xff, 0xff,
+    0xf4, 0x00, 0x00, 0x00, 0xf5, 0x01, 0x00, 0x00, 0xfe, 0x01, 0x00, 0x00,
+    0xfc, 0x03, 0x00, 0x00, 0xc7, 0xfe, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00,
+    0x05, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xf2, 0xfe, 0xff, 0xff,
+    0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xe3, 0xd9, 0xfd, 0x3c,
+    0xfc, 0x64, 0x07, 0x60, 0x90, 0x81, 0x2c, 0xce, 0xc0, 0x5c, 0x2b, 0x20,
+    0xda, 0x43, 0x4b, 0x81, 0x9b, 0x37, 0xed, 0x9e, 0x37, 0x40, 0xcb, 0x7b,
+    0x24, 0x2f, 0x2d, 0x22, 0x24, 0x81, 0xd9, 0x70, 0x99, 0x83, 0xfe, 0xbe,
+    0x32, 0x09, 0x50, 0x5b, 0x11, 0x87, 0xec, 0x36, 0x13, 0x37, 0x81, 0xa0,
+    0x6b, 0xe8, 0xeb, 0xd6, 0xa5, 0x25, 0xc4, 0xaa, 0x35, 0xdc, 0xb0, 0xc6,
+    0x3e, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0xbf, 0xfe, 0xff, 0xff, 0x76, 0x00, 0x00, 0x00, 0xbb, 0x01, 0x00, 0x00,
+    0xf6, 0xfe, 0xff, 0xff, 0x5a, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
+    0xb0, 0xf1, 0xff, 0xff, 0xb4, 0xf1, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
+    0x4d, 0x4c, 0x49, 0x52, 0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x2e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00,
+    0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x14, 0x02, 0x00, 0x00,
+    0x18, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00,
+    0x44, 0x01, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00,
+    0x78, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0xe2, 0xfe, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xff,
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x78, 0xf2, 0xff, 0xff,
+    0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x4e, 0xff, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00,
+    0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x50, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+    0x1a, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00,
+    0x0e, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x34, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x17, 0x00, 0x10, 0x00, 0x0c, 0x00,
+    0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00,
+    0x0e, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x28, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00,
+    0x13, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+    0x28, 0x0c, 0x00, 0x00, 0xcc, 0x0b, 0x00, 0x00, 0x2c, 0x0b, 0x00, 0x00,
+    0xa0, 0x0a, 0x00, 0x00, 0x8c, 0x09, 0x00, 0x00, 0x70, 0x08, 0x00, 0x00,
+    0x5c, 0x07, 0x00, 0x00, 0x38, 0x06, 0x00, 0x00, 0x84, 0x05, 0x00, 0x00,
+    0xc0, 0x04, 0x00, 0x00, 0xec, 0x03, 0x00, 0x00, 0x50, 0x03, 0x00, 0x00,
+    0x5c, 0x02, 0x00, 0x00, 0xd8, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x32, 0xf4, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x3c, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x50, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x04, 0x00, 0x00, 0x00, 0x14, 0xf4, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3b,
+    0x1b, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x74, 0x65, 0x66, 0x75, 0x6c,
+    0x50, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x65, 0x64, 0x43,
+    0x61, 0x6c, 0x6c, 0x5f, 0x31, 0x3a, 0x30, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xaa, 0xf4, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x78, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x04, 0x00, 0x00, 0x00, 0x8c, 0xf4, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x43, 0xac, 0xdf, 0x3d, 0x3c, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+    0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e,
+    0x73, 0x65, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75,
+    0x6c, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c,
+    0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x5f, 0x32,
+    0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x4a, 0xf5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x88, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x2c, 0xf5, 0xff, 0xff,
+    0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+    0x49, 0x27, 0x38, 0x3d, 0x52, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+    0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e,
+    0x73, 0x65, 0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b,
+    0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31,
+    0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c,
+    0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c,
+    0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x2f, 0x42,
+    0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xfa, 0xf5, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x58, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x10, 0x00, 0x00, 0x00, 0xdc, 0xf5, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x8d, 0xd4, 0xd5, 0x3c, 0x1e, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+    0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x66, 0x6c, 0x61,
+    0x74, 0x74, 0x65, 0x6e, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x73, 0x68, 0x61,
+    0x70, 0x65, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x7a, 0xf6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+    0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xc0, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x64, 0xf6, 0xff, 0xff,
+    0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+    0x8d, 0xd4, 0xd5, 0x3c, 0x80, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+    0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e,
+    0x76, 0x32, 0x64, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x52, 0x65, 0x6c, 0x75,
+    0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f,
+    0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x5f, 0x32,
+    0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x73, 0x65, 0x71,
+    0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f,
+    0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x63, 0x6f, 0x6e,
+    0x76, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3b, 0x73, 0x65, 0x71,
+    0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f,
+    0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x53, 0x71, 0x75,
+    0x65, 0x65, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x6a, 0xf7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+    0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x68, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x54, 0xf7, 0xff, 0xff,
+    0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x82, 0x90, 0x10, 0x3c, 0x26, 0x00, 0x00, 0x00,
+    0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31,
+    0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67,
+    0x32, 0x64, 0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x78, 0x50, 0x6f, 0x6f, 0x6c,
+    0x32, 0x64, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x02, 0xf8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xa0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0xec, 0xf7, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x82, 0x90, 0x10, 0x3c, 0x5c, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+    0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e,
+    0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73,
+    0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f,
+    0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61,
+    0x73, 0x41, 0x64, 0x64, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74,
+    0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
+    0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x6f, 0x6c, 0x75, 0x74, 0x69,
+    0x6f, 0x6e, 0x3b, 0x31, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x2a, 0xf9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+    0x14, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x94, 0x00, 0x00, 0x00, 0xa4, 0xf8, 0xff, 0xff,
+    0x08, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0xb7, 0xd8, 0x88, 0x3b, 0xa2, 0xec, 0x8a, 0x3b, 0x39, 0x0e, 0x7a, 0x3b,
+    0x1f, 0xe5, 0x87, 0x3b, 0x7f, 0x4a, 0x83, 0x3b, 0xd4, 0xbc, 0x79, 0x3b,
+    0x8d, 0x4c, 0x89, 0x3b, 0x19, 0xc2, 0x6f, 0x3b, 0x12, 0x00, 0x00, 0x00,
+    0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71,
+    0x63, 0x6f, 0x6e, 0x73, 0x74, 0x37, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xea, 0xf9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+    0x14, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x64, 0xf9, 0xff, 0xff,
+    0x08, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1a, 0x62, 0x89, 0x37,
+    0x1b, 0x78, 0x8b, 0x37, 0x43, 0x09, 0x7b, 0x37, 0x8d, 0x6d, 0x88, 0x37,
+    0x4e, 0xce, 0x83, 0x37, 0x8d, 0xb7, 0x7a, 0x37, 0x64, 0xd6, 0x89, 0x37,
+    0xcd, 0xb2, 0x70, 0x37, 0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e,
+    0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73,
+    0x74, 0x36, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x9a, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+    0xe8, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xf4, 0x00, 0x00, 0x00, 0x14, 0xfa, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+    0x8c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x7f, 0x47, 0x72, 0x3b, 0xa9, 0xfd, 0x30, 0x3b, 0xd4, 0x05, 0x4e, 0x3b,
+    0x5c, 0xdc, 0x63, 0x3b, 0xa4, 0x27, 0x31, 0x3b, 0x3e, 0x28, 0x56, 0x3b,
+    0x7e, 0x08, 0x6f, 0x3b, 0x0d, 0x40, 0x2e, 0x3b, 0x7f, 0x80, 0x42, 0x3b,
+    0x66, 0x2e, 0x46, 0x3b, 0x98, 0xd8, 0x46, 0x3b, 0x67, 0x9b, 0x4a, 0x3b,
+    0xc4, 0xad, 0x4a, 0x3b, 0xd9, 0xc1, 0x5b, 0x3b, 0xc6, 0x98, 0x2a, 0x3b,
+    0x4a, 0x57, 0xa5, 0x3a, 0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e,
+    0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73,
+    0x74, 0x35, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0xba, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+    0xe4, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0xf0, 0x00, 0x00, 0x00, 0x34, 0xfb, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+    0x88, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xfb, 0xd0, 0x08, 0x38,
+    0x2f, 0xe5, 0xc7, 0x37, 0x26, 0xaf, 0xe8, 0x37, 0x93, 0xac, 0x00, 0x38,
+    0x99, 0x14, 0xc8, 0x37, 0x0d, 0xdf, 0xf1, 0x37, 0xb5, 0xfb, 0x06, 0x38,
+    0xc8, 0xcc, 0xc4, 0x37, 0x25, 0xac, 0xdb, 0x37, 0xf0, 0xd3, 0xdf, 0x37,
+    0x29, 0x94, 0xe0, 0x37, 0x90, 0xd3, 0xe4, 0x37, 0x4e, 0xe8, 0xe4, 0x37,
+    0x2d, 0x32, 0xf8, 0x37, 0x78, 0xac, 0xc0, 0x37, 0xdd, 0xbc, 0x3a, 0x37,
+    0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75,
+    0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x34, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xca, 0xfc, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xf4, 0x00, 0x00, 0x00,
+    0x44, 0xfc, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x24, 0x5a, 0x52, 0x3b,
+    0x1c, 0x1d, 0xb0, 0x3b, 0x1d, 0x72, 0xb3, 0x3b, 0x18, 0x45, 0xad, 0x3b,
+    0x57, 0x9e, 0x97, 0x3b, 0x6e, 0x68, 0xac, 0x3b, 0x0f, 0x34, 0x4b, 0x3b,
+    0x56, 0x44, 0x87, 0x3b, 0x3c, 0xa4, 0x6f, 0x3b, 0x98, 0x78, 0xb6, 0x3b,
+    0xcd, 0x42, 0xc3, 0x3b, 0x74, 0x86, 0x7e, 0x3b, 0xf8, 0x9e, 0x35, 0x3b,
+    0x00, 0xc4, 0x9d, 0x3b, 0xf0, 0xe3, 0x4e, 0x3b, 0xe1, 0x33, 0x3f, 0x3b,
+    0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75,
+    0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x33, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0xe2, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+    0xe4, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0xf0, 0x00, 0x00, 0x00, 0x5c, 0xfd, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+    0x88, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xa6, 0xb3, 0xaf, 0x38,
+    0x71, 0x1a, 0x13, 0x39, 0xef, 0xe2, 0x15, 0x39, 0x5a, 0xba, 0x10, 0x39,
+    0x42, 0x49, 0xfd, 0x38, 0x09, 0x02, 0x10, 0x39, 0x08, 0xbb, 0xa9, 0x38,
+    0x55, 0xf8, 0xe1, 0x38, 0x9e, 0x2a, 0xc8, 0x38, 0xd7, 0x69, 0x18, 0x39,
+    0xb3, 0x18, 0x23, 0x39, 0x32, 0x99, 0xd4, 0x38, 0x10, 0xb4, 0x97, 0x38,
+    0x11, 0xc7, 0x03, 0x39, 0x6d, 0xcf, 0xac, 0x38, 0xea, 0xb4, 0x9f, 0x38,
+    0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75,
+    0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x32, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xf2, 0xfe, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x64, 0x00, 0x00, 0x00,
+    0x6c, 0xfe, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x14, 0x59, 0xe6, 0x3b,
+    0x9d, 0xa3, 0xe3, 0x3b, 0xed, 0x58, 0xce, 0x3b, 0xd5, 0x4c, 0xe1, 0x3b,
+    0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75,
+    0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x31, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x7a, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+    0x58, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x64, 0x00, 0x00, 0x00, 0xf4, 0xfe, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+    0x2c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x60, 0xb3, 0xa5, 0x39, 0x88, 0xc0, 0xa3, 0x39, 0x95, 0x6f, 0x94, 0x39,
+    0xcc, 0x11, 0xa2, 0x39, 0x11, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e,
+    0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73,
+    0x74, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x17, 0x00, 0x10, 0x00,
+    0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+    0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f,
+    0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x20, 0x00, 0x1c, 0x00,
+    0x1b, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x18, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x6c, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x81, 0x80, 0x80, 0x3b, 0x1e, 0x00, 0x00, 0x00,
+    0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61,
+    0x75, 0x6c, 0x74, 0x5f, 0x6b, 0x65, 0x72, 0x61, 0x73, 0x5f, 0x74, 0x65,
+    0x6e, 0x73, 0x6f, 0x72, 0x3a, 0x30, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+    0x48, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0xb8, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xc8, 0xff, 0xff, 0xff,
+    0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x0c, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+    0xf0, 0xff, 0xff, 0xff, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x0c, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+};
+
+const int g_cnn_fused_model_int8_len = 7280;
@@ -1,7 +1,19 @@
-#ifndef MODEL8_H_
-#define MODEL8_H_
+#ifndef CNN_MODEL8_H_
+#define CNN_MODEL8_H_
 
 extern const unsigned char g_cnn_model_int8[];
 extern const int g_cnn_model_int8_len;
 
-#endif  // MODEL8_H_
\ No newline at end of file
+// Fixed batch-N variants (scripts/make_batched_model.py)
+extern const unsigned char g_cnn_b2_model_int8[];
+extern const int g_cnn_b2_model_int8_len;
+extern const unsigned char g_cnn_b4_model_int8[];
+extern const int g_cnn_b4_model_int8_len;
+extern const unsigned char g_cnn_b8_model_int8[];
+extern const int g_cnn_b8_model_int8_len;
+
+// CONV_2D + MAX_POOL_2D fused into CONV_RELU_POOL (scripts/fuse_conv_pool.py)
+extern const unsigned char g_cnn_fused_model_int8[];
+extern const int g_cnn_fused_model_int8_len;
+
+#endif  // CNN_MODEL8_H_
\ No newline at end of file
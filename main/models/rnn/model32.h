@@ -1,7 +1,11 @@
-#ifndef MODEL32_H_
-#define MODEL32_H_
+#ifndef RNN_MODEL32_H_
+#define RNN_MODEL32_H_
 
 extern const unsigned char g_rnn_model_float32[];
 extern const int g_rnn_model_float32_len;
 
-#endif  // MODEL32_H_
\ No newline at end of file
+// One timestep per Invoke(), LSTM state kept in the arena between calls
+extern const unsigned char g_rnn_stream_model_float32[];
+extern const int g_rnn_stream_model_float32_len;
+
+#endif  // RNN_MODEL32_H_
\ No newline at end of file
@@ -1,7 +1,7 @@
-#ifndef MODEL8_H_
-#define MODEL8_H_
+#ifndef RNN_MODEL8_H_
+#define RNN_MODEL8_H_
 
 extern const unsigned char g_rnn_model_int8[];
 extern const int g_rnn_model_int8_len;
 
-#endif  // MODEL8_H_
\ No newline at end of file
+#endif  // RNN_MODEL8_H_
\ No newline at end of file
@@ -0,0 +1,691 @@
+#include "model32.h"
+
+alignas(8) const unsigned char g_rnn_stream_model_float32[] = {
+    0x18, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x0e, 0x00, 0x18, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x7c, 0x00, 0x00, 0x00, 0xdc, 0x08, 0x00, 0x00, 0x10, 0x09, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+    0x54, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x10, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+    0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x18, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x7c, 0x06, 0x00, 0x00, 0x80, 0x06, 0x00, 0x00, 0x84, 0x06, 0x00, 0x00,
+    0x2c, 0x08, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
+    0xa8, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00,
+    0x74, 0x01, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x00,
+    0x40, 0x02, 0x00, 0x00, 0x84, 0x02, 0x00, 0x00, 0xc8, 0x02, 0x00, 0x00,
+    0x04, 0x03, 0x00, 0x00, 0x40, 0x03, 0x00, 0x00, 0x7c, 0x03, 0x00, 0x00,
+    0xc0, 0x03, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00,
+    0x84, 0x04, 0x00, 0x00, 0xc0, 0x04, 0x00, 0x00, 0xfc, 0x04, 0x00, 0x00,
+    0x30, 0x05, 0x00, 0x00, 0x6c, 0x05, 0x00, 0x00, 0xa8, 0x05, 0x00, 0x00,
+    0xdc, 0x05, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x04, 0x00, 0x10, 0x00,
+    0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x04, 0x00,
+    0x10, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+    0x6c, 0x73, 0x74, 0x6d, 0x2f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5f, 0x6b,
+    0x65, 0x72, 0x6e, 0x65, 0x6c, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x04, 0x00,
+    0x10, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+    0x6c, 0x73, 0x74, 0x6d, 0x2f, 0x66, 0x6f, 0x72, 0x67, 0x65, 0x74, 0x5f,
+    0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00,
+    0x04, 0x00, 0x10, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x6c, 0x73, 0x74, 0x6d, 0x2f, 0x63, 0x65, 0x6c, 0x6c, 0x5f, 0x6b, 0x65,
+    0x72, 0x6e, 0x65, 0x6c, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x04, 0x00,
+    0x10, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+    0x6c, 0x73, 0x74, 0x6d, 0x2f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5f,
+    0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00,
+    0x04, 0x00, 0x10, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x6c, 0x73, 0x74, 0x6d, 0x2f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5f, 0x72,
+    0x65, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x00, 0x00, 0x0c, 0x00,
+    0x14, 0x00, 0x04, 0x00, 0x10, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+    0x6c, 0x73, 0x74, 0x6d, 0x2f, 0x66, 0x6f, 0x72, 0x67, 0x65, 0x74, 0x5f,
+    0x72, 0x65, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x00, 0x0c, 0x00,
+    0x14, 0x00, 0x04, 0x00, 0x10, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+    0x6c, 0x73, 0x74, 0x6d, 0x2f, 0x63, 0x65, 0x6c, 0x6c, 0x5f, 0x72, 0x65,
+    0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x00, 0x0c, 0x00, 0x14, 0x00,
+    0x04, 0x00, 0x10, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+    0x6c, 0x73, 0x74, 0x6d, 0x2f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5f,
+    0x72, 0x65, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x00, 0x0c, 0x00,
+    0x14, 0x00, 0x04, 0x00, 0x10, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x6c, 0x73, 0x74, 0x6d,
+    0x2f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5f, 0x62, 0x69, 0x61, 0x73, 0x00,
+    0x0c, 0x00, 0x14, 0x00, 0x04, 0x00, 0x10, 0x00, 0x08, 0x00, 0x0c, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x0a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x6c, 0x73, 0x74, 0x6d, 0x2f, 0x66, 0x6f, 0x72, 0x67, 0x65, 0x74, 0x5f,
+    0x62, 0x69, 0x61, 0x73, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x04, 0x00,
+    0x10, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x00, 0x00, 0x6c, 0x73, 0x74, 0x6d, 0x2f, 0x63, 0x65, 0x6c,
+    0x6c, 0x5f, 0x62, 0x69, 0x61, 0x73, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00,
+    0x04, 0x00, 0x10, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x6c, 0x73, 0x74, 0x6d,
+    0x2f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5f, 0x62, 0x69, 0x61, 0x73,
+    0x00, 0x00, 0x10, 0x00, 0x14, 0x00, 0x04, 0x00, 0x10, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+    0x6c, 0x73, 0x74, 0x6d, 0x2f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5f,
+    0x73, 0x74, 0x61, 0x74, 0x65, 0x00, 0x10, 0x00, 0x14, 0x00, 0x04, 0x00,
+    0x10, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+    0x12, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x6c, 0x73, 0x74, 0x6d, 0x2f, 0x63, 0x65, 0x6c, 0x6c, 0x5f, 0x73, 0x74,
+    0x61, 0x74, 0x65, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x04, 0x00, 0x10, 0x00,
+    0x08, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x6c, 0x73, 0x74, 0x6d,
+    0x2f, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x00, 0x0c, 0x00,
+    0x14, 0x00, 0x04, 0x00, 0x10, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x0d, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x30, 0x2f,
+    0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x73, 0x00, 0x0c, 0x00, 0x14, 0x00,
+    0x04, 0x00, 0x10, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x30, 0x2f,
+    0x62, 0x69, 0x61, 0x73, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x04, 0x00,
+    0x10, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+    0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x30, 0x00, 0x0c, 0x00, 0x14, 0x00,
+    0x04, 0x00, 0x10, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x64, 0x65, 0x6e, 0x73,
+    0x65, 0x5f, 0x31, 0x2f, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x73, 0x00,
+    0x0c, 0x00, 0x14, 0x00, 0x04, 0x00, 0x10, 0x00, 0x08, 0x00, 0x0c, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x64, 0x65, 0x6e, 0x73,
+    0x65, 0x5f, 0x31, 0x2f, 0x62, 0x69, 0x61, 0x73, 0x00, 0x00, 0x0c, 0x00,
+    0x14, 0x00, 0x04, 0x00, 0x10, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x00,
+    0x0c, 0x00, 0x14, 0x00, 0x04, 0x00, 0x10, 0x00, 0x08, 0x00, 0x0c, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+    0x70, 0x72, 0x6f, 0x62, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x69, 0x65,
+    0x73, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+    0x64, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x14, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x09, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x10, 0x00,
+    0x0c, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0d, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x18, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x14, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x12, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x14, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
+    0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x4c, 0x53, 0x54, 0x4d,
+    0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x69, 0x66, 0x69, 0x65, 0x72, 0x2c,
+    0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x69, 0x6e, 0x67, 0x2c, 0x20,
+    0x31, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x74, 0x65, 0x70, 0x20, 0x70,
+    0x65, 0x72, 0x20, 0x49, 0x6e, 0x76, 0x6f, 0x6b, 0x65, 0x00, 0x00, 0x00,
+    0x11, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+    0xb0, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x68, 0x01, 0x00, 0x00,
+    0xc4, 0x01, 0x00, 0x00, 0xe0, 0x05, 0x00, 0x00, 0xfc, 0x09, 0x00, 0x00,
+    0x18, 0x0e, 0x00, 0x00, 0x34, 0x12, 0x00, 0x00, 0x90, 0x12, 0x00, 0x00,
+    0xec, 0x12, 0x00, 0x00, 0x48, 0x13, 0x00, 0x00, 0xa4, 0x13, 0x00, 0x00,
+    0xc0, 0x15, 0x00, 0x00, 0xfc, 0x15, 0x00, 0x00, 0x78, 0x16, 0x00, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xdb, 0x99, 0x38, 0xbd,
+    0x24, 0x35, 0x24, 0xbd, 0x29, 0xd1, 0xcf, 0xbe, 0x58, 0x13, 0xe9, 0xbd,
+    0x4c, 0x19, 0x11, 0x3f, 0xc8, 0xea, 0x9e, 0xbe, 0xd0, 0x81, 0x94, 0x3e,
+    0x52, 0xa8, 0x03, 0x3e, 0x87, 0x6a, 0x73, 0x3e, 0x89, 0xe7, 0x71, 0x3e,
+    0x6d, 0x22, 0x52, 0x3e, 0x58, 0x67, 0xd1, 0x3e, 0x38, 0xc7, 0xdc, 0x3d,
+    0xd1, 0x0e, 0x98, 0xbe, 0xac, 0x4c, 0xf5, 0x3d, 0x41, 0xa3, 0x3f, 0x3d,
+    0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0c, 0x98, 0x69, 0x3d,
+    0x8f, 0x3a, 0x37, 0x3e, 0x32, 0xf2, 0x6f, 0x3e, 0x66, 0x4c, 0xae, 0x3e,
+    0x6e, 0xa0, 0x76, 0xbd, 0xa3, 0x2c, 0x98, 0x3c, 0x9b, 0x89, 0x56, 0xbd,
+    0x64, 0x51, 0x82, 0x3e, 0x4a, 0xb1, 0x57, 0xbd, 0xf5, 0x3f, 0x7f, 0xbd,
+    0x15, 0x7e, 0xc1, 0x3e, 0x38, 0x49, 0x28, 0xbd, 0xf4, 0xf8, 0x98, 0xbe,
+    0x9d, 0xdc, 0x62, 0xbe, 0xf9, 0x31, 0x03, 0x3d, 0xab, 0x9e, 0x12, 0x3e,
+    0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x37, 0x58, 0x35, 0x3d,
+    0x7e, 0x23, 0x5b, 0xbe, 0x47, 0x4b, 0x85, 0x3e, 0xdc, 0x90, 0x1c, 0xbf,
+    0x57, 0xae, 0x30, 0x3e, 0xd2, 0x98, 0xe5, 0x3e, 0x37, 0xb9, 0x06, 0x3e,
+    0x55, 0x08, 0xb8, 0x3d, 0xaf, 0x2a, 0x13, 0xbe, 0x18, 0x39, 0x1b, 0xbe,
+    0x7c, 0x56, 0xb0, 0xbc, 0x52, 0xfa, 0xa4, 0xbe, 0x53, 0x66, 0xec, 0x3d,
+    0x10, 0x70, 0xb4, 0x3e, 0xab, 0x28, 0xf3, 0xbd, 0xfb, 0x3f, 0x37, 0x3e,
+    0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x76, 0x82, 0xc1, 0x3e,
+    0x90, 0x06, 0x01, 0x3f, 0xd9, 0xd1, 0xa8, 0x3e, 0xea, 0x5a, 0xf4, 0x39,
+    0x36, 0xb7, 0x8d, 0x3e, 0x6a, 0x77, 0x07, 0x3e, 0x85, 0xb3, 0xcc, 0x3e,
+    0xf0, 0xa7, 0x61, 0x3e, 0x88, 0x7d, 0x6a, 0xbe, 0xb4, 0x39, 0x82, 0x3e,
+    0x78, 0x36, 0x8a, 0x3e, 0xe5, 0xe2, 0x87, 0xbd, 0xba, 0xca, 0xb9, 0x3e,
+    0xa7, 0x20, 0x2b, 0x3d, 0x8f, 0x7d, 0xa0, 0x3d, 0x25, 0x03, 0xa9, 0x3e,
+    0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xb7, 0x24, 0x21, 0x3e,
+    0x08, 0xdf, 0xe4, 0xbd, 0x3b, 0xb8, 0xb8, 0xbe, 0x9d, 0x89, 0xf3, 0xbd,
+    0x22, 0xed, 0xe7, 0x3d, 0x8e, 0xd1, 0xae, 0x3e, 0x5c, 0x9c, 0x16, 0x3f,
+    0xcc, 0x4e, 0x4a, 0xbc, 0xa7, 0xb6, 0x12, 0xbf, 0x7c, 0x79, 0xc8, 0xbe,
+    0x65, 0x77, 0xe1, 0x3e, 0x95, 0x18, 0xab, 0xbe, 0x6a, 0xd9, 0xc8, 0x3d,
+    0x37, 0xbf, 0x7e, 0x3e, 0x96, 0x89, 0xcc, 0xbe, 0x2e, 0xd1, 0x75, 0x3e,
+    0x68, 0xc7, 0xba, 0x3e, 0xad, 0xa0, 0x0d, 0xbf, 0x18, 0xa0, 0x5d, 0x3f,
+    0xd2, 0x74, 0xac, 0xbd, 0x9e, 0x0a, 0xa2, 0x3e, 0x7c, 0x10, 0x4d, 0xbd,
+    0x50, 0x60, 0xf9, 0x3e, 0xb0, 0x7d, 0xcc, 0x3e, 0x88, 0x46, 0x58, 0x3d,
+    0x9c, 0x12, 0xa8, 0xbe, 0x1f, 0xd3, 0x6b, 0x3e, 0xe4, 0x9d, 0xa6, 0xbd,
+    0xbd, 0x1d, 0x01, 0x3f, 0x52, 0x0f, 0x23, 0x3d, 0xb6, 0x82, 0xd6, 0x3c,
+    0x59, 0x78, 0x78, 0x3e, 0x7b, 0xac, 0x51, 0x3e, 0x11, 0x0e, 0x9f, 0xbe,
+    0x8b, 0x38, 0x26, 0xbd, 0xb3, 0xb6, 0x40, 0xbe, 0x07, 0xd5, 0x34, 0x3e,
+    0x59, 0x9e, 0x59, 0x3e, 0x1a, 0x37, 0x8f, 0x3e, 0x61, 0xfb, 0xcf, 0x3d,
+    0x81, 0x60, 0x8e, 0xbe, 0xf6, 0x10, 0xf4, 0xbe, 0x1f, 0x04, 0xe9, 0xbd,
+    0x8f, 0x9c, 0xb3, 0xbe, 0x0c, 0x66, 0xb5, 0x3e, 0x3d, 0x58, 0x0a, 0x3e,
+    0x07, 0x35, 0xdc, 0xbe, 0xba, 0xd2, 0xa2, 0x3e, 0x69, 0xef, 0xed, 0x3b,
+    0xf1, 0xeb, 0x0d, 0xbe, 0x10, 0x3f, 0x96, 0x3e, 0x91, 0x93, 0x3d, 0xbe,
+    0xe6, 0x45, 0x8d, 0x3d, 0x75, 0xf5, 0x8c, 0x3e, 0x3d, 0x22, 0x59, 0x3d,
+    0x41, 0x54, 0x12, 0x3e, 0xdb, 0xc3, 0xb4, 0xbe, 0x74, 0xc4, 0x47, 0x3d,
+    0x30, 0xf6, 0x87, 0x3e, 0x9c, 0xd5, 0xe1, 0xbd, 0x4d, 0x86, 0xf9, 0xbd,
+    0x71, 0x1f, 0x1d, 0x3e, 0x7b, 0xb9, 0x44, 0x3e, 0x50, 0xd1, 0x0e, 0x3e,
+    0xd3, 0xe7, 0x22, 0xbe, 0x86, 0xae, 0xad, 0x3e, 0xf8, 0x58, 0x53, 0xbd,
+    0xfa, 0x9d, 0x00, 0x3e, 0x5b, 0x6a, 0x2a, 0xbf, 0x21, 0x82, 0x39, 0xbe,
+    0x74, 0xb4, 0x69, 0xbe, 0x88, 0x67, 0x8c, 0xbe, 0xc2, 0xd3, 0x09, 0x3c,
+    0x91, 0x9f, 0xc3, 0x3e, 0x29, 0xcb, 0x9b, 0x3e, 0xf6, 0x02, 0xf2, 0x3e,
+    0xe7, 0x26, 0x83, 0xbe, 0xfe, 0xf1, 0xb9, 0xbd, 0x58, 0x04, 0xc6, 0x3d,
+    0x2b, 0xf7, 0xa1, 0xbe, 0x94, 0x6a, 0xfe, 0x3e, 0x58, 0x53, 0x76, 0xbb,
+    0x92, 0x81, 0x7e, 0xbd, 0x3a, 0x2a, 0xa0, 0xbe, 0x2f, 0x50, 0xaf, 0xbd,
+    0xa4, 0x1e, 0xe4, 0x3b, 0x60, 0x52, 0xbf, 0xbd, 0x07, 0xa0, 0x32, 0x3e,
+    0xe2, 0x5b, 0xcf, 0xbe, 0x03, 0x5a, 0xad, 0xbd, 0x06, 0x0b, 0x57, 0xbe,
+    0xd8, 0x84, 0x7e, 0xbd, 0x2a, 0x49, 0x2c, 0xbe, 0x18, 0x11, 0x5a, 0x3e,
+    0x13, 0xd8, 0xd9, 0xbe, 0x3e, 0x8b, 0x19, 0x3e, 0xe2, 0x0f, 0x93, 0xbd,
+    0x39, 0x30, 0xfc, 0x3c, 0x14, 0x4e, 0xbc, 0xbe, 0x19, 0xa3, 0xdd, 0x3d,
+    0x3e, 0xf8, 0x94, 0xbe, 0x7f, 0x4f, 0xa7, 0xbe, 0xc2, 0xba, 0x29, 0xbe,
+    0x22, 0x69, 0x81, 0xbd, 0xaa, 0x5a, 0xc9, 0x3c, 0xb5, 0x12, 0xfd, 0x3c,
+    0x4e, 0xb7, 0x86, 0x3e, 0xbf, 0xad, 0x25, 0xbe, 0x16, 0xd4, 0x1a, 0x3d,
+    0xb4, 0x5a, 0xa2, 0xbb, 0x25, 0xbb, 0x84, 0x3e, 0x48, 0xdc, 0x81, 0xbc,
+    0xa8, 0xca, 0x6b, 0x3e, 0x5b, 0x1d, 0xe2, 0xbe, 0x08, 0x67, 0xb9, 0x3e,
+    0x3f, 0xed, 0x06, 0xbe, 0xc1, 0xf1, 0x83, 0x3e, 0x4f, 0x53, 0x2f, 0x3e,
+    0xc6, 0x18, 0x6b, 0x3e, 0x3c, 0xce, 0x90, 0x3e, 0xeb, 0xb2, 0xe6, 0xbd,
+    0x61, 0xe5, 0xdf, 0xbe, 0xb5, 0x8b, 0x28, 0x3f, 0x73, 0xcb, 0x83, 0xbe,
+    0x9c, 0x87, 0x3f, 0xbe, 0x4d, 0xb9, 0x82, 0x3d, 0x13, 0x35, 0x8d, 0xbe,
+    0xf1, 0x71, 0xbb, 0x3e, 0x09, 0x2b, 0x99, 0x3d, 0x5d, 0x09, 0x17, 0xbe,
+    0x1b, 0x4c, 0xa2, 0x3c, 0xc3, 0x26, 0x4c, 0xbe, 0x10, 0xfc, 0xf2, 0x3d,
+    0x6d, 0x58, 0xd8, 0x3d, 0xa8, 0x16, 0xb7, 0x3e, 0xd1, 0xd2, 0x6d, 0x3e,
+    0x69, 0xd1, 0xae, 0xbd, 0x86, 0x4b, 0x8f, 0xbe, 0x1f, 0x17, 0xe4, 0xbd,
+    0x84, 0xc2, 0x27, 0x3e, 0x72, 0x2e, 0x72, 0x3e, 0xa8, 0x28, 0x59, 0xbe,
+    0xc5, 0x08, 0x96, 0xbe, 0x4e, 0x07, 0x85, 0x3e, 0x6c, 0xd4, 0x9c, 0x3d,
+    0xe7, 0x28, 0x61, 0x3d, 0x37, 0x0d, 0x26, 0x3d, 0xd4, 0xcc, 0x28, 0xbe,
+    0x69, 0x74, 0x95, 0x3c, 0xe0, 0x7b, 0x3a, 0x3d, 0x68, 0xd8, 0x6c, 0x3b,
+    0x09, 0xb8, 0x56, 0x3d, 0x39, 0x10, 0xdc, 0xbe, 0xc7, 0xb5, 0x06, 0xbe,
+    0x60, 0x87, 0xb0, 0x3d, 0xd7, 0x9c, 0xcb, 0xbe, 0x21, 0x40, 0x99, 0xbe,
+    0x5a, 0xa4, 0x2d, 0x3e, 0xc3, 0xf4, 0x88, 0xbe, 0x0f, 0x50, 0x99, 0xbc,
+    0x1d, 0x1c, 0x4a, 0x3c, 0x4f, 0x76, 0x9c, 0xbd, 0xda, 0xce, 0x0e, 0xbe,
+    0xa3, 0x83, 0x55, 0xbe, 0x6d, 0x11, 0x97, 0x3e, 0x6d, 0x9e, 0x01, 0x3e,
+    0x7b, 0xbf, 0x56, 0x3d, 0xea, 0x4a, 0x8a, 0x3e, 0x99, 0xc4, 0x36, 0xbe,
+    0x96, 0x15, 0xc0, 0xbc, 0x0f, 0xd4, 0xa2, 0x3d, 0x68, 0xd3, 0xbb, 0xbe,
+    0x71, 0xe5, 0x83, 0x3e, 0xd8, 0xe8, 0x8b, 0xbc, 0x69, 0xcf, 0x0b, 0xbe,
+    0x95, 0xee, 0xa3, 0x3e, 0x55, 0xf6, 0xba, 0x3e, 0xb7, 0x22, 0xe2, 0x3d,
+    0x1b, 0xcc, 0xad, 0x3d, 0x18, 0x0e, 0x8e, 0xbd, 0xc8, 0x8d, 0x2b, 0x3e,
+    0x93, 0x20, 0xf2, 0x3d, 0x28, 0x77, 0x65, 0x3d, 0x13, 0xc5, 0x0b, 0xbd,
+    0xea, 0xe1, 0x77, 0xbe, 0x56, 0x8d, 0x52, 0xbe, 0x2e, 0xb4, 0xc6, 0x3c,
+    0xbf, 0xa8, 0xb9, 0xbd, 0xdf, 0x22, 0x40, 0xbd, 0x60, 0x76, 0x80, 0x3e,
+    0x92, 0x6c, 0x4e, 0xbe, 0x96, 0x10, 0x9b, 0x3e, 0xc9, 0xef, 0x9f, 0x3e,
+    0x4b, 0xe4, 0xfd, 0xbb, 0x9d, 0x47, 0xd4, 0x3e, 0xc8, 0x42, 0x9a, 0xbe,
+    0x07, 0x8b, 0xfd, 0xbd, 0x1f, 0x65, 0x5b, 0x3e, 0xe3, 0xe3, 0xeb, 0x3d,
+    0xcf, 0x45, 0xac, 0xbc, 0x21, 0xca, 0x91, 0xbe, 0x02, 0x14, 0x6a, 0xbe,
+    0x0c, 0x92, 0x27, 0x3d, 0xe1, 0x96, 0xc0, 0xbd, 0x83, 0x4a, 0x4b, 0xbe,
+    0x7c, 0x17, 0x79, 0x3e, 0xd0, 0x03, 0xe0, 0xbe, 0xef, 0x8d, 0xea, 0x3e,
+    0xd2, 0xcb, 0xf4, 0x3d, 0xfb, 0x21, 0xb3, 0xbd, 0x31, 0x88, 0x85, 0xbc,
+    0xd7, 0xf8, 0x33, 0xbe, 0x68, 0x0c, 0x6d, 0xba, 0x8e, 0xdf, 0x14, 0xbd,
+    0x10, 0xaf, 0x24, 0x3e, 0x5e, 0x9a, 0x99, 0x3e, 0x4d, 0x90, 0x69, 0xbe,
+    0xa5, 0x09, 0x85, 0xbe, 0x78, 0x73, 0xad, 0xbe, 0xdf, 0x7b, 0x17, 0xbe,
+    0x4a, 0xa0, 0x94, 0xbc, 0x2c, 0xa5, 0x43, 0x3c, 0xfe, 0x3a, 0xb9, 0xbe,
+    0xc1, 0xb2, 0x79, 0x3e, 0xc5, 0x36, 0x51, 0x3e, 0x98, 0x49, 0x6c, 0xbe,
+    0xee, 0xd3, 0x0c, 0xbd, 0x46, 0xd6, 0x7e, 0xbe, 0x0f, 0xa5, 0x00, 0x3f,
+    0xcd, 0x36, 0x9e, 0xbd, 0xe6, 0xee, 0x90, 0x3e, 0x49, 0xd2, 0x46, 0x3e,
+    0xa8, 0xc7, 0x20, 0xbe, 0xcb, 0x74, 0x94, 0xbe, 0x24, 0x92, 0x68, 0xbe,
+    0x09, 0xe5, 0x35, 0xbe, 0x8c, 0x41, 0xde, 0x3e, 0xe2, 0xbe, 0x6b, 0xbe,
+    0x0d, 0xf3, 0x8c, 0xbe, 0x34, 0xa5, 0x66, 0x3d, 0x19, 0xfe, 0x89, 0x3e,
+    0xc8, 0x75, 0xb4, 0x3c, 0xc5, 0x4f, 0x9a, 0x3e, 0x4d, 0xc6, 0xec, 0xbe,
+    0xf4, 0x48, 0x50, 0x3e, 0x87, 0x7f, 0xf0, 0x3d, 0x96, 0xc4, 0x83, 0x3e,
+    0x69, 0x98, 0xa2, 0x3e, 0x81, 0x54, 0x3e, 0xbe, 0xfc, 0xbc, 0xa2, 0xbe,
+    0x17, 0xa3, 0xaf, 0x3e, 0x08, 0x9d, 0x35, 0xbe, 0xf8, 0x6e, 0x43, 0x3e,
+    0x80, 0xdd, 0x93, 0x3e, 0x71, 0xb0, 0x8d, 0xbe, 0x7c, 0xef, 0x12, 0x3e,
+    0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x37, 0x83, 0x47, 0x3e,
+    0xc8, 0xab, 0x8d, 0x3d, 0xc3, 0xd7, 0xa2, 0xbe, 0x75, 0x6d, 0x43, 0xbd,
+    0xc1, 0x3d, 0xb4, 0x3e, 0x6b, 0x67, 0x83, 0x3d, 0x36, 0x0f, 0xe8, 0x3e,
+    0x48, 0x9a, 0x4b, 0x3e, 0x55, 0xf6, 0xb0, 0x3c, 0x7c, 0x66, 0x9e, 0xbd,
+    0xea, 0x57, 0x94, 0xbe, 0x58, 0x29, 0xc0, 0xbd, 0x2c, 0xc2, 0x8f, 0x3e,
+    0x3a, 0x42, 0xe6, 0x3c, 0x36, 0x90, 0x4c, 0xbe, 0x13, 0x3d, 0xd0, 0x3d,
+    0x02, 0xf6, 0x00, 0xbe, 0xad, 0xba, 0xfe, 0x3d, 0x95, 0x97, 0x9c, 0xbe,
+    0x29, 0xd2, 0xef, 0xbd, 0x79, 0x9a, 0x99, 0xbc, 0x52, 0x42, 0x19, 0x3d,
+    0x65, 0x4c, 0x3f, 0x3d, 0xb4, 0xe9, 0x4d, 0x3e, 0x79, 0xdb, 0x27, 0xbd,
+    0x7a, 0xc2, 0x11, 0x3d, 0x13, 0xf3, 0xb9, 0x3e, 0xdc, 0xe1, 0x20, 0x3e,
+    0x48, 0x11, 0xb3, 0x3d, 0x7c, 0xb6, 0xf0, 0xbb, 0xa7, 0x85, 0x40, 0xbd,
+    0x74, 0x3d, 0x6a, 0x3d, 0xc2, 0xcf, 0x40, 0xbe, 0x1b, 0xdf, 0x91, 0x3e,
+    0xb2, 0xb5, 0xdb, 0xbd, 0xac, 0x06, 0xb6, 0xbe, 0xeb, 0x4a, 0xd0, 0xbd,
+    0xdf, 0x27, 0x7e, 0x3d, 0xcc, 0xa8, 0x9a, 0x3d, 0xdb, 0xa5, 0x33, 0xbe,
+    0x5c, 0x3f, 0xc4, 0xbe, 0x05, 0x70, 0xcf, 0xbd, 0x24, 0xbf, 0x27, 0x3e,
+    0x4c, 0x6f, 0x16, 0xbe, 0x18, 0xd2, 0xba, 0xbd, 0xad, 0x14, 0x40, 0x3e,
+    0x94, 0x3e, 0xf2, 0x3c, 0x1b, 0x02, 0x53, 0x3e, 0x5f, 0xdf, 0x4d, 0xbd,
+    0x8b, 0x47, 0x48, 0x3d, 0xd0, 0xe2, 0x2f, 0x3e, 0xbe, 0x64, 0x49, 0xbe,
+    0xd7, 0xf7, 0x6e, 0x3e, 0x7a, 0xad, 0x8b, 0x3e, 0xae, 0x12, 0x07, 0x3d,
+    0x05, 0x9c, 0xb2, 0xbd, 0x1c, 0xe1, 0xa6, 0xbd, 0x7e, 0xed, 0x5e, 0xbe,
+    0x57, 0x70, 0x65, 0x3d, 0xf4, 0xa1, 0x01, 0xbf, 0xda, 0xb0, 0x1a, 0xbd,
+    0x25, 0x35, 0x2f, 0x3e, 0x9a, 0xa8, 0x87, 0xbe, 0x27, 0xe8, 0x05, 0x3f,
+    0x07, 0x08, 0xe1, 0xbb, 0xb0, 0x3d, 0x83, 0xbd, 0xeb, 0x76, 0x9e, 0xbd,
+    0x30, 0x02, 0xa9, 0x3d, 0x3b, 0x3c, 0x86, 0x3d, 0x53, 0x90, 0x42, 0x3e,
+    0x74, 0x2f, 0x8d, 0x3c, 0xd0, 0xea, 0x6c, 0xbd, 0x86, 0xf8, 0x21, 0x3e,
+    0xc0, 0x23, 0x87, 0xbe, 0x4c, 0x6d, 0x84, 0x3e, 0x0e, 0x76, 0x42, 0xbe,
+    0x13, 0xce, 0xc6, 0xbd, 0x47, 0x83, 0xc4, 0xbd, 0x6b, 0x49, 0x8f, 0xbe,
+    0x2b, 0x68, 0xb1, 0x3d, 0xf6, 0x61, 0x1b, 0x3e, 0xab, 0x71, 0x72, 0x3e,
+    0xa7, 0x28, 0x9d, 0xbe, 0xd4, 0x2b, 0x28, 0xbe, 0x45, 0xd0, 0xdb, 0xbe,
+    0x25, 0xab, 0x00, 0xbd, 0x11, 0x49, 0xb2, 0xbe, 0x18, 0x82, 0xfe, 0xbc,
+    0xd7, 0x5f, 0x84, 0x3b, 0xbe, 0x1f, 0x99, 0x3d, 0xf2, 0xf9, 0xb4, 0xbe,
+    0xc2, 0xfc, 0x88, 0x3d, 0x5d, 0x2e, 0x22, 0xbe, 0xa1, 0xe7, 0x1c, 0x3e,
+    0xe4, 0xaf, 0x59, 0xbd, 0x21, 0x96, 0xb8, 0xbd, 0x12, 0x38, 0xf6, 0x3d,
+    0xf6, 0xa8, 0x90, 0xbe, 0xaa, 0xbc, 0x90, 0xbe, 0xff, 0x6b, 0xb0, 0xbd,
+    0x2e, 0xde, 0xc6, 0x3e, 0x94, 0x05, 0x39, 0x3d, 0x2c, 0xec, 0x23, 0x3e,
+    0xbb, 0x6a, 0xac, 0x3d, 0x44, 0x4a, 0xde, 0x3d, 0xdc, 0x5a, 0xf0, 0xbd,
+    0x84, 0x3c, 0x4a, 0x3e, 0xd2, 0xa0, 0xb1, 0xbd, 0xcc, 0x85, 0xe1, 0x3e,
+    0xe1, 0x7a, 0x6d, 0xbd, 0x69, 0x0b, 0x4d, 0x3e, 0x36, 0x0e, 0x38, 0x3e,
+    0x2d, 0x8d, 0xf5, 0xbd, 0x76, 0x6b, 0xad, 0xbd, 0xa6, 0x89, 0x46, 0xbd,
+    0x16, 0x6b, 0xb0, 0x3d, 0x8d, 0x30, 0x3a, 0x3c, 0x36, 0xfb, 0xae, 0xbd,
+    0x47, 0x49, 0xba, 0xbd, 0xf7, 0x45, 0xaa, 0xbd, 0xe7, 0x15, 0x1a, 0xbd,
+    0xe8, 0x50, 0x7c, 0x3d, 0xb6, 0x19, 0x08, 0xbe, 0xb0, 0x67, 0xd0, 0x3d,
+    0x58, 0x78, 0xa2, 0x3d, 0x45, 0xcc, 0x2f, 0xbe, 0x5b, 0x82, 0x70, 0x3e,
+    0xe1, 0x97, 0x3c, 0xbe, 0xa1, 0xcc, 0x06, 0xbe, 0xc1, 0x70, 0x44, 0xbe,
+    0x7e, 0xc8, 0x86, 0x3e, 0x14, 0x3b, 0x88, 0xbe, 0xb6, 0x18, 0x1c, 0x3e,
+    0x65, 0x77, 0x27, 0x3e, 0x9e, 0x86, 0xcf, 0x3e, 0x62, 0x25, 0x49, 0x3e,
+    0x9d, 0x30, 0x55, 0xbe, 0x28, 0x36, 0xba, 0xbe, 0x13, 0x95, 0x31, 0x3d,
+    0x21, 0x14, 0xa2, 0xbe, 0x12, 0x6b, 0xc7, 0x3e, 0xb8, 0x5b, 0xd4, 0x3d,
+    0x6b, 0xd8, 0xe1, 0xbe, 0xda, 0x02, 0x8f, 0x3e, 0x84, 0x7f, 0x37, 0x3e,
+    0x9d, 0x33, 0xf2, 0x3d, 0x4e, 0xc8, 0x31, 0xbe, 0xe6, 0x2b, 0xf1, 0x3d,
+    0x75, 0xc3, 0x2c, 0x3f, 0xb6, 0x8f, 0xc0, 0x3d, 0x41, 0xa7, 0x9c, 0x3e,
+    0x00, 0x33, 0x3c, 0x3e, 0xcc, 0x3b, 0x0a, 0xbd, 0xd9, 0x55, 0x75, 0xbe,
+    0x7f, 0x62, 0xc5, 0x3d, 0x2c, 0x86, 0x26, 0xbe, 0x3a, 0xa6, 0xb4, 0x3e,
+    0xd2, 0xea, 0x99, 0xbe, 0x20, 0x4c, 0x94, 0xbd, 0x21, 0x1c, 0x4a, 0x3d,
+    0x07, 0xb9, 0x09, 0x3f, 0x5f, 0x4c, 0xb2, 0xbd, 0xb6, 0xf8, 0x7a, 0x3e,
+    0x02, 0x19, 0x54, 0xbd, 0xb8, 0x33, 0x73, 0x3e, 0x2a, 0xe9, 0x8d, 0x3e,
+    0x8a, 0xdd, 0x09, 0x3e, 0x8f, 0xf3, 0xe7, 0x3d, 0xfe, 0x43, 0x67, 0xbe,
+    0xe8, 0x6c, 0x5c, 0xbe, 0xcc, 0x14, 0x89, 0x3d, 0x03, 0x40, 0xb2, 0xbe,
+    0x65, 0x3f, 0x26, 0xbc, 0x5d, 0x12, 0xb6, 0x3d, 0xeb, 0xe9, 0xa2, 0xbe,
+    0xe0, 0xf8, 0x6c, 0x3c, 0x6b, 0x3b, 0x82, 0x3e, 0xae, 0x37, 0x30, 0xbd,
+    0x7f, 0xbe, 0xd6, 0xbe, 0xb3, 0x61, 0x54, 0xbe, 0x69, 0x50, 0x15, 0x3e,
+    0x94, 0x94, 0x2c, 0xbe, 0xb6, 0x60, 0x88, 0x3e, 0xed, 0x13, 0x71, 0x3d,
+    0xfb, 0xb4, 0x6a, 0xbe, 0x47, 0x20, 0xf7, 0xbc, 0x55, 0x79, 0x83, 0xbe,
+    0x59, 0x09, 0x2e, 0xbe, 0xcb, 0x59, 0x49, 0xbb, 0xff, 0x8e, 0x9a, 0x3e,
+    0x22, 0x8c, 0x93, 0xbe, 0x36, 0x71, 0x25, 0x3e, 0x4c, 0x40, 0x44, 0x3d,
+    0x9b, 0xad, 0xe4, 0x3d, 0x2b, 0xd7, 0xda, 0x3e, 0x3a, 0x56, 0x72, 0x3e,
+    0x23, 0x39, 0xa7, 0xbe, 0x6d, 0x49, 0x5d, 0x3e, 0xab, 0xaf, 0x9a, 0xbd,
+    0x43, 0xa7, 0x0b, 0xbe, 0x2e, 0x4c, 0xb9, 0xbe, 0x83, 0x7f, 0xea, 0x3a,
+    0x33, 0x79, 0xa9, 0x3e, 0x9f, 0xd1, 0xa6, 0x3d, 0xb4, 0x64, 0x97, 0xbe,
+    0x7a, 0x6d, 0xee, 0x3e, 0x32, 0xa5, 0x08, 0xbe, 0x0c, 0xf7, 0x2a, 0x3d,
+    0xa6, 0xff, 0x47, 0x3e, 0x8e, 0xcc, 0xcf, 0x3e, 0x0d, 0x17, 0x4f, 0xbd,
+    0xf1, 0x1d, 0x16, 0x3e, 0xc4, 0xd9, 0x3e, 0xbd, 0x16, 0x8a, 0x07, 0x3e,
+    0x7d, 0xe5, 0xcb, 0x3c, 0x42, 0xbb, 0xd4, 0xbc, 0x37, 0xe0, 0x8c, 0xbe,
+    0xe3, 0xce, 0x86, 0x3d, 0x61, 0xd7, 0x2c, 0xbe, 0xa7, 0xd9, 0x3d, 0xbd,
+    0xf5, 0xab, 0x2d, 0xbe, 0x6c, 0x36, 0x8d, 0x3d, 0x7e, 0x06, 0x36, 0xbe,
+    0x9e, 0x22, 0x9b, 0x3e, 0xd5, 0x16, 0xb6, 0x3e, 0x6b, 0x2a, 0x94, 0xbd,
+    0x8b, 0xab, 0x7f, 0xbe, 0x93, 0xf4, 0x26, 0xbe, 0x8f, 0x70, 0x28, 0x3e,
+    0x3f, 0xf8, 0xa7, 0x3e, 0x0b, 0x00, 0xbd, 0x3e, 0x27, 0x2f, 0x82, 0x3e,
+    0xc5, 0x00, 0x62, 0xbe, 0x85, 0xd3, 0x94, 0xbe, 0x24, 0x67, 0x15, 0x3d,
+    0x78, 0xa8, 0x2b, 0xbe, 0x0a, 0x60, 0xa8, 0xbd, 0x36, 0x34, 0x92, 0x3e,
+    0x63, 0x11, 0xa3, 0xbe, 0xc5, 0x85, 0x35, 0x3d, 0x64, 0x69, 0x46, 0x3e,
+    0x9e, 0x5c, 0x05, 0xbe, 0x4f, 0x9c, 0x86, 0xbd, 0xbd, 0x1b, 0xc4, 0x3c,
+    0x82, 0x74, 0x3c, 0xbd, 0x1b, 0x60, 0xae, 0x3e, 0x30, 0x16, 0x61, 0xbe,
+    0x08, 0x4e, 0x23, 0x3e, 0x6d, 0x23, 0x4c, 0xbd, 0xbc, 0xb4, 0xcc, 0xbe,
+    0x5c, 0x46, 0x9c, 0x3d, 0x7e, 0xd0, 0x91, 0xbd, 0xdb, 0xdf, 0x4e, 0x3e,
+    0xd9, 0x20, 0x5b, 0xbc, 0x47, 0xfb, 0xca, 0x3d, 0x2d, 0x0a, 0x54, 0x3e,
+    0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0xc7, 0x50, 0x3d,
+    0x57, 0x33, 0x95, 0xbd, 0x75, 0xd2, 0x34, 0xbf, 0x44, 0x19, 0x3b, 0xbd,
+    0x07, 0x7b, 0x45, 0x3e, 0x2f, 0x1d, 0x9d, 0xbe, 0x65, 0xdd, 0xac, 0x3d,
+    0x47, 0xcb, 0x82, 0x3e, 0x1d, 0x27, 0x39, 0x3d, 0x0a, 0x96, 0xd3, 0xbe,
+    0xb9, 0xae, 0xd1, 0xbe, 0x8c, 0x25, 0xa5, 0x3c, 0x00, 0x25, 0xa2, 0x3e,
+    0xfb, 0xfa, 0xcb, 0xbe, 0x18, 0x2c, 0x4c, 0x3e, 0xe2, 0x21, 0x60, 0xbd,
+    0x54, 0x17, 0x81, 0x3e, 0x78, 0x7a, 0xc0, 0xbd, 0x9b, 0xc4, 0xca, 0xbe,
+    0x2f, 0x2c, 0x48, 0xbe, 0x99, 0x96, 0x91, 0x3e, 0x66, 0xed, 0x37, 0xbe,
+    0x6f, 0xcc, 0x6a, 0x3e, 0xc8, 0x59, 0x93, 0x3e, 0x04, 0x60, 0xbf, 0xbe,
+    0xe9, 0x33, 0x9d, 0xbd, 0xe3, 0xf0, 0x88, 0xbc, 0x91, 0xb0, 0xcd, 0xbe,
+    0xe3, 0x69, 0x08, 0xbd, 0xce, 0x8f, 0x59, 0xbd, 0x90, 0xc7, 0x64, 0xbe,
+    0xa7, 0x8d, 0x56, 0x3e, 0x99, 0xbb, 0x9c, 0xbe, 0x08, 0x70, 0x28, 0x3e,
+    0xbf, 0x18, 0xd5, 0x3e, 0x3e, 0x0b, 0xb7, 0x3e, 0x69, 0xd2, 0x2f, 0xbe,
+    0x67, 0xbe, 0x15, 0xbe, 0x9a, 0x28, 0x4b, 0xbe, 0x21, 0x49, 0x47, 0x3d,
+    0x22, 0x2b, 0x81, 0x3e, 0x8c, 0xff, 0x2c, 0x3e, 0x1b, 0xcb, 0x94, 0xbe,
+    0x83, 0x44, 0x87, 0x3e, 0x08, 0x17, 0xee, 0xbd, 0xb2, 0x7b, 0x59, 0x3e,
+    0xe3, 0xad, 0xd2, 0x3d, 0xd7, 0xa6, 0x21, 0xbe, 0xae, 0x60, 0x3a, 0x3e,
+    0x8a, 0x24, 0xcb, 0x3e, 0x29, 0x2a, 0xee, 0xbe, 0x7c, 0x06, 0x54, 0x3e,
+    0x2a, 0x0d, 0x90, 0xbe, 0x6e, 0x56, 0xb2, 0xbe, 0x9a, 0x7d, 0x0a, 0xbf,
+    0xa2, 0x5f, 0x2e, 0xbe, 0xcd, 0xe3, 0xd3, 0x3e, 0xb7, 0x91, 0x25, 0x3f,
+    0x98, 0x40, 0x05, 0xbe, 0xc8, 0x0c, 0x73, 0x3e, 0x7e, 0xa3, 0x10, 0xbf,
+    0x31, 0xe5, 0x23, 0xbe, 0x05, 0xef, 0x03, 0x3f, 0x66, 0x90, 0x45, 0x3d,
+    0xc8, 0x65, 0x06, 0xbe, 0x7d, 0xef, 0xe8, 0xbc, 0x69, 0x10, 0x67, 0xbe,
+    0xf0, 0x94, 0x85, 0x3c, 0xd4, 0x5b, 0x20, 0x3e, 0x59, 0x0e, 0x30, 0xbc,
+    0x6a, 0x32, 0x8e, 0x3a, 0xa1, 0x71, 0x94, 0xbe, 0x2b, 0xfa, 0x2e, 0x3e,
+    0x86, 0x5e, 0x2c, 0x3d, 0xc4, 0xc1, 0xe4, 0x3d, 0x90, 0x23, 0xb1, 0x3d,
+    0xf7, 0x04, 0x54, 0x3e, 0xf4, 0x44, 0x02, 0xbf, 0xe3, 0x25, 0x71, 0x3d,
+    0x5f, 0x1a, 0x8e, 0xbe, 0xf3, 0xbc, 0x94, 0x3d, 0xbc, 0x6c, 0x7a, 0xbe,
+    0x53, 0x98, 0x1c, 0xbe, 0xf2, 0xa3, 0xec, 0x3d, 0x67, 0x2f, 0xd3, 0xbe,
+    0xc5, 0xaf, 0x29, 0xbe, 0x27, 0x1c, 0x24, 0xbd, 0x23, 0x92, 0xaa, 0xbc,
+    0xdd, 0x8d, 0xc5, 0xbc, 0x2a, 0xa0, 0xdb, 0x3e, 0x33, 0xbf, 0xac, 0xbd,
+    0x28, 0x0b, 0x84, 0x3e, 0x7a, 0x39, 0xc4, 0xbc, 0x0c, 0xf5, 0x89, 0xbd,
+    0x36, 0x1d, 0x0c, 0x3d, 0x07, 0x95, 0xcc, 0xbc, 0x0c, 0x05, 0xa1, 0xbd,
+    0xde, 0x86, 0x68, 0x3d, 0xde, 0x7e, 0x80, 0xbe, 0x81, 0x14, 0x10, 0x3e,
+    0xc7, 0x5d, 0xb0, 0x3e, 0x83, 0xa6, 0xba, 0xbd, 0x10, 0x41, 0x2f, 0xbd,
+    0x1c, 0x8d, 0xdf, 0x3d, 0xc8, 0xaf, 0x14, 0x3e, 0x72, 0x7a, 0x88, 0xbe,
+    0x40, 0x2f, 0x36, 0x3b, 0x79, 0xa9, 0x76, 0x3e, 0x79, 0x17, 0xbc, 0x3e,
+    0x5e, 0x20, 0xbe, 0xbd, 0x75, 0x84, 0xb6, 0x3d, 0xb4, 0x7b, 0x40, 0x3d,
+    0x57, 0x04, 0x73, 0xbe, 0xf0, 0xb8, 0xab, 0xbe, 0xe8, 0xa7, 0xd6, 0xbc,
+    0x33, 0x9e, 0xe6, 0x3d, 0xe3, 0xac, 0x03, 0x3f, 0xc6, 0xf8, 0x21, 0xbe,
+    0xce, 0x88, 0x81, 0xbc, 0xa8, 0x04, 0x01, 0x3e, 0xae, 0x6e, 0x1c, 0x3e,
+    0x3b, 0xb1, 0x60, 0xbe, 0x42, 0xae, 0x0c, 0x3e, 0x44, 0x69, 0x6f, 0x3e,
+    0x41, 0x46, 0x0a, 0x3f, 0x86, 0x12, 0x8e, 0xbe, 0xe1, 0x45, 0xd3, 0x3e,
+    0xfe, 0xbb, 0x24, 0xbe, 0x06, 0xa7, 0x85, 0xbd, 0x66, 0xef, 0xa6, 0xbe,
+    0x54, 0x0c, 0x0a, 0x3f, 0x36, 0x38, 0x02, 0xbe, 0xf4, 0xea, 0x26, 0xbd,
+    0x71, 0x77, 0x7a, 0x3e, 0x32, 0x7c, 0x3e, 0xbe, 0xff, 0x82, 0xa1, 0xbe,
+    0x97, 0xd4, 0x41, 0x3e, 0xb6, 0x9d, 0x11, 0x3c, 0x85, 0x02, 0xcd, 0x3e,
+    0xf3, 0x96, 0xa3, 0xbd, 0xa8, 0x6c, 0x95, 0x3e, 0x57, 0xa9, 0xa3, 0x3e,
+    0x63, 0xc7, 0xe6, 0x3e, 0x3a, 0xec, 0x0e, 0x3e, 0x92, 0x05, 0xf7, 0x3d,
+    0xfd, 0x18, 0xb2, 0x3c, 0x4d, 0x3e, 0x3b, 0x3e, 0x77, 0x2c, 0x5c, 0xbe,
+    0x49, 0xae, 0xec, 0xbe, 0x5f, 0x87, 0xd7, 0x3d, 0xc7, 0xf3, 0xf6, 0xbc,
+    0x63, 0x33, 0xa3, 0xbd, 0xee, 0x39, 0x9a, 0xbd, 0x4d, 0x0c, 0x51, 0xbd,
+    0x69, 0x91, 0x88, 0xbe, 0x03, 0xc3, 0x0f, 0xbe, 0x4b, 0xf8, 0xcf, 0xbe,
+    0x78, 0xf3, 0x95, 0x3e, 0x0e, 0x1c, 0xc1, 0xbd, 0xd4, 0xd1, 0x89, 0xbd,
+    0x3e, 0xad, 0xe0, 0x3d, 0xc4, 0xa4, 0xcc, 0x3e, 0xe0, 0x40, 0x7f, 0xbd,
+    0xd6, 0x33, 0xcd, 0xbe, 0x66, 0xb4, 0x80, 0xbd, 0x8e, 0x6a, 0x9f, 0x3e,
+    0x02, 0xc0, 0x84, 0xbd, 0x8a, 0xef, 0xa5, 0x3d, 0x71, 0xdb, 0xba, 0xbd,
+    0x8b, 0x4c, 0x35, 0x3e, 0x8b, 0x79, 0x96, 0x3e, 0x47, 0xc7, 0x30, 0xbe,
+    0x84, 0xe1, 0x72, 0xbc, 0x77, 0xad, 0xa3, 0x3c, 0x13, 0x39, 0x80, 0x3d,
+    0xf3, 0x0a, 0xd7, 0x3d, 0x18, 0xde, 0x6b, 0xbe, 0x58, 0x46, 0x21, 0x3e,
+    0x9f, 0xb3, 0x38, 0xbd, 0x55, 0x96, 0x97, 0x3d, 0xfd, 0xb8, 0x2b, 0xbe,
+    0xdb, 0xda, 0x87, 0x3d, 0xde, 0x5b, 0x9e, 0xbe, 0xfe, 0xb3, 0x14, 0xbd,
+    0x7c, 0x49, 0x77, 0x3d, 0x2d, 0x37, 0x06, 0x3e, 0xb5, 0x0c, 0x26, 0x3d,
+    0x9f, 0x45, 0xad, 0x3e, 0xc0, 0x8a, 0x76, 0xba, 0xe9, 0x84, 0x54, 0xbe,
+    0x50, 0x14, 0x8c, 0x3e, 0x85, 0xad, 0xdd, 0xbe, 0x12, 0xb3, 0xe9, 0xbd,
+    0xbe, 0x07, 0xab, 0x3d, 0xe4, 0xb4, 0x91, 0xbe, 0x90, 0x2c, 0x3b, 0x3e,
+    0x42, 0xbf, 0xf7, 0x3d, 0xcb, 0x4c, 0x64, 0xbe, 0x75, 0xcd, 0x26, 0x3e,
+    0xed, 0xb2, 0x40, 0xbe, 0x7d, 0x4a, 0xa3, 0x3e, 0x37, 0x7d, 0x64, 0xbe,
+    0x90, 0x29, 0xc3, 0x3e, 0x2e, 0x9e, 0x28, 0x3e, 0xdc, 0x49, 0xee, 0x3d,
+    0x10, 0xae, 0xdc, 0xbe, 0xd1, 0xc2, 0xab, 0x3e, 0x94, 0x2e, 0x4d, 0xbd,
+    0x7f, 0x14, 0xcb, 0xba, 0xd1, 0x9e, 0x15, 0x3f, 0x98, 0x6c, 0x86, 0xbe,
+    0x3f, 0x85, 0x2c, 0x3e, 0x49, 0x46, 0x2e, 0xbe, 0xd3, 0x5a, 0xe2, 0xbd,
+    0x44, 0x21, 0xb6, 0xbd, 0xdf, 0xbe, 0x4a, 0xbe, 0x68, 0xf4, 0xc1, 0x3d,
+    0x7a, 0x33, 0xcf, 0x3e, 0xac, 0x2f, 0x73, 0x3e, 0x34, 0x6a, 0x45, 0x3e,
+    0x9e, 0x8b, 0xe7, 0x3d, 0x38, 0xab, 0x6b, 0xbd, 0x25, 0x0f, 0x30, 0x3e,
+    0x96, 0x5c, 0x95, 0xbd, 0xac, 0xfc, 0x8e, 0xbe, 0xda, 0x6d, 0xc7, 0xbd,
+    0x9c, 0xf1, 0xa3, 0x3e, 0xbf, 0x9b, 0x08, 0xbb, 0xf3, 0x97, 0xbb, 0xbe,
+    0xba, 0xf4, 0xa2, 0x3e, 0x00, 0xa9, 0x59, 0x3d, 0x80, 0x2e, 0x78, 0xbe,
+    0x72, 0xba, 0x42, 0x3e, 0xc7, 0xe0, 0x2b, 0xbd, 0x6e, 0xc0, 0x7c, 0x3e,
+    0xc7, 0x3d, 0xa5, 0x3d, 0x98, 0x3b, 0xb2, 0x3d, 0x61, 0xd3, 0x7a, 0xbc,
+    0x1f, 0x52, 0xa0, 0x3e, 0x95, 0x7e, 0xc5, 0x3d, 0xe4, 0xcd, 0x14, 0x3d,
+    0x7b, 0xfb, 0x61, 0x3d, 0x34, 0x00, 0xe0, 0x3b, 0x28, 0x6c, 0x30, 0xbe,
+    0x64, 0x8a, 0x1c, 0x3d, 0x19, 0x86, 0xd8, 0xba, 0x23, 0xb0, 0xcf, 0x3d,
+    0x30, 0x08, 0xd2, 0x3d, 0xf4, 0x95, 0xf4, 0xbd, 0x65, 0xf7, 0x19, 0xbe,
+    0x05, 0x58, 0xb6, 0xbc, 0x5c, 0xe8, 0x79, 0xbe, 0xf5, 0x31, 0x27, 0x3e,
+    0x2a, 0xd3, 0x28, 0x3e, 0xa2, 0xcd, 0x61, 0xbe, 0x59, 0x27, 0x9f, 0x3d,
+    0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1b, 0x90, 0xf8, 0x3d,
+    0x86, 0xc1, 0x39, 0xbe, 0x8f, 0x2d, 0x5f, 0xbe, 0x80, 0x29, 0x7c, 0xbe,
+    0x2d, 0x9f, 0x86, 0x3e, 0xb3, 0x90, 0xa2, 0x3e, 0x2b, 0x4d, 0x98, 0x3e,
+    0x60, 0xed, 0x5f, 0x3c, 0x92, 0x09, 0x82, 0xbe, 0x94, 0xb4, 0x46, 0xbe,
+    0x0b, 0x67, 0x54, 0x3e, 0x8b, 0xf9, 0x7b, 0xbe, 0xb6, 0xec, 0x05, 0x3d,
+    0xe5, 0x1d, 0x3d, 0x3e, 0x6f, 0x51, 0x90, 0xbe, 0x7e, 0x20, 0xb9, 0x3e,
+    0xaf, 0x8e, 0x07, 0x3e, 0x51, 0xbc, 0x7b, 0xbe, 0xfa, 0xe6, 0x4a, 0x3d,
+    0xa3, 0xe2, 0xd5, 0x3d, 0xa4, 0xfa, 0x08, 0x3f, 0x75, 0x9e, 0xb8, 0xbe,
+    0xbe, 0x6b, 0x54, 0x3e, 0x8f, 0x0b, 0x4f, 0x3e, 0x59, 0x6a, 0xaf, 0x3e,
+    0x79, 0x8b, 0x93, 0xbe, 0xfa, 0x49, 0x82, 0x3d, 0x86, 0x9e, 0x81, 0x3e,
+    0x5c, 0x22, 0x07, 0x3f, 0x95, 0x9f, 0xe4, 0xbe, 0x84, 0xf0, 0x48, 0xbd,
+    0x66, 0x82, 0x5b, 0x3e, 0x16, 0x95, 0xfc, 0x3e, 0xc3, 0x4e, 0xa2, 0xbd,
+    0x7a, 0xef, 0x28, 0xbc, 0xad, 0x15, 0x23, 0xbf, 0xe5, 0xf5, 0x39, 0x3e,
+    0xbb, 0x2c, 0xbc, 0x3e, 0x31, 0x58, 0xcf, 0x3e, 0xa1, 0x1f, 0x8a, 0x3e,
+    0x9d, 0x02, 0xbb, 0xbd, 0x37, 0x25, 0x76, 0xbe, 0xb5, 0x9a, 0xa0, 0x3e,
+    0x9a, 0x05, 0x2a, 0xbf, 0x72, 0xdc, 0xad, 0x3d, 0xfd, 0xab, 0x12, 0x3f,
+    0xcf, 0x27, 0xdf, 0xbe, 0x18, 0xbf, 0x11, 0x3f, 0x0f, 0xb3, 0x80, 0x3e,
+    0xed, 0x07, 0x15, 0x3e, 0x3a, 0xef, 0xc9, 0xbd, 0xb6, 0x9a, 0xd9, 0xbd,
+    0x24, 0x41, 0x6f, 0xbe, 0xcf, 0x13, 0xbd, 0x3e, 0x07, 0x30, 0xfa, 0x3d,
+    0x4f, 0xe1, 0xe1, 0x3e, 0xca, 0x3d, 0x79, 0xbe, 0x53, 0xd2, 0x4b, 0xbd,
+    0x1b, 0x17, 0x4a, 0xbe, 0x9a, 0x73, 0xac, 0xbe, 0x59, 0x7a, 0x46, 0xbe,
+    0x3e, 0x3c, 0x97, 0x3e, 0xc7, 0x47, 0x37, 0xbe, 0x54, 0x25, 0x85, 0x3d,
+    0x42, 0x73, 0x41, 0x3e, 0xe5, 0xa2, 0x95, 0xbd, 0x0c, 0x58, 0xbd, 0x3c,
+    0x5b, 0xee, 0x40, 0xbe, 0xa5, 0x2f, 0xa5, 0x3c, 0x0b, 0x41, 0x63, 0x3e,
+    0x52, 0x9a, 0xe6, 0x3e, 0x60, 0xe3, 0x85, 0x3d, 0x6e, 0x09, 0x8b, 0xbe,
+    0xab, 0xb8, 0xcc, 0xbe, 0x18, 0x14, 0xb9, 0x3e, 0x92, 0xe3, 0x07, 0xbf,
+    0x56, 0xd9, 0x15, 0x3d, 0xfe, 0xde, 0x82, 0x3e, 0x15, 0x10, 0x02, 0xbf,
+    0x12, 0x82, 0xbb, 0x3e, 0x3b, 0xff, 0x93, 0x3e, 0x9d, 0x0b, 0x47, 0xbd,
+    0x3c, 0x3f, 0x52, 0xbe, 0x11, 0x12, 0x36, 0xbe, 0xd7, 0x76, 0xa4, 0xbe,
+    0x32, 0x1b, 0xba, 0x3e, 0x0c, 0x70, 0x6d, 0xbe, 0xf0, 0x5c, 0x35, 0x3d,
+    0x20, 0x57, 0x12, 0xbf, 0xa8, 0xf7, 0xac, 0x3e, 0x6d, 0x00, 0xc9, 0x3d,
+    0xaf, 0xbc, 0xe8, 0xbe, 0x5d, 0xdc, 0xae, 0xbe, 0xe1, 0xf3, 0xaa, 0x3e,
+    0xa4, 0x1c, 0xe4, 0xbe, 0x54, 0x56, 0xb0, 0x3e, 0xcc, 0xb0, 0x05, 0x3e,
+    0x34, 0x24, 0xde, 0xbd, 0x9f, 0x7f, 0xa9, 0xbe, 0xa0, 0x94, 0xe5, 0xbd,
+    0x53, 0x45, 0xc3, 0x3e, 0x05, 0xc0, 0x08, 0x3d, 0xa5, 0x39, 0x27, 0x3e,
+    0x1c, 0x8b, 0x98, 0xbe, 0x55, 0xbb, 0x9a, 0xbd, 0x38, 0x58, 0xce, 0xbe,
+    0xc3, 0xaf, 0x19, 0x3f, 0xfe, 0x55, 0xf4, 0x3c, 0xa4, 0x38, 0x63, 0x3d,
+    0xcb, 0x85, 0xa5, 0xbd, 0x9e, 0x2a, 0x0b, 0xbe, 0x19, 0x09, 0x03, 0x3e,
+    0xa4, 0xb5, 0xfe, 0x3d, 0x5b, 0x1c, 0xb8, 0xbe, 0x3a, 0x4f, 0x9c, 0x3e,
+    0xa6, 0xc1, 0xb0, 0xbd, 0x9f, 0x73, 0xad, 0x3e, 0xb6, 0x3e, 0xbb, 0x3e,
+    0xf2, 0xcc, 0x58, 0x3e, 0x17, 0x3b, 0x39, 0x3e, 0x29, 0x68, 0x3f, 0xbe,
+    0x72, 0x1e, 0x57, 0xbe, 0x2b, 0x90, 0x9c, 0x3e, 0xd6, 0x94, 0x84, 0xbe,
+    0xd9, 0x83, 0xd3, 0x3e, 0x10, 0xa5, 0xd0, 0x3e, 0x28, 0xb6, 0x93, 0xbe,
+    0xa7, 0xf0, 0xa5, 0x3e, 0x1f, 0x29, 0x9d, 0x3e, 0xf3, 0x71, 0x92, 0x3d,
+    0x70, 0x12, 0x23, 0xbd, 0x3f, 0x91, 0x2d, 0xbe, 0x35, 0x04, 0x99, 0xbc,
+    0x3d, 0x72, 0x01, 0x3e, 0x1d, 0x06, 0x8a, 0x3e, 0x6d, 0xd9, 0x73, 0x3e,
+    0xa5, 0x5d, 0xe4, 0xbe, 0xb7, 0x7a, 0x1e, 0xbe, 0xcb, 0x83, 0xbb, 0xbd,
+    0xb2, 0x77, 0xad, 0xbe, 0x61, 0x8f, 0xa0, 0xbd, 0xac, 0x79, 0xfb, 0x3e,
+    0x45, 0xe1, 0x06, 0xbf, 0xb2, 0x4a, 0x62, 0x3e, 0x25, 0xae, 0x55, 0x3e,
+    0xf6, 0x71, 0x3f, 0xbe, 0xc5, 0x73, 0x48, 0xbe, 0xf6, 0x36, 0xfe, 0xbe,
+    0x5b, 0xbd, 0xaa, 0x3e, 0xa9, 0x19, 0x1f, 0x3f, 0xb9, 0x2f, 0x97, 0x3e,
+    0xb2, 0x0e, 0xf4, 0x3c, 0xc2, 0x34, 0xd7, 0xbe, 0xb7, 0x27, 0xcf, 0xbe,
+    0xbb, 0xdf, 0xee, 0x3e, 0x10, 0xc3, 0xcf, 0xbe, 0xd2, 0x40, 0x2e, 0xbe,
+    0x85, 0x0f, 0xcd, 0x3e, 0x99, 0x7f, 0x41, 0xbe, 0x44, 0x7c, 0xe7, 0x3d,
+    0x16, 0x09, 0xb0, 0x3e, 0x91, 0x13, 0xbe, 0xbe, 0x25, 0x7f, 0x3f, 0x3e,
+    0xf1, 0x1a, 0x82, 0xbe, 0xa9, 0x8d, 0x11, 0x3f, 0x19, 0xf7, 0x0f, 0x3d,
+    0xaa, 0x3f, 0xbd, 0x3e, 0xc7, 0xe4, 0x83, 0x3e, 0x5f, 0xea, 0xc0, 0xbd,
+    0xa9, 0x73, 0x96, 0xbe, 0x49, 0xe2, 0x46, 0x3e, 0x30, 0x47, 0x12, 0xbe,
+    0x88, 0x58, 0x01, 0x3f, 0x83, 0xd0, 0x43, 0x3e, 0xae, 0x33, 0xa8, 0xbe,
+    0x69, 0xea, 0x45, 0x3e, 0x92, 0x7c, 0xe0, 0x3e, 0x25, 0xbc, 0x2f, 0x3e,
+    0x23, 0x46, 0x97, 0xbe, 0x8f, 0x6f, 0x9c, 0xbe, 0xe6, 0x28, 0x18, 0xbd,
+    0x5a, 0xeb, 0x3a, 0x3e, 0x8f, 0x00, 0x09, 0x3e, 0xfc, 0xac, 0x99, 0x3e,
+    0x38, 0x3a, 0xc5, 0xbe, 0xf9, 0xc5, 0x82, 0xbc, 0x27, 0x1a, 0x63, 0xbe,
+    0xe7, 0xe0, 0xee, 0xbe, 0x88, 0xcb, 0x11, 0xbe, 0xe8, 0xe9, 0xa6, 0x3e,
+    0x90, 0x4e, 0xef, 0xbe, 0xaf, 0x15, 0x17, 0x3e, 0x04, 0x44, 0x2f, 0xbe,
+    0xa7, 0xac, 0x09, 0x3e, 0xbe, 0x35, 0xba, 0xbd, 0xb1, 0x23, 0x7e, 0xbe,
+    0xda, 0x8b, 0xc9, 0xbe, 0x0c, 0x85, 0x32, 0x3d, 0xd7, 0x9d, 0x60, 0xbe,
+    0xe0, 0xeb, 0xc0, 0xbe, 0x0c, 0xbe, 0x0d, 0x3d, 0x52, 0x96, 0x1d, 0x3e,
+    0x1c, 0x73, 0x9e, 0x3e, 0xdd, 0xb0, 0x84, 0x3d, 0xdb, 0x38, 0xf4, 0xbe,
+    0xec, 0x21, 0xb8, 0x3e, 0x21, 0x63, 0x87, 0xbd, 0x34, 0x69, 0xea, 0x3d,
+    0x95, 0x03, 0x77, 0x3e, 0x9c, 0xd7, 0xb2, 0xbd, 0xa3, 0xe0, 0x37, 0xbd,
+    0xa4, 0xc9, 0x4e, 0xbe, 0x9c, 0x7d, 0xa5, 0x3d, 0x7d, 0x7a, 0xee, 0x3e,
+    0xfe, 0xd9, 0x6a, 0x3e, 0xb6, 0x54, 0x0a, 0x3e, 0x2b, 0x76, 0x97, 0xbe,
+    0x20, 0xe8, 0x1b, 0xbe, 0xf3, 0x6a, 0x4c, 0xbe, 0xf5, 0xb0, 0x4a, 0xbe,
+    0x4b, 0xde, 0x4f, 0xbe, 0xb2, 0x52, 0xf6, 0x3e, 0x02, 0xf2, 0xb5, 0xbe,
+    0x74, 0x24, 0xe2, 0x3d, 0x6b, 0x1d, 0xec, 0x3e, 0xa1, 0x8b, 0x20, 0xbe,
+    0x29, 0x03, 0x23, 0xbd, 0xf9, 0xef, 0xc0, 0xbe, 0xbe, 0x2c, 0x51, 0x3e,
+    0xe9, 0x35, 0xc7, 0x3e, 0x35, 0xfe, 0x07, 0x3f, 0x02, 0x9b, 0x41, 0x3d,
+    0xfe, 0x14, 0x10, 0xbf, 0x85, 0xcb, 0xa5, 0xbe, 0x8a, 0x79, 0x36, 0xbe,
+    0xab, 0x83, 0x8d, 0xbe, 0x78, 0xc6, 0x4a, 0xbd, 0xc4, 0x1f, 0xb1, 0x3e,
+    0x0a, 0xc3, 0x46, 0xbe, 0x64, 0xb8, 0x10, 0x3f, 0xc9, 0x9c, 0x16, 0x3e,
+    0x5d, 0x71, 0x00, 0xbe, 0x31, 0x35, 0xd0, 0xbd, 0x81, 0x22, 0x6d, 0xbe,
+    0xd8, 0x2b, 0x9d, 0x3e, 0x4f, 0xb1, 0x5b, 0x3e, 0x9e, 0xf0, 0x9f, 0x3e,
+    0x29, 0xed, 0xa5, 0x3e, 0xaf, 0xc9, 0xd5, 0xbe, 0xa7, 0x0d, 0xdd, 0xbe,
+    0xab, 0xf2, 0xcb, 0x3e, 0x94, 0xf1, 0x99, 0xbe, 0xf2, 0x8f, 0x5e, 0x3e,
+    0x9d, 0x3b, 0x94, 0x3e, 0xc8, 0x0b, 0x3a, 0xbe, 0x59, 0x62, 0xea, 0x3e,
+    0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x6c, 0x32, 0x2a, 0x3e,
+    0x2d, 0x02, 0xcd, 0x3d, 0x40, 0xf9, 0x84, 0x3d, 0x75, 0xa0, 0x1b, 0x3e,
+    0x69, 0xf7, 0x5c, 0xbe, 0xaa, 0x29, 0x20, 0x3e, 0x91, 0x31, 0x8d, 0x3d,
+    0x8e, 0x3c, 0x22, 0x3e, 0x5c, 0xd0, 0x12, 0x3e, 0x48, 0xc8, 0x59, 0x3e,
+    0xcf, 0x91, 0x46, 0x3e, 0x31, 0xe2, 0x8d, 0x3e, 0xa4, 0x3d, 0x0f, 0x3e,
+    0xaf, 0xd6, 0x02, 0x3e, 0x6d, 0x58, 0x31, 0x3e, 0xf7, 0x8a, 0x4c, 0x3e,
+    0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x8c, 0x27, 0x84, 0x3f,
+    0x89, 0x9d, 0x7e, 0x3f, 0xb1, 0x7f, 0x81, 0x3f, 0x23, 0x9f, 0x9b, 0x3f,
+    0x01, 0x15, 0x90, 0x3f, 0x1d, 0x0e, 0x6a, 0x3f, 0xbf, 0x9f, 0x87, 0x3f,
+    0x52, 0x89, 0x73, 0x3f, 0x03, 0x8d, 0x8e, 0x3f, 0x8d, 0xf7, 0x92, 0x3f,
+    0x63, 0x6e, 0x8c, 0x3f, 0x6e, 0xe1, 0x96, 0x3f, 0xcf, 0x51, 0x80, 0x3f,
+    0x6b, 0xcc, 0x85, 0x3f, 0xb7, 0xdc, 0x96, 0x3f, 0xef, 0x3e, 0x92, 0x3f,
+    0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x63, 0x54, 0x5a, 0x3d,
+    0x11, 0x66, 0x62, 0x3e, 0x8a, 0xd5, 0x43, 0xbe, 0x4a, 0xb3, 0xe3, 0x3d,
+    0x42, 0x87, 0x1c, 0xbe, 0x41, 0xa5, 0xe3, 0xbd, 0xd8, 0x46, 0x98, 0xbd,
+    0xa3, 0xaf, 0x62, 0xbd, 0x3d, 0x8d, 0x78, 0x3d, 0xff, 0x5b, 0xbc, 0x3d,
+    0x67, 0xd8, 0x8f, 0x3d, 0x17, 0xeb, 0x8b, 0x3d, 0x11, 0xc7, 0x78, 0xbd,
+    0xa1, 0x16, 0xa3, 0xbd, 0xf3, 0x55, 0x34, 0x3d, 0xb5, 0xbb, 0x25, 0x3e,
+    0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x24, 0xb5, 0x54, 0x3e,
+    0x92, 0x74, 0xa8, 0xbb, 0xbb, 0x78, 0x97, 0x3e, 0x58, 0x7c, 0x11, 0x3e,
+    0xc6, 0x15, 0xab, 0x3e, 0x03, 0xaf, 0x84, 0x3e, 0x99, 0xe2, 0x01, 0x3e,
+    0xbd, 0x56, 0x31, 0x3e, 0xd9, 0x5c, 0x8d, 0x3e, 0x51, 0x80, 0xc5, 0x3e,
+    0x34, 0x24, 0x10, 0x3e, 0x06, 0x96, 0x69, 0x3e, 0xba, 0x0f, 0x66, 0x3a,
+    0x20, 0xa3, 0x93, 0x3e, 0x3d, 0xb7, 0x9c, 0x3e, 0x75, 0x25, 0x91, 0x3e,
+    0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xe3, 0xeb, 0x93, 0xbe,
+    0x85, 0x57, 0xcc, 0xbc, 0x02, 0x2a, 0x9e, 0x3c, 0x25, 0x5c, 0x3a, 0x3e,
+    0x27, 0xe5, 0xd9, 0xbe, 0xc4, 0x74, 0x1e, 0xbd, 0xff, 0x40, 0x99, 0xbe,
+    0x0f, 0x22, 0x64, 0x3e, 0x1f, 0xc7, 0x06, 0xbe, 0x29, 0x0b, 0x96, 0xbe,
+    0x14, 0xfe, 0x16, 0xbd, 0x1f, 0xa2, 0xb3, 0xbd, 0x26, 0x97, 0x34, 0xbe,
+    0xef, 0x72, 0x43, 0xbe, 0xc9, 0x14, 0x97, 0x3e, 0x1f, 0xa2, 0x6b, 0xbe,
+    0x9f, 0x48, 0x14, 0xbf, 0x28, 0x59, 0x89, 0xbe, 0x5b, 0x87, 0xa5, 0x3d,
+    0x2a, 0x2f, 0xbd, 0xbd, 0xc3, 0x8d, 0x1f, 0xbf, 0x84, 0x2c, 0x37, 0x3f,
+    0xef, 0xa3, 0x0a, 0xbf, 0x84, 0xc1, 0xef, 0xbe, 0xdd, 0x48, 0x81, 0xbe,
+    0x54, 0xf6, 0x77, 0x3f, 0xd9, 0x57, 0x95, 0xbe, 0xaa, 0xc5, 0x90, 0xbe,
+    0xc3, 0x8a, 0x43, 0xbf, 0x52, 0x07, 0x40, 0x3f, 0x4e, 0x23, 0xf6, 0xbe,
+    0x2a, 0x38, 0x30, 0x3e, 0x10, 0x03, 0x04, 0xbf, 0xfc, 0x5a, 0xba, 0x3e,
+    0x15, 0x04, 0x99, 0xbd, 0x24, 0x61, 0x8e, 0xbe, 0xd0, 0x1b, 0x1c, 0xbe,
+    0xc2, 0x7e, 0x35, 0x3e, 0x19, 0x9b, 0x63, 0xbe, 0xce, 0xf1, 0x24, 0x3e,
+    0xf4, 0x39, 0x2f, 0x3e, 0x9a, 0xd7, 0xe0, 0xbe, 0xf7, 0x3e, 0xa3, 0xbe,
+    0xf0, 0xdb, 0xf7, 0x3e, 0xe9, 0xb4, 0xee, 0xbd, 0x0e, 0x9d, 0x7e, 0x3e,
+    0xcf, 0xbf, 0xe9, 0xbd, 0xc7, 0x9e, 0xec, 0xbe, 0x42, 0x4d, 0x27, 0x3f,
+    0x2d, 0xac, 0x98, 0x3f, 0xbe, 0xf2, 0x9a, 0xbe, 0xc4, 0x99, 0xb7, 0x3e,
+    0xb5, 0x4b, 0x37, 0x3f, 0x42, 0xd9, 0x14, 0xbe, 0x51, 0xce, 0x0b, 0x3f,
+    0xf4, 0x4c, 0x10, 0xbf, 0x8a, 0x5c, 0xa9, 0xbd, 0x60, 0x1a, 0xfc, 0xbd,
+    0x1c, 0x3d, 0x58, 0x3d, 0xf2, 0x72, 0xed, 0xbe, 0xc2, 0x7a, 0x46, 0x3e,
+    0x13, 0x55, 0x66, 0x3e, 0xe6, 0xb6, 0x96, 0xbe, 0xdd, 0xc0, 0x1b, 0xbe,
+    0x12, 0x12, 0x0f, 0x3e, 0x55, 0xcc, 0x80, 0x3f, 0x94, 0xbe, 0x70, 0xbf,
+    0x38, 0x6c, 0x2f, 0xbd, 0x39, 0xc3, 0xe5, 0xbd, 0x86, 0xbc, 0xba, 0x3e,
+    0xd3, 0xd0, 0xa3, 0xbd, 0x7b, 0x18, 0xdf, 0xbe, 0x95, 0x97, 0x52, 0xbf,
+    0xce, 0xeb, 0xc8, 0x3d, 0x2d, 0x8e, 0xe2, 0x3e, 0x78, 0x8f, 0x17, 0xbf,
+    0x14, 0x31, 0xa7, 0xbe, 0x2b, 0x22, 0x51, 0x3f, 0x50, 0x82, 0x5b, 0xbf,
+    0x2a, 0x24, 0xec, 0xbd, 0x3a, 0xe7, 0x14, 0x3f, 0x89, 0xdf, 0x5f, 0x3f,
+    0x90, 0xf3, 0x5d, 0xbf, 0x05, 0x5d, 0x1a, 0xbf, 0x45, 0x32, 0x66, 0xbe,
+    0x59, 0x0a, 0x37, 0x3f, 0xfe, 0xa7, 0xc3, 0xbe, 0xe0, 0x7d, 0x96, 0xbe,
+    0xa3, 0x7e, 0x1b, 0xbf, 0xbf, 0x9c, 0xda, 0xbe, 0x5c, 0x38, 0xa9, 0x3e,
+    0x9e, 0xb3, 0xa6, 0x3d, 0x04, 0xe3, 0x01, 0xbf, 0x12, 0x5a, 0x2b, 0x3f,
+    0xd8, 0xfb, 0x2b, 0xbf, 0x34, 0xd7, 0x87, 0x3e, 0xec, 0xac, 0x36, 0x3c,
+    0xf6, 0xf8, 0x6a, 0xbf, 0x4b, 0x24, 0xec, 0x3c, 0x21, 0x9a, 0x2e, 0xbd,
+    0x22, 0x0e, 0x83, 0x3f, 0x59, 0x58, 0x78, 0xbe, 0x28, 0x3c, 0x2c, 0x3f,
+    0xdf, 0xa4, 0x15, 0x3f, 0xdb, 0x57, 0x56, 0x3d, 0xc0, 0x79, 0x92, 0xbf,
+    0x46, 0x79, 0x26, 0x3f, 0x7f, 0x88, 0x89, 0xbd, 0x44, 0x80, 0x82, 0x3e,
+    0xbc, 0xe0, 0x67, 0x3d, 0xd6, 0x3c, 0x0e, 0xbf, 0x55, 0x05, 0x7b, 0x3f,
+    0xf2, 0x68, 0xa7, 0x3e, 0x71, 0x0c, 0x2a, 0x3e, 0x35, 0x38, 0xd5, 0x3c,
+    0xfe, 0x34, 0x7e, 0x3e, 0x7e, 0xbf, 0xe0, 0xbe, 0x6e, 0x4d, 0xdd, 0xbb,
+    0x8c, 0xd4, 0xdc, 0xbe, 0x70, 0xa0, 0x73, 0x3c, 0xa9, 0x3a, 0xdc, 0x3e,
+    0xa8, 0x98, 0x3b, 0x3e, 0x8d, 0x5e, 0x37, 0x3e, 0x71, 0x4e, 0xc1, 0x3d,
+    0x1b, 0x5f, 0xe5, 0x3e, 0x45, 0x8a, 0x78, 0xbd, 0x6f, 0x68, 0x80, 0x3e,
+    0xfa, 0x64, 0xa6, 0x3e, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x0a, 0xc8, 0x1a, 0xbd, 0xc8, 0x2b, 0x00, 0x3e, 0xfe, 0x4b, 0xd2, 0xbd,
+    0x6f, 0x1a, 0xc5, 0xbb, 0x82, 0x03, 0x87, 0x3e, 0x0c, 0x55, 0x24, 0x3e,
+    0x77, 0xda, 0x93, 0x3e, 0xe9, 0x14, 0x05, 0xbd, 0x06, 0x00, 0x08, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0x00, 0x00, 0x00, 0x8b, 0xbb, 0x24, 0x3f, 0xca, 0x97, 0x3b, 0xbd,
+    0xf4, 0x2a, 0x94, 0xbe, 0x56, 0x82, 0x84, 0xbf, 0xb6, 0xad, 0xf0, 0xbe,
+    0x2e, 0x40, 0x4c, 0xbf, 0x1a, 0x03, 0x8b, 0x3f, 0x2f, 0x17, 0x42, 0xbf,
+    0x3e, 0x01, 0x97, 0xbe, 0x77, 0x83, 0x95, 0x3f, 0x36, 0x78, 0xc4, 0xbe,
+    0xba, 0xe0, 0x81, 0xbf, 0x2d, 0x66, 0x43, 0x3f, 0x8e, 0x17, 0x5e, 0x3e,
+    0x8f, 0xa7, 0x8d, 0xbf, 0xba, 0xd1, 0xbc, 0xbe, 0x90, 0x1d, 0xa2, 0x3e,
+    0xd1, 0xb7, 0x33, 0xbf, 0x7f, 0x32, 0x64, 0xbe, 0x32, 0x7b, 0x7b, 0x3f,
+    0x7c, 0xed, 0x25, 0x3f, 0x1e, 0x05, 0xac, 0x3e, 0x89, 0x93, 0xae, 0xbb,
+    0x61, 0x5a, 0xfe, 0xbe, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x4f, 0x44, 0xf3, 0x3d, 0xd4, 0x65, 0x8b, 0x3d, 0xac, 0x64, 0x2f, 0xbe,
+};
+
+const int g_rnn_stream_model_float32_len = 8220;
@@ -1,7 +1,7 @@
-#ifndef MODEL32_H_
-#define MODEL32_H_
+#ifndef SINE_MODEL32_H_
+#define SINE_MODEL32_H_
 
 extern const unsigned char g_sine_model_float32[];
 extern const int g_sine_model_float32_len;
 
-#endif  // MODEL32_H_
\ No newline at end of file
+#endif  // SINE_MODEL32_H_
\ No newline at end of file
@@ -1,7 +1,7 @@
-#ifndef MODEL8_H_
-#define MODEL8_H_
+#ifndef SINE_MODEL8_H_
+#define SINE_MODEL8_H_
 
 extern const unsigned char g_sine_model_int8[];
 extern const int g_sine_model_int8_len;
 
-#endif  // MODEL8_H_
\ No newline at end of file
+#endif  // SINE_MODEL8_H_
\ No newline at end of file
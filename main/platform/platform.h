@@ -0,0 +1,77 @@
+#ifndef PLATFORM_H_
+#define PLATFORM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Thin platform abstraction so the benchmark harness builds both as an
+// ESP-IDF application (platform_esp32.cpp) and as a native Linux host
+// executable (platform_host.cpp). Timing lives in utils/bench_timer.h.
+class Platform {
+ public:
+  // Human readable target name for the system info banner
+  static const char* GetName();
+
+  // Heap statistics; 0 where the platform does not track them
+  static size_t GetFreeHeapSize();
+  static size_t GetMinimumFreeHeapSize();
+  // Largest single allocation the default heap could satisfy right now;
+  // well below GetFreeHeapSize() means the heap is fragmented
+  static size_t GetLargestFreeBlock();
+
+  // Heaps by capability. PSRAM (and on the host, DMA) report all zeros
+  // when absent.
+  enum class HeapRegion {
+    INTERNAL,
+    DMA,
+    PSRAM,
+  };
+  static constexpr int kHeapRegionCount = 3;
+  struct HeapRegionStats {
+    size_t total;
+    size_t free;
+    size_t minimum_free;
+    size_t largest_free_block;
+  };
+  static HeapRegionStats GetHeapRegionStats(HeapRegion region);
+
+  // Least stack ever left to the calling task, in bytes; 0 when untracked
+  static size_t GetStackHighWaterMark();
+
+  // Allocation interposition for the zero-allocation check. Between
+  // BeginAllocationWatch() and EndAllocationWatch() heap allocations are
+  // counted and the first one's call site kept: the calling thread's on the
+  // host (malloc hooks), every task's on ESP-IDF (heap tracing, needs
+  // CONFIG_HEAP_TRACING_STANDALONE). Not reentrant; one watch at a time.
+  struct AllocationWatch {
+    bool supported;             // False when the platform cannot interpose
+    uint32_t count;
+    size_t bytes;
+    uintptr_t first_call_site;  // Return address in the allocating code; 0 if unknown
+    bool overflowed;            // Records were dropped; count and bytes are lower bounds
+  };
+  static void BeginAllocationWatch();
+  static AllocationWatch EndAllocationWatch();
+  // Render a code address in a form the platform's tools resolve to a
+  // source line (idf.py monitor decodes bare PCs; addr2line on the host)
+  static void FormatCodeAddress(uintptr_t address, char* buffer, size_t size);
+
+  // Write raw bytes to stdout (the ESP-IDF console, shared with
+  // MicroPrintf text) and flush
+  static void WriteBytes(const void* data, size_t length);
+
+  // Sleep the calling task/thread
+  static void DelayMs(uint32_t ms);
+
+  // CPU cores the benchmark can spread work across
+  static int GetCoreCount();
+
+  // Run fn(arg) on a new task (ESP-IDF) or thread (host) pinned to `core`
+  // at the caller's priority, or just above idle when `low_priority` is
+  // set; pinning and priority are best effort on the host. The task/thread
+  // ends when fn returns. False if it could not be started.
+  static bool StartTask(const char* name, void (*fn)(void*), void* arg, int core,
+                        bool low_priority = false);
+};
+
+#endif  // PLATFORM_H_
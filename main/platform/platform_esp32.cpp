@@ -0,0 +1,143 @@
+/**
+ * @file platform_esp32.cpp
+ * @brief ESP-IDF implementation of the platform layer
+ */
+
+#include "platform.h"
+
+#include <stdio.h>
+
+#include "esp_heap_caps.h"
+#include "esp_heap_trace.h"
+#include "esp_system.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "sdkconfig.h"
+
+const char* Platform::GetName() {
+  return CONFIG_IDF_TARGET;
+}
+
+size_t Platform::GetFreeHeapSize() {
+  return esp_get_free_heap_size();
+}
+
+size_t Platform::GetMinimumFreeHeapSize() {
+  return esp_get_minimum_free_heap_size();
+}
+
+size_t Platform::GetLargestFreeBlock() {
+  return heap_caps_get_largest_free_block(MALLOC_CAP_DEFAULT);
+}
+
+Platform::HeapRegionStats Platform::GetHeapRegionStats(HeapRegion region) {
+  uint32_t caps = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+  if (region == HeapRegion::DMA) caps = MALLOC_CAP_DMA;
+  if (region == HeapRegion::PSRAM) caps = MALLOC_CAP_SPIRAM;
+  HeapRegionStats stats;
+  stats.total = heap_caps_get_total_size(caps);
+  stats.free = heap_caps_get_free_size(caps);
+  stats.minimum_free = heap_caps_get_minimum_free_size(caps);
+  stats.largest_free_block = heap_caps_get_largest_free_block(caps);
+  return stats;
+}
+
+// ESP-IDF's FreeRTOS counts stack in bytes, not words
+size_t Platform::GetStackHighWaterMark() {
+  return uxTaskGetStackHighWaterMark(nullptr);
+}
+
+#if CONFIG_HEAP_TRACING_STANDALONE
+namespace {
+// Only the first records of a watch are kept; a full buffer means later
+// allocations were dropped, so the watch reports itself overflowed
+constexpr size_t kHeapTraceRecords = 64;
+heap_trace_record_t heap_trace_records[kHeapTraceRecords];
+bool heap_trace_ready = false;
+}  // namespace
+
+// Heap tracing sees every task, so the result logger's output (or any
+// other task's) allocating inside a watch is counted as well; the call
+// site tells them apart
+void Platform::BeginAllocationWatch() {
+  if (!heap_trace_ready) {
+    heap_trace_ready = heap_trace_init_standalone(heap_trace_records,
+                                                  kHeapTraceRecords) == ESP_OK;
+  }
+  if (heap_trace_ready) heap_trace_start(HEAP_TRACE_ALL);
+}
+
+Platform::AllocationWatch Platform::EndAllocationWatch() {
+  AllocationWatch watch = {};
+  if (!heap_trace_ready) return watch;
+  heap_trace_stop();
+  watch.supported = true;
+  watch.count = heap_trace_get_count();
+  watch.overflowed = watch.count >= kHeapTraceRecords;
+  for (size_t i = 0; i < watch.count; i++) {
+    heap_trace_record_t record;
+    if (heap_trace_get(i, &record) != ESP_OK) break;
+    watch.bytes += record.size;
+#if CONFIG_HEAP_TRACING_STACK_DEPTH > 0
+    if (i == 0) watch.first_call_site = (uintptr_t)record.alloced_by[0];
+#endif
+  }
+  return watch;
+}
+#else
+// Without heap tracing in sdkconfig the check reports itself unsupported
+void Platform::BeginAllocationWatch() {}
+
+Platform::AllocationWatch Platform::EndAllocationWatch() {
+  return AllocationWatch{};
+}
+#endif  // CONFIG_HEAP_TRACING_STANDALONE
+
+void Platform::FormatCodeAddress(uintptr_t address, char* buffer, size_t size) {
+  snprintf(buffer, size, "0x%08lx", (unsigned long)address);
+}
+
+void Platform::WriteBytes(const void* data, size_t length) {
+  fwrite(data, 1, length, stdout);
+  fflush(stdout);
+}
+
+void Platform::DelayMs(uint32_t ms) {
+  vTaskDelay(pdMS_TO_TICKS(ms));
+}
+
+int Platform::GetCoreCount() {
+  return portNUM_PROCESSORS;
+}
+
+namespace {
+// Enough for MicroInterpreter::Invoke() on the benchmark models
+constexpr uint32_t kTaskStackBytes = 8192;
+
+struct TaskStart {
+  void (*fn)(void*);
+  void* arg;
+};
+
+// FreeRTOS tasks must not return; delete the task once fn is done
+void TaskTrampoline(void* param) {
+  TaskStart start = *static_cast<TaskStart*>(param);
+  delete static_cast<TaskStart*>(param);
+  start.fn(start.arg);
+  vTaskDelete(nullptr);
+}
+}  // namespace
+
+bool Platform::StartTask(const char* name, void (*fn)(void*), void* arg, int core,
+                         bool low_priority) {
+  TaskStart* start = new TaskStart{fn, arg};
+  UBaseType_t priority =
+      low_priority ? tskIDLE_PRIORITY + 1 : uxTaskPriorityGet(nullptr);
+  BaseType_t created = xTaskCreatePinnedToCore(
+      TaskTrampoline, name, kTaskStackBytes, start, priority, nullptr, core);
+  if (created != pdPASS) {
+    delete start;
+    return false;
+  }
+  return true;
+}
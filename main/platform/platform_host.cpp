@@ -0,0 +1,372 @@
+/**
+ * @file platform_host.cpp
+ * @brief Native Linux implementation of the platform layer
+ */
+
+#include "platform.h"
+
+#include <dlfcn.h>
+#include <errno.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <new>
+
+const char* Platform::GetName() {
+#if defined(__x86_64__)
+  return "linux-x86_64";
+#elif defined(__aarch64__)
+  return "linux-aarch64";
+#else
+  return "linux";
+#endif
+}
+
+// Heap accounting via malloc hooks. The host link wraps malloc, calloc,
+// realloc, free and the aligned allocators (-Wl,--wrap, see
+// main/CMakeLists.txt), and operator new/delete below, aligned forms
+// included, route through them, so every allocation made by the harness,
+// TFLite Micro or C++ containers is counted by its usable size. Each
+// counted block carries a tagged header just below the pointer handed out;
+// free() only uncounts blocks with the tag, since libc also returns memory
+// from its own, unhooked, allocations (strdup(), getline(), ...).
+// The host heap is not bounded like the ESP32's; free sizes are reported
+// against a nominal budget the size of an ESP32's internal DRAM so the
+// numbers read like the target's. There is no fragmentation model: the
+// largest free block is all of the free budget.
+namespace {
+constexpr size_t kHostHeapBytes = 320 * 1024;
+constexpr uintptr_t kBlockTag = (uintptr_t)0x6865617062656e63ull;
+
+// Sits immediately below the returned pointer; `offset` is the distance
+// from the underlying block's start, larger than the header for aligned
+// allocations. 16 bytes, so malloc's alignment is kept.
+struct BlockHeader {
+  uintptr_t tag;  // kBlockTag ^ the header's address; cleared on release
+  size_t offset;
+};
+static_assert(sizeof(BlockHeader) == 16, "header must keep malloc's alignment");
+
+std::atomic<size_t> heap_in_use{0};
+std::atomic<size_t> heap_peak{0};
+
+void RecordAllocation(void* block) {
+  size_t usable = malloc_usable_size(block);
+  size_t in_use = heap_in_use.fetch_add(usable) + usable;
+  size_t peak = heap_peak.load();
+  while (in_use > peak && !heap_peak.compare_exchange_weak(peak, in_use)) {
+  }
+}
+
+void RecordRelease(void* block) {
+  heap_in_use.fetch_sub(malloc_usable_size(block));
+}
+
+size_t FreeBytes(size_t used) {
+  return used < kHostHeapBytes ? kHostHeapBytes - used : 0;
+}
+
+// Tag the block and count it; returns the pointer the caller gets
+void* Track(void* block, size_t offset) {
+  if (block == nullptr) return nullptr;
+  void* ptr = static_cast<char*>(block) + offset;
+  BlockHeader* header = static_cast<BlockHeader*>(ptr) - 1;
+  header->tag = kBlockTag ^ (uintptr_t)header;
+  header->offset = offset;
+  RecordAllocation(block);
+  return ptr;
+}
+
+// Header of a block Track() returned, nullptr for anything else
+BlockHeader* HeaderOf(void* ptr) {
+  if (ptr == nullptr) return nullptr;
+  BlockHeader* header = static_cast<BlockHeader*>(ptr) - 1;
+  return header->tag == (kBlockTag ^ (uintptr_t)header) ? header : nullptr;
+}
+
+void* BlockOf(BlockHeader* header) {
+  return reinterpret_cast<char*>(header + 1) - header->offset;
+}
+
+// Room for the header in front of a block aligned to `alignment`
+size_t HeaderSpace(size_t alignment) {
+  return alignment > sizeof(BlockHeader) ? alignment : sizeof(BlockHeader);
+}
+
+// Allocation watch of the calling thread (Platform::BeginAllocationWatch);
+// other threads, such as the result logger, are not counted
+thread_local bool watch_active = false;
+thread_local Platform::AllocationWatch watch = {};
+
+void RecordWatched(void* ptr, size_t size, void* call_site) {
+  if (!watch_active || ptr == nullptr) return;
+  if (watch.count == 0) watch.first_call_site = (uintptr_t)call_site;
+  watch.count++;
+  watch.bytes += size;
+}
+}  // namespace
+
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+void __real_free(void* ptr);
+int __real_posix_memalign(void** ptr, size_t alignment, size_t size);
+}  // extern "C"
+
+namespace {
+void* AllocateTracked(size_t size) {
+  if (size > SIZE_MAX - sizeof(BlockHeader)) return nullptr;
+  return Track(__real_malloc(sizeof(BlockHeader) + size), sizeof(BlockHeader));
+}
+
+// posix_memalign() semantics: EINVAL unless alignment is a power of two
+// multiple of sizeof(void*)
+int AllocateAlignedTracked(void** ptr, size_t alignment, size_t size) {
+  if (alignment < sizeof(void*) || (alignment & (alignment - 1)) != 0) return EINVAL;
+  const size_t space = HeaderSpace(alignment);
+  if (size > SIZE_MAX - space) return ENOMEM;
+  void* block = nullptr;
+  int error = __real_posix_memalign(&block, alignment, space + size);
+  if (error != 0) return error;
+  *ptr = Track(block, space);
+  return 0;
+}
+
+// free() of either kind of pointer. operator delete calls this rather than
+// free(), which the compiler would flag as freeing an offset pointer.
+void Release(void* ptr) {
+  BlockHeader* header = HeaderOf(ptr);
+  if (header == nullptr) {
+    __real_free(ptr);
+    return;
+  }
+  void* block = BlockOf(header);
+  header->tag = 0;
+  RecordRelease(block);
+  __real_free(block);
+}
+
+// aligned_alloc() and memalign(): small alignments are rounded up
+void* AllocateAlignedOrNull(size_t alignment, size_t size, void* call_site) {
+  void* ptr = nullptr;
+  if (alignment < sizeof(void*)) alignment = sizeof(void*);
+  if (AllocateAlignedTracked(&ptr, alignment, size) != 0) return nullptr;
+  RecordWatched(ptr, size, call_site);
+  return ptr;
+}
+}  // namespace
+
+extern "C" {
+void* __wrap_malloc(size_t size) {
+  void* ptr = AllocateTracked(size);
+  RecordWatched(ptr, size, __builtin_return_address(0));
+  return ptr;
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+  size_t bytes;
+  if (__builtin_mul_overflow(count, size, &bytes) ||
+      bytes > SIZE_MAX - sizeof(BlockHeader)) {
+    return nullptr;
+  }
+  void* ptr = Track(__real_calloc(1, sizeof(BlockHeader) + bytes), sizeof(BlockHeader));
+  RecordWatched(ptr, bytes, __builtin_return_address(0));
+  return ptr;
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+  if (ptr == nullptr) {
+    void* result = AllocateTracked(size);
+    RecordWatched(result, size, __builtin_return_address(0));
+    return result;
+  }
+  BlockHeader* header = HeaderOf(ptr);
+  if (header == nullptr) return __real_realloc(ptr, size);  // Not ours, not counted
+  if (size == 0) {
+    Release(ptr);
+    return nullptr;
+  }
+  // The block keeps its header offset; as with realloc(), an aligned
+  // block's extended alignment is not preserved
+  const size_t offset = header->offset;
+  if (size > SIZE_MAX - offset) return nullptr;
+  void* block = BlockOf(header);
+  const size_t old_usable = malloc_usable_size(block);
+  void* resized = __real_realloc(block, offset + size);
+  if (resized == nullptr) return nullptr;  // Old block untouched and still counted
+  heap_in_use.fetch_sub(old_usable);
+  void* result = Track(resized, offset);
+  RecordWatched(result, size, __builtin_return_address(0));
+  return result;
+}
+
+void __wrap_free(void* ptr) {
+  Release(ptr);
+}
+
+int __wrap_posix_memalign(void** ptr, size_t alignment, size_t size) {
+  int error = AllocateAlignedTracked(ptr, alignment, size);
+  if (error == 0) RecordWatched(*ptr, size, __builtin_return_address(0));
+  return error;
+}
+
+void* __wrap_aligned_alloc(size_t alignment, size_t size) {
+  return AllocateAlignedOrNull(alignment, size, __builtin_return_address(0));
+}
+
+void* __wrap_memalign(size_t alignment, size_t size) {
+  return AllocateAlignedOrNull(alignment, size, __builtin_return_address(0));
+}
+}  // extern "C"
+
+// libstdc++'s array and nothrow forms all end up in these. The watch is
+// fed here rather than by malloc so the call site is the new-expression.
+void* operator new(size_t size) {
+  void* ptr = AllocateTracked(size);
+  if (ptr == nullptr) throw std::bad_alloc();
+  RecordWatched(ptr, size, __builtin_return_address(0));
+  return ptr;
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+  void* ptr = nullptr;
+  if (AllocateAlignedTracked(&ptr, static_cast<size_t>(alignment), size) != 0) {
+    throw std::bad_alloc();
+  }
+  RecordWatched(ptr, size, __builtin_return_address(0));
+  return ptr;
+}
+
+void operator delete(void* ptr) noexcept {
+  Release(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+  Release(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+  Release(ptr);
+}
+
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept {
+  Release(ptr);
+}
+
+size_t Platform::GetFreeHeapSize() {
+  return FreeBytes(heap_in_use.load());
+}
+
+size_t Platform::GetMinimumFreeHeapSize() {
+  return FreeBytes(heap_peak.load());
+}
+
+size_t Platform::GetLargestFreeBlock() {
+  return GetFreeHeapSize();
+}
+
+// The budget stands in for internal RAM; no DMA-capable or PSRAM heaps
+Platform::HeapRegionStats Platform::GetHeapRegionStats(HeapRegion region) {
+  HeapRegionStats stats = {};
+  if (region == HeapRegion::INTERNAL) {
+    stats.total = kHostHeapBytes;
+    stats.free = GetFreeHeapSize();
+    stats.minimum_free = GetMinimumFreeHeapSize();
+    stats.largest_free_block = stats.free;
+  }
+  return stats;
+}
+
+// Thread stacks are not painted on the host
+size_t Platform::GetStackHighWaterMark() {
+  return 0;
+}
+
+void Platform::BeginAllocationWatch() {
+  watch = {};
+  watch.supported = true;
+  watch_active = true;
+}
+
+Platform::AllocationWatch Platform::EndAllocationWatch() {
+  watch_active = false;
+  return watch;
+}
+
+// "binary+0xoffset", which `addr2line -f -C -e binary 0xoffset` resolves
+// even for a position-independent executable
+void Platform::FormatCodeAddress(uintptr_t address, char* buffer, size_t size) {
+  Dl_info info;
+  if (address != 0 && dladdr((void*)address, &info) != 0 && info.dli_fname != nullptr) {
+    snprintf(buffer, size, "%s+0x%lx", info.dli_fname,
+             (unsigned long)(address - (uintptr_t)info.dli_fbase));
+  } else {
+    snprintf(buffer, size, "0x%lx", (unsigned long)address);
+  }
+}
+
+void Platform::WriteBytes(const void* data, size_t length) {
+  fwrite(data, 1, length, stdout);
+  fflush(stdout);
+}
+
+void Platform::DelayMs(uint32_t ms) {
+  struct timespec ts;
+  ts.tv_sec = ms / 1000;
+  ts.tv_nsec = (long)(ms % 1000) * 1000000L;
+  while (nanosleep(&ts, &ts) != 0) {
+  }
+}
+
+int Platform::GetCoreCount() {
+  long cores = sysconf(_SC_NPROCESSORS_ONLN);
+  return cores > 0 ? (int)cores : 1;
+}
+
+namespace {
+struct TaskStart {
+  void (*fn)(void*);
+  void* arg;
+};
+
+void* ThreadTrampoline(void* param) {
+  TaskStart start = *static_cast<TaskStart*>(param);
+  delete static_cast<TaskStart*>(param);
+  start.fn(start.arg);
+  return nullptr;
+}
+}  // namespace
+
+bool Platform::StartTask(const char* name, void (*fn)(void*), void* arg, int core,
+                         bool low_priority) {
+  (void)name;
+  TaskStart* start = new TaskStart{fn, arg};
+  pthread_t thread;
+  if (pthread_create(&thread, nullptr, ThreadTrampoline, start) != 0) {
+    delete start;
+    return false;
+  }
+#if defined(__linux__)
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  CPU_SET(core, &cpus);
+  pthread_setaffinity_np(thread, sizeof(cpus), &cpus);  // Best effort
+  if (low_priority) {
+    // SCHED_IDLE needs no privileges; best effort like the affinity
+    struct sched_param param = {};
+    pthread_setschedparam(thread, SCHED_IDLE, &param);
+  }
+#else
+  (void)low_priority;
+#endif
+  pthread_detach(thread);
+  return true;
+}
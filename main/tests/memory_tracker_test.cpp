@@ -0,0 +1,99 @@
+/**
+ * @file memory_tracker_test.cpp
+ * @brief Host check that MemoryTracker phases and the allocation watch see
+ *        every allocator the host hooks (ctest)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <new>
+
+#include "memory_tracker.h"
+#include "platform.h"
+
+namespace {
+int failures = 0;
+
+#define CHECK(condition)                                          \
+  do {                                                            \
+    if (!(condition)) {                                           \
+      fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__,     \
+              __LINE__, #condition);                              \
+      failures++;                                                 \
+    }                                                             \
+  } while (0)
+
+constexpr size_t kBytes = 4096;
+
+// Keeps the compiler from pairing up and eliding new/delete
+void* volatile sink;
+
+void TestAlignedNewMovesPhaseCounter() {
+  MemoryTracker tracker;
+  tracker.Snapshot(MemoryPhase::MODEL_START);
+  char* ptr = new (std::align_val_t{16}) char[kBytes];
+  sink = ptr;
+  tracker.Snapshot(MemoryPhase::MODEL_LOADED);
+  CHECK(tracker.HeapUsed(MemoryPhase::MODEL_START, MemoryPhase::MODEL_LOADED) >= kBytes);
+  ::operator delete[](ptr, std::align_val_t{16});
+  tracker.Snapshot(MemoryPhase::TENSORS_ALLOCATED);
+  CHECK(tracker.Get(MemoryPhase::TENSORS_ALLOCATED).free_heap ==
+        tracker.Get(MemoryPhase::MODEL_START).free_heap);
+}
+
+void TestOverAlignedNewIsWatched() {
+  struct alignas(64) Line {
+    char bytes[64];
+  };
+  Platform::BeginAllocationWatch();
+  Line* line = new Line;
+  sink = line;
+  Platform::AllocationWatch watch = Platform::EndAllocationWatch();
+  CHECK(watch.count == 1);
+  CHECK(watch.bytes == sizeof(Line));
+  CHECK(reinterpret_cast<uintptr_t>(line) % alignof(Line) == 0);
+  delete line;
+}
+
+void TestCAlignedAllocatorsAreCounted() {
+  const size_t before = Platform::GetFreeHeapSize();
+  void* memaligned = nullptr;
+  CHECK(posix_memalign(&memaligned, 32, kBytes) == 0);
+  void* aligned = aligned_alloc(64, kBytes);
+  sink = aligned;
+  CHECK(reinterpret_cast<uintptr_t>(memaligned) % 32 == 0);
+  CHECK(reinterpret_cast<uintptr_t>(aligned) % 64 == 0);
+  CHECK(before - Platform::GetFreeHeapSize() >= 2 * kBytes);
+  free(memaligned);
+  free(aligned);
+  CHECK(Platform::GetFreeHeapSize() == before);
+}
+
+// strdup() allocates inside libc, past the hooks; freeing it must not
+// uncount anything
+void TestUntrackedFreeIsIgnored() {
+  void* tracked = malloc(kBytes);
+  sink = tracked;
+  const size_t before = Platform::GetFreeHeapSize();
+  char* copy = strdup("allocated by libc");
+  sink = copy;
+  free(copy);
+  CHECK(Platform::GetFreeHeapSize() == before);
+  free(tracked);
+}
+}  // namespace
+
+int main() {
+  TestAlignedNewMovesPhaseCounter();
+  TestOverAlignedNewIsWatched();
+  TestCAlignedAllocatorsAreCounted();
+  TestUntrackedFreeIsIgnored();
+  if (failures > 0) {
+    fprintf(stderr, "%d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("memory_tracker_test passed\n");
+  return 0;
+}
@@ -0,0 +1,109 @@
+#ifndef ALLOCATION_GUARD_H_
+#define ALLOCATION_GUARD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tensorflow/lite/micro/micro_log.h"
+#include "platform.h"
+
+// Zero-allocation check for the timed Invoke() path.
+//
+// TFLite Micro plans every buffer into the arena up front, so Invoke()
+// should never touch the heap; a kernel, profiler or logging call that does
+// turns into a latency spike (and fragmentation) on target. Begin()/End()
+// bracket each timed region, outside the timer reads, with a platform
+// allocation watch; allocations are summed per model and Report() fails
+// the model when there were any, naming the first call site. A platform
+// that cannot watch the heap is reported UNSUPPORTED, never as passing.
+class AllocationGuard {
+ public:
+  // DISABLED: kCheckInvokeAllocations is off. UNSUPPORTED: the platform
+  // could not watch the heap, so nothing was checked. DIRTY also covers a
+  // watch that dropped records (the counts are then lower bounds).
+  enum class Verdict { DISABLED, UNSUPPORTED, CLEAN, DIRTY };
+
+  explicit AllocationGuard(bool enabled) : enabled_(enabled) {}
+
+  bool enabled() const { return enabled_; }
+
+  void Reset() {
+    regions_ = 0;
+    dirty_regions_ = 0;
+    allocations_ = 0;
+    bytes_ = 0;
+    first_call_site_ = 0;
+    supported_ = true;
+    overflowed_ = false;
+  }
+
+  void Begin() {
+    if (enabled_) Platform::BeginAllocationWatch();
+  }
+
+  void End() {
+    if (!enabled_) return;
+    Platform::AllocationWatch watch = Platform::EndAllocationWatch();
+    supported_ = supported_ && watch.supported;
+    overflowed_ = overflowed_ || watch.overflowed;
+    regions_++;
+    if (watch.count == 0 && !watch.overflowed) return;
+    if (first_call_site_ == 0) first_call_site_ = watch.first_call_site;
+    dirty_regions_++;
+    allocations_ += watch.count;
+    bytes_ += watch.bytes;
+  }
+
+  Verdict verdict() const {
+    if (!enabled_) return Verdict::DISABLED;
+    if (!supported_) return Verdict::UNSUPPORTED;
+    return dirty_regions_ == 0 ? Verdict::CLEAN : Verdict::DIRTY;
+  }
+
+  // Print the verdict and a CSV_ALLOC line for this model
+  void Report(const char* model_name, const char* quantization) const {
+    const Verdict result = verdict();
+    if (result == Verdict::DISABLED) return;
+    char call_site[96] = "";
+    if (result == Verdict::UNSUPPORTED) {
+      MicroPrintf("Allocation check UNSUPPORTED: heap not watched (ESP-IDF needs CONFIG_HEAP_TRACING_STANDALONE)");
+    } else if (result == Verdict::DIRTY) {
+      Platform::FormatCodeAddress(first_call_site_, call_site, sizeof(call_site));
+      MicroPrintf("Allocation check FAILED: %s%lu allocations (%zu bytes) in %lu of %lu timed regions, first from %s",
+                  overflowed_ ? "at least " : "", (unsigned long)allocations_, bytes_,
+                  (unsigned long)dirty_regions_, (unsigned long)regions_, call_site);
+    } else {
+      MicroPrintf("Allocation check passed: no heap allocations in %lu timed regions",
+                  (unsigned long)regions_);
+    }
+    MicroPrintf("CSV_ALLOC,%s,%s,%s,%lu,%lu,%lu,%zu,%d,%s", model_name, quantization,
+                VerdictName(result), (unsigned long)regions_,
+                (unsigned long)dirty_regions_, (unsigned long)allocations_, bytes_,
+                overflowed_ ? 1 : 0, call_site);
+  }
+
+  static void PrintCsvHeader() {
+    MicroPrintf("CSV_ALLOC_HEADER,model_name,quantization,verdict,regions,dirty_regions,allocations,bytes,overflowed,first_call_site");
+  }
+
+ private:
+  static const char* VerdictName(Verdict verdict) {
+    switch (verdict) {
+      case Verdict::UNSUPPORTED: return "unsupported";
+      case Verdict::CLEAN: return "clean";
+      case Verdict::DIRTY: return "dirty";
+      default: return "disabled";
+    }
+  }
+
+  bool enabled_;
+  bool supported_ = true;
+  bool overflowed_ = false;
+  uint32_t regions_ = 0;
+  uint32_t dirty_regions_ = 0;
+  uint32_t allocations_ = 0;
+  size_t bytes_ = 0;
+  uintptr_t first_call_site_ = 0;
+};
+
+#endif  // ALLOCATION_GUARD_H_
@@ -0,0 +1,147 @@
+#ifndef BENCH_TIMER_H_
+#define BENCH_TIMER_H_
+
+#include <stdint.h>
+
+// Timing backends
+#define BENCH_TIMER_CYCLE_COUNTER 1   // Xtensa/RISC-V CCOUNT, CPU cycles
+#define BENCH_TIMER_ESP_TIMER 2       // esp_timer_get_time(), 1 us ticks
+#define BENCH_TIMER_CLOCK_GETTIME 3   // CLOCK_MONOTONIC_RAW, 1 ns ticks
+#define BENCH_TIMER_RDTSC 4           // x86 time stamp counter
+
+// Select the timing source, override with -DBENCH_TIMER_BACKEND=...
+#ifndef BENCH_TIMER_BACKEND
+#if defined(ESP_PLATFORM)
+#define BENCH_TIMER_BACKEND BENCH_TIMER_CYCLE_COUNTER
+#else
+#define BENCH_TIMER_BACKEND BENCH_TIMER_CLOCK_GETTIME
+#endif
+#endif
+
+#if defined(ESP_PLATFORM)
+#include "esp_timer.h"
+#if BENCH_TIMER_BACKEND == BENCH_TIMER_CYCLE_COUNTER
+#include "esp_cpu.h"
+#endif
+#else
+#include <time.h>
+#if BENCH_TIMER_BACKEND == BENCH_TIMER_RDTSC
+#include <x86intrin.h>
+#endif
+#endif
+
+// High-resolution timer for the measurement loop.
+//
+// Now() returns raw backend ticks. Calibrate() must run once at startup: it
+// measures the tick rate against a reference clock and the cost of an empty
+// Now()/Now() pair, which Elapsed() subtracts from every measurement so
+// tens-of-microsecond inferences are not dominated by timer overhead.
+class BenchTimer {
+ public:
+#if BENCH_TIMER_BACKEND == BENCH_TIMER_CYCLE_COUNTER
+  // 32-bit counter, wraps after ~17 s at 240 MHz; fine for single intervals
+  typedef uint32_t Ticks;
+#else
+  typedef uint64_t Ticks;
+#endif
+
+  static inline Ticks Now() {
+#if BENCH_TIMER_BACKEND == BENCH_TIMER_CYCLE_COUNTER
+    return (Ticks)esp_cpu_get_cycle_count();
+#elif BENCH_TIMER_BACKEND == BENCH_TIMER_ESP_TIMER
+    return (Ticks)esp_timer_get_time();
+#elif BENCH_TIMER_BACKEND == BENCH_TIMER_RDTSC
+    _mm_lfence();
+    return (Ticks)__rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+    return (Ticks)ts.tv_sec * 1000000000ull + (Ticks)ts.tv_nsec;
+#endif
+  }
+
+  static const char* BackendName() {
+#if BENCH_TIMER_BACKEND == BENCH_TIMER_CYCLE_COUNTER
+    return "cpu_cycles";
+#elif BENCH_TIMER_BACKEND == BENCH_TIMER_ESP_TIMER
+    return "esp_timer";
+#elif BENCH_TIMER_BACKEND == BENCH_TIMER_RDTSC
+    return "rdtsc";
+#else
+    return "clock_gettime";
+#endif
+  }
+
+  // Measure tick rate and empty-timer overhead
+  static void Calibrate() {
+    // Tick rate against the microsecond reference clock
+    const int64_t kCalibrationWindowUs = 20000;
+    int64_t ref_start = ReferenceMicros();
+    Ticks start = Now();
+    while (ReferenceMicros() - ref_start < kCalibrationWindowUs) {
+    }
+    Ticks end = Now();
+    int64_t ref_elapsed = ReferenceMicros() - ref_start;
+    ticks_per_us_ = (double)(Ticks)(end - start) / (double)ref_elapsed;
+
+    // Overhead of back-to-back reads; the minimum is the fixed cost and
+    // never over-corrects a real measurement
+    const int kOverheadSamples = 1000;
+    Ticks min_overhead = (Ticks)-1;
+    for (int i = 0; i < kOverheadSamples; i++) {
+      Ticks t0 = Now();
+      Ticks t1 = Now();
+      Ticks delta = (Ticks)(t1 - t0);
+      if (delta < min_overhead) min_overhead = delta;
+    }
+    overhead_ticks_ = min_overhead;
+  }
+
+  // Overhead-corrected interval between two Now() readings
+  static inline Ticks Elapsed(Ticks start, Ticks end) {
+    Ticks raw = (Ticks)(end - start);
+    return (raw > overhead_ticks_) ? (Ticks)(raw - overhead_ticks_) : 0;
+  }
+
+  static inline double ToMicros(Ticks ticks) {
+    return (double)ticks / ticks_per_us_;
+  }
+
+  static double ticks_per_us() { return ticks_per_us_; }
+  static Ticks overhead_ticks() { return overhead_ticks_; }
+
+ private:
+  static int64_t ReferenceMicros() {
+#if defined(ESP_PLATFORM)
+    return esp_timer_get_time();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#endif
+  }
+
+  static inline double ticks_per_us_ = 1.0;
+  static inline Ticks overhead_ticks_ = 0;
+};
+
+// 64-bit timeline in BenchTimer ticks, for schedules spanning more than one
+// wrap of the 32-bit cycle counter. Read() must be called at least once per
+// wrap (~17 s at 240 MHz).
+class BenchClock {
+ public:
+  BenchClock() : last_(BenchTimer::Now()), elapsed_(0) {}
+
+  uint64_t Read() {
+    BenchTimer::Ticks now = BenchTimer::Now();
+    elapsed_ += (BenchTimer::Ticks)(now - last_);
+    last_ = now;
+    return elapsed_;
+  }
+
+ private:
+  BenchTimer::Ticks last_;
+  uint64_t elapsed_;
+};
+
+#endif  // BENCH_TIMER_H_
@@ -1,29 +1,371 @@
 #ifndef CSV_LOGGER_H_
 #define CSV_LOGGER_H_
 
+#include <stdint.h>
+#include <string.h>
+
 #include "tensorflow/lite/micro/micro_log.h"
+#include "latency_histogram.h"
+#include "telemetry_frame.h"
 
+// Machine-readable benchmark output. In the default text mode every record
+// is a CSV_* line. Binary mode (SetBinary) replaces the high-volume
+// records - CSV_TIMER, CSV_DATA and CSV_SUMMARY - with TelemetryFrames that
+// carry a model id instead of strings and skip float formatting entirely;
+// CSV_DATA samples are batched up to kBatchSamples per frame, each field a
+// varint delta against the previous sample at the CSV line's precision.
+// scripts/decode_telemetry.py turns a capture back into the same CSV lines.
+// The remaining per-mode CSV lines stay text in both modes.
 class CSVLogger {
  public:
+  static void SetBinary(bool binary) { binary_ = binary; }
+  static bool binary() { return binary_; }
+
   static void PrintHeader() {
-    MicroPrintf("CSV_HEADER,iteration,model_name,quantization,latency_us,min_us,max_us,avg_us,stddev_us,arena_bytes,free_heap");
+    if (binary_) {
+      // Frames follow; the decoder splices them back in as CSV lines
+      MicroPrintf("TELEMETRY_BINARY,%d", TelemetryFrame::kVersion);
+    }
+    MicroPrintf("CSV_HEADER,iteration,model_name,quantization,latency_us,latency_ticks,min_us,max_us,avg_us,stddev_us,p50_us,p90_us,p99_us,p999_us,arena_bytes,free_heap");
+    MicroPrintf("CSV_SUMMARY_HEADER,model_name,quantization,completed,avg_us,avg_ticks,min_us,max_us,stddev_us,p50_us,p90_us,p99_us,p999_us,arena_bytes,heap_used,inferences,throughput_ips,batch_size,per_sample_us");
+  }
+
+  static void PrintRateHeader() {
+    MicroPrintf("CSV_RATE_HEADER,model_name,quantization,rate_hz,released,completed,dropped,missed,overruns,response_avg_us,response_p99_us,response_max_us,service_avg_us,service_max_us");
+  }
+
+  // One line per model and release rate in FIXED_RATE mode
+  static void LogRate(const char* model_name,
+                      const char* quantization,
+                      int rate_hz,
+                      int64_t released,
+                      int64_t completed,
+                      int64_t dropped,
+                      int64_t missed,
+                      int64_t overruns,
+                      float response_avg_us,
+                      float response_p99_us,
+                      float response_max_us,
+                      float service_avg_us,
+                      float service_max_us) {
+    MicroPrintf("CSV_RATE,%s,%s,%d,%lld,%lld,%lld,%lld,%lld,%.2f,%.1f,%.2f,%.2f,%.2f",
+                model_name, quantization, rate_hz, (long long)released,
+                (long long)completed, (long long)dropped, (long long)missed,
+                (long long)overruns, response_avg_us, response_p99_us,
+                response_max_us, service_avg_us, service_max_us);
+  }
+
+  static void PrintPipelineHeader() {
+    MicroPrintf("CSV_PIPELINE_HEADER,model_name,quantization,inferences,preprocess_us,serial_ips,pipelined_ips,speedup,consumer_wait_us,producer_wait_us");
+  }
+
+  // One line per model in PIPELINE mode
+  static void LogPipeline(const char* model_name,
+                          const char* quantization,
+                          int64_t inferences,
+                          int preprocess_us,
+                          float serial_ips,
+                          float pipelined_ips,
+                          float consumer_wait_us,
+                          float producer_wait_us) {
+    MicroPrintf("CSV_PIPELINE,%s,%s,%lld,%d,%.2f,%.2f,%.3f,%.2f,%.2f",
+                model_name, quantization, (long long)inferences, preprocess_us,
+                serial_ips, pipelined_ips,
+                serial_ips > 0.0f ? pipelined_ips / serial_ips : 0.0f,
+                consumer_wait_us, producer_wait_us);
+  }
+
+  static void PrintStreamingHeader() {
+    MicroPrintf("CSV_STREAMING_HEADER,quantization,sequence_length,full_avg_us,full_per_step_us,stream_avg_us,full_p99_us,stream_p99_us,per_sample_speedup");
+  }
+
+  // Full-sequence vs streaming RNN, once per sweep
+  static void LogStreaming(const char* quantization,
+                           int sequence_length,
+                           float full_avg_us,
+                           float stream_avg_us,
+                           float full_p99_us,
+                           float stream_p99_us) {
+    MicroPrintf("CSV_STREAMING,%s,%d,%.2f,%.2f,%.2f,%.1f,%.1f,%.3f",
+                quantization, sequence_length, full_avg_us,
+                full_avg_us / sequence_length, stream_avg_us,
+                full_p99_us, stream_p99_us,
+                stream_avg_us > 0.0f ? full_avg_us / stream_avg_us : 0.0f);
+  }
+
+  static void PrintFusionHeader() {
+    MicroPrintf("CSV_FUSION_HEADER,quantization,unfused_avg_us,fused_avg_us,speedup,unfused_p99_us,fused_p99_us,unfused_arena_bytes,fused_arena_bytes,arena_saved_bytes");
+  }
+
+  // Unfused CNN vs CONV_RELU_POOL-fused CNN, once per sweep and quantization
+  static void LogFusion(const char* quantization,
+                        float unfused_avg_us,
+                        float fused_avg_us,
+                        float unfused_p99_us,
+                        float fused_p99_us,
+                        size_t unfused_arena_bytes,
+                        size_t fused_arena_bytes) {
+    MicroPrintf("CSV_FUSION,%s,%.2f,%.2f,%.3f,%.1f,%.1f,%u,%u,%d",
+                quantization, unfused_avg_us, fused_avg_us,
+                fused_avg_us > 0.0f ? unfused_avg_us / fused_avg_us : 0.0f,
+                unfused_p99_us, fused_p99_us,
+                (unsigned)unfused_arena_bytes, (unsigned)fused_arena_bytes,
+                (int)unfused_arena_bytes - (int)fused_arena_bytes);
+  }
+
+  static void PrintConcurrentHeader() {
+    MicroPrintf("CSV_CONCURRENT_HEADER,pair,model_name,quantization,core,inferences,solo_avg_us,concurrent_avg_us,slowdown_pct,solo_p99_us,concurrent_p99_us");
+  }
+
+  // One line per model of a pair in CONCURRENT mode
+  static void LogConcurrent(int pair,
+                            const char* model_name,
+                            const char* quantization,
+                            int core,
+                            int64_t inferences,
+                            float solo_avg_us,
+                            float concurrent_avg_us,
+                            float solo_p99_us,
+                            float concurrent_p99_us) {
+    float slowdown_pct = solo_avg_us > 0.0f
+        ? 100.0f * (concurrent_avg_us - solo_avg_us) / solo_avg_us : 0.0f;
+    MicroPrintf("CSV_CONCURRENT,%d,%s,%s,%d,%lld,%.2f,%.2f,%.1f,%.1f,%.1f",
+                pair, model_name, quantization, core, (long long)inferences,
+                solo_avg_us, concurrent_avg_us, slowdown_pct,
+                solo_p99_us, concurrent_p99_us);
+  }
+
+  // KERNEL_AB mode: column headers for CSV_KERNEL_OP and CSV_KERNEL
+  static void PrintKernelHeader() {
+    MicroPrintf("CSV_KERNEL_OP_HEADER,model_name,quantization,backend,node,op,op_backend,avg_us,baseline_us,speedup");
+    MicroPrintf("CSV_KERNEL_HEADER,model_name,quantization,backend,kernels,inferences,avg_us,baseline_us,speedup,max_abs_delta,mean_abs_delta");
+  }
+
+  // KERNEL_AB mode: one graph node under one backend; op_backend is the
+  // kernel that actually ran (tflm when the backend has none for the op)
+  static void LogKernelOp(const char* model_name,
+                          const char* quantization,
+                          const char* backend,
+                          int node,
+                          const char* op,
+                          const char* op_backend,
+                          double avg_us,
+                          double baseline_us) {
+    MicroPrintf("CSV_KERNEL_OP,%s,%s,%s,%d,%s,%s,%.2f,%.2f,%.3f",
+                model_name, quantization, backend, node, op, op_backend,
+                avg_us, baseline_us, avg_us > 0.0 ? baseline_us / avg_us : 0.0);
+  }
+
+  // KERNEL_AB mode: whole model under one backend; deltas are against the
+  // tflm backend's outputs in dequantized units
+  static void LogKernel(const char* model_name,
+                        const char* quantization,
+                        const char* backend,
+                        int kernels,
+                        int64_t inferences,
+                        double avg_us,
+                        double baseline_us,
+                        float max_abs_delta,
+                        float mean_abs_delta) {
+    MicroPrintf("CSV_KERNEL,%s,%s,%s,%d,%lld,%.2f,%.2f,%.3f,%g,%g",
+                model_name, quantization, backend, kernels, (long long)inferences,
+                avg_us, baseline_us, avg_us > 0.0 ? baseline_us / avg_us : 0.0,
+                max_abs_delta, mean_abs_delta);
+  }
+
+  // AOT mode: column header for CSV_AOT
+  static void PrintAotHeader() {
+    MicroPrintf("CSV_AOT_HEADER,model_name,quantization,batch_size,inferences,interpreter_setup_us,interpreter_avg_us,aot_avg_us,speedup,interpreter_min_us,aot_min_us,interpreter_arena_bytes,aot_arena_bytes,max_abs_delta");
+  }
+
+  // AOT mode: interpreter vs ahead-of-time compiled code on the same
+  // inputs; setup is Begin() (parse, allocate, Prepare), which the
+  // generated code does at build time. Delta in dequantized units.
+  static void LogAot(const char* model_name,
+                     const char* quantization,
+                     int batch_size,
+                     int64_t inferences,
+                     double interpreter_setup_us,
+                     double interpreter_avg_us,
+                     double aot_avg_us,
+                     double interpreter_min_us,
+                     double aot_min_us,
+                     size_t interpreter_arena_bytes,
+                     size_t aot_arena_bytes,
+                     float max_abs_delta) {
+    MicroPrintf("CSV_AOT,%s,%s,%d,%lld,%.1f,%.2f,%.2f,%.3f,%.2f,%.2f,%u,%u,%g",
+                model_name, quantization, batch_size, (long long)inferences,
+                interpreter_setup_us, interpreter_avg_us, aot_avg_us,
+                aot_avg_us > 0.0 ? interpreter_avg_us / aot_avg_us : 0.0,
+                interpreter_min_us, aot_min_us, (unsigned)interpreter_arena_bytes,
+                (unsigned)aot_arena_bytes, max_abs_delta);
+  }
+
+  // Binary mode only: id used by the INFERENCE/SUMMARY frames of a model
+  static void LogModel(int model_id, const char* model_name,
+                       const char* quantization, int batch_size) {
+    if (!binary_) return;
+    TelemetryFrame frame(TelemetryFrame::MODEL);
+    frame.Put8((uint8_t)model_id);
+    frame.Put16((uint16_t)batch_size);
+    frame.PutString(model_name);
+    frame.PutString(quantization);
+    frame.Send();
+  }
+
+  // Timing backend the *_ticks columns are expressed in
+  static void LogTimer(const char* backend, double ticks_per_us,
+                       uint32_t overhead_ticks) {
+    if (binary_) {
+      TelemetryFrame frame(TelemetryFrame::SESSION);
+      frame.PutFloat((float)ticks_per_us);
+      frame.Put32(overhead_ticks);
+      frame.PutString(backend);
+      frame.Send();
+      return;
+    }
+    MicroPrintf("CSV_TIMER,%s,%.3f,%lu", backend, ticks_per_us,
+                (unsigned long)overhead_ticks);
   }
   
-  static void LogInference(int64_t iteration,
+  static void LogInference(int model_id,
+                          int64_t iteration,
                           const char* model_name,
                           const char* quantization,
-                          int64_t latency_us,
-                          int64_t min_latency,
-                          int64_t max_latency,
-                          int64_t avg_latency,
+                          float latency_us,
+                          uint32_t latency_ticks,
+                          float min_latency,
+                          float max_latency,
+                          float avg_latency,
                           float stddev,
+                          const LatencyPercentiles& percentiles,
                           size_t arena_bytes,
                           size_t free_heap) {
-    MicroPrintf("CSV_DATA,%lld,%s,%s,%lld,%lld,%lld,%lld,%.2f,%zu,%zu",
+    if (binary_) {
+      // Same precision as the CSV_DATA columns: 0.01 us, percentiles 0.1 us
+      const int64_t sample[kSampleFields] = {
+        iteration, Fixed(latency_us, 100), latency_ticks,
+        Fixed(min_latency, 100), Fixed(max_latency, 100),
+        Fixed(avg_latency, 100), Fixed(stddev, 100),
+        Fixed(percentiles.p50, 10), Fixed(percentiles.p90, 10),
+        Fixed(percentiles.p99, 10), Fixed(percentiles.p999, 10),
+        (int64_t)arena_bytes, (int64_t)free_heap,
+      };
+      AppendSample(model_id, sample);
+      return;
+    }
+    MicroPrintf("CSV_DATA,%lld,%s,%s,%.2f,%lu,%.2f,%.2f,%.2f,%.2f,%.1f,%.1f,%.1f,%.1f,%zu,%zu",
                 iteration, model_name, quantization,
-                latency_us, min_latency, max_latency, avg_latency,
-                stddev, arena_bytes, free_heap);
+                latency_us, (unsigned long)latency_ticks,
+                min_latency, max_latency, avg_latency,
+                stddev, percentiles.p50, percentiles.p90, percentiles.p99, percentiles.p999,
+                arena_bytes, free_heap);
   }
+
+  // One line per model at the end of a sweep
+  static void LogModelSummary(int model_id,
+                              const char* model_name,
+                              const char* quantization,
+                              bool completed,
+                              float avg_latency,
+                              uint32_t avg_ticks,
+                              float min_latency,
+                              float max_latency,
+                              float stddev,
+                              const LatencyPercentiles& percentiles,
+                              size_t arena_bytes,
+                              size_t heap_used,
+                              int64_t inferences,
+                              float throughput_ips,
+                              int batch_size) {
+    if (binary_) {
+      Flush();
+      // per_sample_us is derived by the decoder
+      TelemetryFrame frame(TelemetryFrame::SUMMARY);
+      frame.Put8((uint8_t)model_id);
+      frame.Put8(completed ? 1 : 0);
+      frame.PutFloat(avg_latency);
+      frame.Put32(avg_ticks);
+      frame.PutFloat(min_latency);
+      frame.PutFloat(max_latency);
+      frame.PutFloat(stddev);
+      PutPercentiles(&frame, percentiles);
+      frame.Put32((uint32_t)arena_bytes);
+      frame.Put32((uint32_t)heap_used);
+      frame.Put32((uint32_t)inferences);
+      frame.PutFloat(throughput_ips);
+      frame.Send();
+      return;
+    }
+    // Amortized latency per sample for batched models
+    float per_sample_us = avg_latency / batch_size;
+    MicroPrintf("CSV_SUMMARY,%s,%s,%d,%.2f,%lu,%.2f,%.2f,%.2f,%.1f,%.1f,%.1f,%.1f,%zu,%zu,%lld,%.2f,%d,%.2f",
+                model_name, quantization, completed ? 1 : 0,
+                avg_latency, (unsigned long)avg_ticks, min_latency, max_latency,
+                stddev, percentiles.p50, percentiles.p90, percentiles.p99, percentiles.p999,
+                arena_bytes, heap_used, (long long)inferences, throughput_ips,
+                batch_size, per_sample_us);
+  }
+
+  // Binary mode: send the CSV_DATA samples still waiting for a full frame.
+  // Call from the task that logs inferences, or once it is idle
+  // (ResultLogger::Flush()).
+  static void Flush() {
+    if (batch_samples_ == 0) return;
+    batch_.Send();
+    batch_samples_ = 0;
+  }
+
+ private:
+  static constexpr int kBatchSamples = 8;
+  static constexpr int kSampleFields = 13;
+
+  static int64_t Fixed(float value, int scale) {
+    const double scaled = (double)value * scale;
+    return (int64_t)(scaled < 0.0 ? scaled - 0.5 : scaled + 0.5);
+  }
+
+  // Delta-code a sample into the pending INFERENCE frame, sending it first
+  // when it is full or holds another model's samples
+  static void AppendSample(int model_id, const int64_t* sample) {
+    if (batch_samples_ > 0 &&
+        (model_id != batch_model_id_ || batch_samples_ == kBatchSamples)) {
+      Flush();
+    }
+    while (true) {
+      if (batch_samples_ == 0) {
+        batch_ = TelemetryFrame(TelemetryFrame::INFERENCE);
+        batch_.Put8((uint8_t)model_id);
+        batch_model_id_ = model_id;
+        memset(batch_previous_, 0, sizeof(batch_previous_));
+      }
+      uint8_t encoded[kSampleFields * TelemetryFrame::kMaxVarintBytes];
+      size_t length = 0;
+      for (int i = 0; i < kSampleFields; i++) {
+        length += TelemetryFrame::EncodeSigned(sample[i] - batch_previous_[i],
+                                               encoded + length);
+      }
+      // A sample always fits an empty frame, so this loops at most twice
+      if (batch_.TryPutBytes(encoded, length)) break;
+      Flush();
+    }
+    memcpy(batch_previous_, sample, sizeof(batch_previous_));
+    batch_samples_++;
+  }
+
+  static void PutPercentiles(TelemetryFrame* frame, const LatencyPercentiles& percentiles) {
+    frame->PutFloat(percentiles.p50);
+    frame->PutFloat(percentiles.p90);
+    frame->PutFloat(percentiles.p99);
+    frame->PutFloat(percentiles.p999);
+  }
+
+  static inline bool binary_ = false;
+  // Pending INFERENCE frame; owned by the task that logs inferences
+  static inline TelemetryFrame batch_{TelemetryFrame::INFERENCE};
+  static inline int batch_model_id_ = 0;
+  static inline int batch_samples_ = 0;
+  static inline int64_t batch_previous_[kSampleFields] = {};
 };
 
 #endif  // CSV_LOGGER_H_
\ No newline at end of file
@@ -0,0 +1,68 @@
+#ifndef DOUBLE_BUFFER_H_
+#define DOUBLE_BUFFER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+// Lock-free single-producer/single-consumer handoff over two fixed buffers.
+//
+// The producer fills one slot while the consumer reads the other. Each slot
+// carries a `full` flag: the producer publishes with a release store after
+// writing the data, and the consumer hands the slot back with a release
+// store after it is done reading, so neither side ever takes a lock or sees
+// a half-written buffer. The Try* calls never block; callers decide how to
+// wait (busy-wait in the benchmark, to keep handoff latency minimal).
+template <size_t kCapacity>
+class DoubleBuffer {
+ public:
+  DoubleBuffer() { Reset(); }
+
+  // Only call while neither side is active
+  void Reset() {
+    for (Slot& slot : slots_) {
+      slot.full.store(false, std::memory_order_relaxed);
+    }
+    write_index_ = 0;
+    read_index_ = 0;
+  }
+
+  static constexpr size_t capacity() { return kCapacity; }
+
+  // Producer side: next empty slot, or nullptr while the consumer holds both
+  uint8_t* TryAcquireWrite() {
+    Slot& slot = slots_[write_index_];
+    return slot.full.load(std::memory_order_acquire) ? nullptr : slot.data;
+  }
+
+  // Publish the slot returned by TryAcquireWrite()
+  void CommitWrite() {
+    slots_[write_index_].full.store(true, std::memory_order_release);
+    write_index_ ^= 1;
+  }
+
+  // Consumer side: oldest filled slot, or nullptr if none is ready
+  const uint8_t* TryAcquireRead() {
+    Slot& slot = slots_[read_index_];
+    return slot.full.load(std::memory_order_acquire) ? slot.data : nullptr;
+  }
+
+  // Hand the slot returned by TryAcquireRead() back to the producer
+  void ReleaseRead() {
+    slots_[read_index_].full.store(false, std::memory_order_release);
+    read_index_ ^= 1;
+  }
+
+ private:
+  struct Slot {
+    alignas(16) uint8_t data[kCapacity];
+    std::atomic<bool> full;
+  };
+
+  Slot slots_[2];
+  int write_index_;  // Producer only
+  int read_index_;   // Consumer only
+};
+
+#endif  // DOUBLE_BUFFER_H_
@@ -0,0 +1,128 @@
+#ifndef LATENCY_HISTOGRAM_H_
+#define LATENCY_HISTOGRAM_H_
+
+#include <stdint.h>
+#include <string.h>
+
+// Tail latency summary reported alongside min/max/avg, in microseconds
+struct LatencyPercentiles {
+  float p50;
+  float p90;
+  float p99;
+  float p999;
+};
+
+// Resolution of the recorded latencies: tenths of a microsecond, so models
+// that run in a few microseconds still spread over many buckets
+constexpr uint32_t kLatencyUnitsPerUs = 10;
+
+// HDR-style log-linear histogram with fixed memory.
+//
+// Values below 2^(kSubBucketBits + 1) get one bucket each. Above that every
+// power of two is split into 2^kSubBucketBits linear sub-buckets, so the
+// relative bucket width is at most 1 / 2^kSubBucketBits. Values at or above
+// 2^kMaxValueBits land in a single overflow bucket.
+//
+// Values are kLatencyUnitsPerUs units; RecordUs() and Percentiles() convert.
+// Default <3, 24>: 177 buckets (708 bytes), exact below 1.6 us, <= 12.5%
+// bucket width up to ~1.6 s.
+template <int kSubBucketBits = 3, int kMaxValueBits = 24>
+class LatencyHistogram {
+ public:
+  static constexpr int kSubBucketCount = 1 << kSubBucketBits;
+  static constexpr int kLinearBucketCount = 2 * kSubBucketCount;
+  static constexpr int kBucketCount =
+      kSubBucketCount * (kMaxValueBits - kSubBucketBits + 1) + 1;
+  static constexpr int kOverflowBucket = kBucketCount - 1;
+
+  LatencyHistogram() { Reset(); }
+
+  void Reset() {
+    memset(counts_, 0, sizeof(counts_));
+    total_ = 0;
+    min_ = UINT32_MAX;
+    max_ = 0;
+  }
+
+  void Record(uint32_t value) {
+    counts_[BucketIndex(value)]++;
+    total_++;
+    if (value < min_) min_ = value;
+    if (value > max_) max_ = value;
+  }
+
+  // Rounded to the nearest unit; negative values count as 0
+  void RecordUs(double latency_us) {
+    double units = latency_us * kLatencyUnitsPerUs + 0.5;
+    if (units < 0.0) units = 0.0;
+    Record(units < (double)UINT32_MAX ? (uint32_t)units : UINT32_MAX);
+  }
+
+  uint32_t count() const { return total_; }
+
+  // Value at the given percentile (0..100). Returns the midpoint of the
+  // bucket holding that rank, clamped to the exact observed min/max.
+  uint32_t ValueAtPercentile(double percentile) const {
+    if (total_ == 0) return 0;
+    uint32_t rank = (uint32_t)(percentile / 100.0 * total_ + 0.5);
+    if (rank < 1) rank = 1;
+    if (rank >= total_) return max_;
+
+    uint32_t cumulative = 0;
+    for (int i = 0; i < kBucketCount; i++) {
+      cumulative += counts_[i];
+      if (cumulative >= rank) {
+        if (i == kOverflowBucket) return max_;
+        uint32_t lower = BucketLowerBound(i);
+        uint32_t value = lower + (BucketUpperBound(i) - lower) / 2;
+        if (value < min_) value = min_;
+        if (value > max_) value = max_;
+        return value;
+      }
+    }
+    return max_;
+  }
+
+  LatencyPercentiles Percentiles() const {
+    return {
+      ToUs(ValueAtPercentile(50.0)),
+      ToUs(ValueAtPercentile(90.0)),
+      ToUs(ValueAtPercentile(99.0)),
+      ToUs(ValueAtPercentile(99.9)),
+    };
+  }
+
+ private:
+  static float ToUs(uint32_t value) { return (float)value / kLatencyUnitsPerUs; }
+
+  static int BucketIndex(uint32_t value) {
+    if (value < (uint32_t)kLinearBucketCount) return (int)value;
+    if (value >= (1u << kMaxValueBits)) return kOverflowBucket;
+    int exponent = 31 - __builtin_clz(value);
+    int shift = exponent - kSubBucketBits;
+    int sub_bucket = (int)(value >> shift) - kSubBucketCount;
+    return kLinearBucketCount +
+           (exponent - kSubBucketBits - 1) * kSubBucketCount + sub_bucket;
+  }
+
+  static uint32_t BucketLowerBound(int index) {
+    if (index < kLinearBucketCount) return (uint32_t)index;
+    int offset = index - kLinearBucketCount;
+    int shift = offset / kSubBucketCount + 1;
+    uint32_t sub_bucket = (uint32_t)(offset % kSubBucketCount);
+    return (kSubBucketCount + sub_bucket) << shift;
+  }
+
+  static uint32_t BucketUpperBound(int index) {
+    if (index < kLinearBucketCount) return (uint32_t)index;
+    int shift = (index - kLinearBucketCount) / kSubBucketCount + 1;
+    return BucketLowerBound(index) + (1u << shift) - 1;
+  }
+
+  uint32_t counts_[kBucketCount];
+  uint32_t total_;
+  uint32_t min_;
+  uint32_t max_;
+};
+
+#endif  // LATENCY_HISTOGRAM_H_
@@ -0,0 +1,129 @@
+#ifndef MEMORY_TRACKER_H_
+#define MEMORY_TRACKER_H_
+
+#include <stddef.h>
+
+#include "tensorflow/lite/micro/micro_log.h"
+#include "platform.h"
+
+// Points in a model's lifecycle where memory is snapshotted
+enum class MemoryPhase {
+  BOOT,               // setup(), before any model; kept across models
+  MODEL_START,        // Before ModelSession::Begin()
+  MODEL_LOADED,       // After tflite::GetModel()
+  TENSORS_ALLOCATED,  // After AllocateTensors()
+  FIRST_INVOKE,       // After the first (cold) Invoke()
+  STEADY_STATE,       // After the last measured Invoke()
+};
+constexpr int kMemoryPhaseCount = 6;
+
+struct MemorySnapshot {
+  bool taken;
+  size_t free_heap;
+  size_t min_free_heap;       // Low-water mark since boot
+  size_t largest_free_block;
+  Platform::HeapRegionStats regions[Platform::kHeapRegionCount];
+  size_t stack_high_water;    // Least stack left to the benchmark task
+};
+
+// Phase-aware memory profiler.
+//
+// Total free heap hides the two things that fail in the field: a heap too
+// fragmented to satisfy one large allocation, and a task that came close
+// to overflowing its stack. Each snapshot therefore records the largest
+// free block and the calling task's stack high-water mark next to free and
+// minimum-ever free heap, per capability region. Snapshots walk the heap,
+// so take them outside timed sections and from the benchmark task.
+class MemoryTracker {
+ public:
+  static const char* PhaseName(MemoryPhase phase) {
+    switch (phase) {
+      case MemoryPhase::BOOT: return "boot";
+      case MemoryPhase::MODEL_START: return "model_start";
+      case MemoryPhase::MODEL_LOADED: return "model_loaded";
+      case MemoryPhase::TENSORS_ALLOCATED: return "tensors_allocated";
+      case MemoryPhase::FIRST_INVOKE: return "first_invoke";
+      case MemoryPhase::STEADY_STATE: return "steady_state";
+    }
+    return "unknown";
+  }
+
+  // Forget the per-model phases; BOOT is kept
+  void Reset() {
+    for (int i = static_cast<int>(MemoryPhase::MODEL_START); i < kMemoryPhaseCount; i++) {
+      snapshots_[i] = {};
+    }
+  }
+
+  void Snapshot(MemoryPhase phase) {
+    MemorySnapshot& snapshot = snapshots_[static_cast<int>(phase)];
+    snapshot.taken = true;
+    snapshot.free_heap = Platform::GetFreeHeapSize();
+    snapshot.min_free_heap = Platform::GetMinimumFreeHeapSize();
+    snapshot.largest_free_block = Platform::GetLargestFreeBlock();
+    for (int i = 0; i < Platform::kHeapRegionCount; i++) {
+      snapshot.regions[i] =
+          Platform::GetHeapRegionStats(static_cast<Platform::HeapRegion>(i));
+    }
+    snapshot.stack_high_water = Platform::GetStackHighWaterMark();
+  }
+
+  const MemorySnapshot& Get(MemoryPhase phase) const {
+    return snapshots_[static_cast<int>(phase)];
+  }
+
+  // Drop in free heap from one phase to a later one; 0 if either is missing
+  // or the heap grew
+  size_t HeapUsed(MemoryPhase from, MemoryPhase to) const {
+    const MemorySnapshot& before = Get(from);
+    const MemorySnapshot& after = Get(to);
+    if (!before.taken || !after.taken || after.free_heap > before.free_heap) {
+      return 0;
+    }
+    return before.free_heap - after.free_heap;
+  }
+
+  // Share of free heap not reachable as one block, in percent
+  static float FragmentationPct(const MemorySnapshot& snapshot) {
+    if (snapshot.free_heap == 0) return 0.0f;
+    return 100.0f * (1.0f - (float)snapshot.largest_free_block / snapshot.free_heap);
+  }
+
+  void Print() const {
+    MicroPrintf("Memory by phase (free / min free / largest block / frag / stack hwm):");
+    for (int i = 0; i < kMemoryPhaseCount; i++) {
+      const MemorySnapshot& snapshot = snapshots_[i];
+      if (!snapshot.taken) continue;
+      MicroPrintf("  %-17s %7zu / %7zu / %7zu B / %5.1f%% / %zu B",
+                  PhaseName(static_cast<MemoryPhase>(i)), snapshot.free_heap,
+                  snapshot.min_free_heap, snapshot.largest_free_block,
+                  FragmentationPct(snapshot), snapshot.stack_high_water);
+    }
+  }
+
+  static void PrintCsvHeader() {
+    MicroPrintf("CSV_MEMORY_HEADER,model_name,quantization,phase,free_heap,min_free_heap,largest_free_block,fragmentation_pct,internal_free,internal_largest,dma_free,dma_largest,psram_free,psram_largest,stack_high_water");
+  }
+
+  // One CSV_MEMORY line per phase captured for this model
+  void PrintCsv(const char* model_name, const char* quantization) const {
+    for (int i = 0; i < kMemoryPhaseCount; i++) {
+      const MemorySnapshot& snapshot = snapshots_[i];
+      if (!snapshot.taken) continue;
+      const Platform::HeapRegionStats* regions = snapshot.regions;
+      MicroPrintf("CSV_MEMORY,%s,%s,%s,%zu,%zu,%zu,%.1f,%zu,%zu,%zu,%zu,%zu,%zu,%zu",
+                  model_name, quantization, PhaseName(static_cast<MemoryPhase>(i)),
+                  snapshot.free_heap, snapshot.min_free_heap,
+                  snapshot.largest_free_block, FragmentationPct(snapshot),
+                  regions[0].free, regions[0].largest_free_block,
+                  regions[1].free, regions[1].largest_free_block,
+                  regions[2].free, regions[2].largest_free_block,
+                  snapshot.stack_high_water);
+    }
+  }
+
+ private:
+  MemorySnapshot snapshots_[kMemoryPhaseCount] = {};
+};
+
+#endif  // MEMORY_TRACKER_H_
@@ -0,0 +1,114 @@
+#ifndef OP_PROFILER_H_
+#define OP_PROFILER_H_
+
+#include <stdint.h>
+
+#include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/micro/micro_profiler_interface.h"
+
+#include "bench_timer.h"
+
+// Per-operator latency profiler attached to the MicroInterpreter.
+//
+// The interpreter emits one BeginEvent/EndEvent pair per node in execution
+// order, tagged with the op name (CONV_2D, FULLY_CONNECTED, ...). Events are
+// matched to graph positions by their order within an invocation, so the
+// harness must call BeginInvoke() before every Invoke(). BenchTimer ticks
+// (overhead-corrected) for each position are aggregated across the run.
+class OpProfiler : public tflite::MicroProfilerInterface {
+ public:
+  static constexpr int kMaxOps = 32;
+
+  OpProfiler() { Reset(); }
+
+  // Clear aggregated statistics (e.g. after warmup)
+  void Reset() {
+    for (int i = 0; i < kMaxOps; i++) {
+      ops_[i] = {};
+    }
+    op_count_ = 0;
+    cursor_ = 0;
+    dropped_events_ = 0;
+  }
+
+  // Rewind the event cursor at the start of an invocation
+  void BeginInvoke() { cursor_ = 0; }
+
+  uint32_t BeginEvent(const char* tag) override {
+    int index = cursor_++;
+    if (index >= kMaxOps) {
+      dropped_events_++;
+      return kMaxOps;
+    }
+    if (index >= op_count_) op_count_ = index + 1;
+    ops_[index].tag = tag;
+    ops_[index].start_ticks = BenchTimer::Now();
+    return (uint32_t)index;
+  }
+
+  void EndEvent(uint32_t event_handle) override {
+    BenchTimer::Ticks end_ticks = BenchTimer::Now();
+    if (event_handle >= (uint32_t)kMaxOps) return;
+    OpStats& op = ops_[event_handle];
+    uint32_t ticks = (uint32_t)BenchTimer::Elapsed(op.start_ticks, end_ticks);
+    op.total_ticks += ticks;
+    if (op.invocations == 0 || ticks < op.min_ticks) op.min_ticks = ticks;
+    if (ticks > op.max_ticks) op.max_ticks = ticks;
+    op.invocations++;
+  }
+
+  int op_count() const { return op_count_; }
+  // Op name and overhead-corrected mean time of one graph node
+  const char* tag(int node) const { return ops_[node].tag; }
+  double avg_us(int node) const {
+    const OpStats& op = ops_[node];
+    if (op.invocations == 0) return 0.0;
+    return (double)op.total_ticks / op.invocations / BenchTimer::ticks_per_us();
+  }
+
+  static void PrintCsvHeader() {
+    MicroPrintf("CSV_OP_HEADER,model_name,quantization,node,op,invocations,total_ticks,avg_us,min_us,max_us,share_pct");
+  }
+
+  // One CSV_OP line per graph node, in execution order
+  void PrintCsv(const char* model_name, const char* quantization) const {
+    uint64_t all_ticks = 0;
+    for (int i = 0; i < op_count_; i++) {
+      all_ticks += ops_[i].total_ticks;
+    }
+    const float us_per_tick = (float)(1.0 / BenchTimer::ticks_per_us());
+
+    for (int i = 0; i < op_count_; i++) {
+      const OpStats& op = ops_[i];
+      if (op.invocations == 0) continue;
+      float avg_us = (float)op.total_ticks / op.invocations * us_per_tick;
+      float share = (all_ticks > 0) ? 100.0f * op.total_ticks / all_ticks : 0.0f;
+      MicroPrintf("CSV_OP,%s,%s,%d,%s,%lu,%llu,%.2f,%.2f,%.2f,%.1f",
+                  model_name, quantization, i, op.tag,
+                  (unsigned long)op.invocations,
+                  (unsigned long long)op.total_ticks, avg_us,
+                  op.min_ticks * us_per_tick, op.max_ticks * us_per_tick, share);
+    }
+    if (dropped_events_ > 0) {
+      MicroPrintf("Op profiler: %lu events beyond %d ops per invoke dropped",
+                  (unsigned long)dropped_events_, kMaxOps);
+    }
+  }
+
+ private:
+  struct OpStats {
+    const char* tag;
+    BenchTimer::Ticks start_ticks;
+    uint64_t total_ticks;
+    uint32_t min_ticks;
+    uint32_t max_ticks;
+    uint32_t invocations;
+  };
+
+  OpStats ops_[kMaxOps];
+  int op_count_;
+  int cursor_;
+  uint32_t dropped_events_;
+};
+
+#endif  // OP_PROFILER_H_
@@ -2,24 +2,58 @@
 #define OUTPUT_HANDLER_H_
 
 #include "tensorflow/lite/micro/micro_log.h"
-#include "esp_system.h"
+#include "platform.h"
+#include "latency_histogram.h"
 
 // Simple output handler for benchmarking results
 class OutputHandler {
  public:
   static void PrintBenchmarkResult(const char* model_name, 
-                                  int64_t average_latency_us,
+                                  float average_latency_us,
+                                  const LatencyPercentiles& percentiles,
                                   size_t memory_usage) {
     MicroPrintf("BENCHMARK: %s", model_name);
-    MicroPrintf("  Average latency: %lld us", average_latency_us);
+    MicroPrintf("  Average latency: %.2f us", average_latency_us);
+    MicroPrintf("  Percentiles: p50=%.1f us, p90=%.1f us, p99=%.1f us, p99.9=%.1f us",
+                percentiles.p50, percentiles.p90, percentiles.p99, percentiles.p999);
     MicroPrintf("  Memory usage: %zu bytes", memory_usage);
     MicroPrintf("  ---");
   }
+
+  static void PrintModelSummary(const char* model_name,
+                                const char* quantization,
+                                bool completed,
+                                float average_latency_us,
+                                float min_latency_us,
+                                float max_latency_us,
+                                float stddev_us,
+                                const LatencyPercentiles& percentiles,
+                                size_t memory_usage,
+                                float throughput_ips,
+                                int batch_size) {
+    if (!completed) {
+      MicroPrintf("SUMMARY: %s (%s) - skipped", model_name, quantization);
+      return;
+    }
+    MicroPrintf("SUMMARY: %s (%s) avg=%.2f us, min=%.2f us, max=%.2f us, stddev=%.2f us, p99=%.1f us, arena=%zu bytes",
+                model_name, quantization, average_latency_us,
+                min_latency_us, max_latency_us, stddev_us,
+                percentiles.p99, memory_usage);
+    if (batch_size > 1) {
+      // Buffering a batch delays the first sample by batch_size - 1 periods
+      MicroPrintf("  batch=%d, per-sample=%.2f us amortized", batch_size,
+                  average_latency_us / batch_size);
+    }
+    if (throughput_ips > 0.0f) {
+      MicroPrintf("  throughput=%.2f inferences/s", throughput_ips);
+    }
+  }
   
   static void PrintSystemInfo() {
     MicroPrintf("System Info:");
-    MicroPrintf("  Free Heap: %zu bytes", esp_get_free_heap_size());
-    MicroPrintf("  Minimum Free Heap: %zu bytes", esp_get_minimum_free_heap_size());
+    MicroPrintf("  Platform: %s", Platform::GetName());
+    MicroPrintf("  Free Heap: %zu bytes", Platform::GetFreeHeapSize());
+    MicroPrintf("  Minimum Free Heap: %zu bytes", Platform::GetMinimumFreeHeapSize());
   }
 };
 
@@ -0,0 +1,138 @@
+#ifndef RESULT_LOGGER_H_
+#define RESULT_LOGGER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+#include "tensorflow/lite/micro/micro_log.h"
+#include "csv_logger.h"
+#include "latency_histogram.h"
+#include "output_handler.h"
+#include "platform.h"
+#include "spsc_ring.h"
+
+// One periodic progress report of the LATENCY loop, captured as plain
+// values so it can be formatted later, away from the timed inferences
+struct InferenceRecord {
+  int model_id;              // ModelType index
+  int64_t iteration;
+  const char* model_name;    // Registry strings, valid for the whole run
+  const char* quantization;
+  float latency_us;
+  uint32_t latency_ticks;
+  float min_us;
+  float max_us;
+  float avg_us;
+  float stddev_us;
+  LatencyPercentiles percentiles;
+  size_t arena_bytes;
+  size_t free_heap;
+  // Sliding-window summary, attached to every 100th inference
+  int window_count;  // 0 when absent
+  float window_avg_us;
+  float window_stddev_us;
+};
+
+// Defers serial output of InferenceRecords off the benchmark task.
+//
+// The benchmark loop only copies a record into a lock-free SPSC ring; a
+// low-priority task drains it and does the MicroPrintf formatting, so UART
+// time and its interrupts no longer sit between timed inferences. Without
+// the task (not started, or it failed to start) records wait in the ring
+// until Flush() prints them on the caller after the run. A full ring drops
+// the record rather than block; drops are counted and reported by Flush().
+template <size_t kCapacity>
+class ResultLogger {
+ public:
+  // Start the drain task on `core`, just above idle priority
+  bool StartTask(int core) {
+    task_running_ = Platform::StartTask("result_logger", TaskMain, this, core,
+                                        /*low_priority=*/true);
+    return task_running_;
+  }
+
+  bool task_running() const { return task_running_; }
+
+  // Producer side, called from the benchmark loop; never blocks
+  void Log(const InferenceRecord& record) {
+    if (ring_.TryPush(record)) {
+      logged_++;
+    } else {
+      dropped_++;
+    }
+  }
+
+  // Producer side: return once every logged record has been printed
+  void Flush() {
+    if (task_running_) {
+      while (printed_.load(std::memory_order_acquire) != logged_) {
+        Platform::DelayMs(kPollMs);
+      }
+    } else {
+      Drain();
+    }
+    if (dropped_ > 0) {
+      MicroPrintf("Result log ring full: %lu records dropped",
+                  (unsigned long)dropped_);
+      dropped_ = 0;
+    }
+  }
+
+  // Format one record exactly like the synchronous LATENCY loop output
+  // (binary telemetry drops the human-readable lines that repeat CSV_DATA)
+  static void Print(const InferenceRecord& record) {
+    if (!CSVLogger::binary()) {
+      MicroPrintf("=== Iteration %lld ===", (long long)record.iteration);
+      MicroPrintf("Latency: cur=%.2f us (%lu ticks), avg=%.2f us, min=%.2f us, max=%.2f us, stddev=%.2f us",
+                  record.latency_us, (unsigned long)record.latency_ticks,
+                  record.avg_us, record.min_us, record.max_us, record.stddev_us);
+    }
+    CSVLogger::LogInference(
+        record.model_id, record.iteration, record.model_name, record.quantization,
+        record.latency_us, record.latency_ticks, record.min_us, record.max_us,
+        record.avg_us, record.stddev_us, record.percentiles,
+        record.arena_bytes, record.free_heap);
+    if (!CSVLogger::binary()) {
+      MicroPrintf("");
+    }
+
+    if (record.window_count > 0) {
+      OutputHandler::PrintBenchmarkResult(record.model_name, record.avg_us,
+                                          record.percentiles, record.arena_bytes);
+      MicroPrintf("Statistics over last %d inferences:", record.window_count);
+      MicroPrintf("  Avg: %.2f us, StdDev: %.2f us (all-time min: %.2f us, max: %.2f us)",
+                  record.window_avg_us, record.window_stddev_us,
+                  record.min_us, record.max_us);
+    }
+  }
+
+ private:
+  static constexpr uint32_t kPollMs = 10;
+
+  // Consumer side: print everything currently in the ring
+  void Drain() {
+    InferenceRecord record;
+    while (ring_.TryPop(&record)) {
+      Print(record);
+      printed_.fetch_add(1, std::memory_order_release);
+    }
+  }
+
+  static void TaskMain(void* arg) {
+    ResultLogger* logger = static_cast<ResultLogger*>(arg);
+    while (true) {
+      logger->Drain();
+      Platform::DelayMs(kPollMs);
+    }
+  }
+
+  SpscRing<InferenceRecord, kCapacity> ring_;
+  bool task_running_ = false;
+  uint32_t logged_ = 0;   // Producer only
+  uint32_t dropped_ = 0;  // Producer only
+  std::atomic<uint32_t> printed_{0};
+};
+
+#endif  // RESULT_LOGGER_H_
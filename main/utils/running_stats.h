@@ -0,0 +1,101 @@
+#ifndef RUNNING_STATS_H_
+#define RUNNING_STATS_H_
+
+#include <math.h>
+#include <stdint.h>
+
+// Streaming statistics using Welford's online algorithm.
+// O(1) time and memory per sample, so it can run for millions of
+// iterations without recomputing anything over a history buffer.
+class RunningStats {
+ public:
+  RunningStats() { Reset(); }
+
+  void Reset() {
+    count_ = 0;
+    mean_ = 0.0;
+    m2_ = 0.0;
+    min_ = 0.0;
+    max_ = 0.0;
+  }
+
+  void Add(double value) {
+    count_++;
+    double delta = value - mean_;
+    mean_ += delta / count_;
+    m2_ += delta * (value - mean_);
+    if (count_ == 1 || value < min_) min_ = value;
+    if (count_ == 1 || value > max_) max_ = value;
+  }
+
+  int64_t count() const { return count_; }
+  double mean() const { return mean_; }
+  double min() const { return min_; }
+  double max() const { return max_; }
+
+  // Sample variance (n - 1 denominator)
+  double variance() const {
+    return (count_ > 1) ? m2_ / (count_ - 1) : 0.0;
+  }
+  double stddev() const { return sqrt(variance()); }
+
+ private:
+  int64_t count_;
+  double mean_;
+  double m2_;  // Sum of squared differences from the current mean
+  double min_;
+  double max_;
+};
+
+// Mean/variance over the last kWindowSize samples.
+// Once the window is full each new sample replaces the oldest one and the
+// running mean and M2 are updated in O(1) instead of rescanning the window.
+template <int kWindowSize>
+class WindowedStats {
+ public:
+  WindowedStats() { Reset(); }
+
+  void Reset() {
+    count_ = 0;
+    next_ = 0;
+    mean_ = 0.0;
+    m2_ = 0.0;
+  }
+
+  void Add(double value) {
+    if (count_ < kWindowSize) {
+      // Window still filling: plain Welford update
+      count_++;
+      double delta = value - mean_;
+      mean_ += delta / count_;
+      m2_ += delta * (value - mean_);
+    } else {
+      // Replace the oldest sample, keeping n fixed
+      double old_value = samples_[next_];
+      double old_mean = mean_;
+      double delta = value - old_value;
+      mean_ += delta / kWindowSize;
+      m2_ += delta * (value - mean_ + old_value - old_mean);
+      if (m2_ < 0.0) m2_ = 0.0;  // Guard against rounding drift
+    }
+    samples_[next_] = value;
+    next_ = (next_ + 1) % kWindowSize;
+  }
+
+  int count() const { return count_; }
+  double mean() const { return mean_; }
+
+  double variance() const {
+    return (count_ > 1) ? m2_ / (count_ - 1) : 0.0;
+  }
+  double stddev() const { return sqrt(variance()); }
+
+ private:
+  double samples_[kWindowSize];
+  int count_;
+  int next_;
+  double mean_;
+  double m2_;
+};
+
+#endif  // RUNNING_STATS_H_
@@ -0,0 +1,69 @@
+#ifndef SPSC_RING_H_
+#define SPSC_RING_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+// Lock-free single-producer/single-consumer ring of fixed-size records.
+//
+// The producer owns head_, the consumer owns tail_; each side only reads
+// the other's index. A record is published by the release store of head_
+// after it has been copied in and handed back by the release store of
+// tail_ after it has been copied out, so neither side takes a lock. Both
+// calls return immediately: a full ring makes TryPush() fail instead of
+// waiting, which keeps a timing loop on the producer side free of stalls.
+// kCapacity must be a power of two.
+template <typename T, size_t kCapacity>
+class SpscRing {
+  static_assert(kCapacity > 0 && (kCapacity & (kCapacity - 1)) == 0,
+                "SpscRing capacity must be a power of two");
+
+ public:
+  SpscRing() { Reset(); }
+
+  // Only call while neither side is active
+  void Reset() {
+    head_.store(0, std::memory_order_relaxed);
+    tail_.store(0, std::memory_order_relaxed);
+  }
+
+  static constexpr size_t capacity() { return kCapacity; }
+
+  // Producer side: copy `record` in; false if the ring is full
+  bool TryPush(const T& record) {
+    const uint32_t head = head_.load(std::memory_order_relaxed);
+    if (head - tail_.load(std::memory_order_acquire) == kCapacity) {
+      return false;
+    }
+    records_[head & (kCapacity - 1)] = record;
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side: copy the oldest record out; false if the ring is empty
+  bool TryPop(T* record) {
+    const uint32_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail == head_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    *record = records_[tail & (kCapacity - 1)];
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Either side; exact only when called by the consumer
+  bool empty() const {
+    return head_.load(std::memory_order_acquire) ==
+           tail_.load(std::memory_order_acquire);
+  }
+
+ private:
+  T records_[kCapacity];
+  // Free-running indices; unsigned wraparound keeps head - tail correct
+  std::atomic<uint32_t> head_;
+  std::atomic<uint32_t> tail_;
+};
+
+#endif  // SPSC_RING_H_
@@ -0,0 +1,147 @@
+#ifndef TELEMETRY_FRAME_H_
+#define TELEMETRY_FRAME_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <atomic>
+
+#include "platform.h"
+
+// Framed binary record for CSVLogger's binary mode, decoded on the host by
+// scripts/decode_telemetry.py.
+//
+// Frame, before byte stuffing:
+//   version u8 | type u8 | sequence u16 | payload | crc16 (CCITT-FALSE)
+// Fields are little-endian and fixed width, floats IEEE-754 binary32,
+// except INFERENCE samples, which are zigzag LEB128 varints (EncodeSigned).
+// The CRC covers everything from version to the end of the payload; the
+// sequence number is taken when the frame is sent.
+//
+// On the wire each frame sits between 0x7E flag bytes. 0x7E, 0x7D, '\n' and
+// '\r' inside the frame are sent as 0x7D, byte ^ 0x20 (HDLC style), so
+// frames survive console newline translation and can be picked out of a
+// capture that also holds ordinary text lines.
+class TelemetryFrame {
+ public:
+  // 2: float percentiles; 3: several delta-coded samples per INFERENCE
+  static constexpr uint8_t kVersion = 3;
+  static constexpr size_t kMaxVarintBytes = 10;
+
+  enum Type : uint8_t {
+    SESSION = 1,    // Timer backend; once per boot
+    MODEL = 2,      // Model id -> name/quantization; once per registry entry
+    INFERENCE = 3,  // CSV_DATA equivalent, a batch of samples of one model
+    SUMMARY = 4,    // CSV_SUMMARY equivalent
+  };
+
+  explicit TelemetryFrame(Type type) {
+    Put8(kVersion);
+    Put8(type);
+    Put16(0);  // Sequence, filled in by Send()
+  }
+
+  void Put8(uint8_t value) { PutBytes(&value, 1); }
+  void Put16(uint16_t value) {
+    uint8_t bytes[2] = {(uint8_t)value, (uint8_t)(value >> 8)};
+    PutBytes(bytes, 2);
+  }
+  void Put32(uint32_t value) {
+    uint8_t bytes[4] = {(uint8_t)value, (uint8_t)(value >> 8),
+                        (uint8_t)(value >> 16), (uint8_t)(value >> 24)};
+    PutBytes(bytes, 4);
+  }
+  void PutFloat(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    Put32(bits);
+  }
+  // u8 length prefix, truncated to kMaxStringBytes, no terminator
+  void PutString(const char* value) {
+    size_t length = strlen(value);
+    if (length > kMaxStringBytes) length = kMaxStringBytes;
+    Put8((uint8_t)length);
+    PutBytes(value, length);
+  }
+
+  // Append the whole run or, if it would not fit, nothing
+  bool TryPutBytes(const void* bytes, size_t count) {
+    if (length_ + count > kMaxFrameBytes - 2) return false;
+    PutBytes(bytes, count);
+    return true;
+  }
+
+  // LEB128 into `out` (at most kMaxVarintBytes); returns the length
+  static size_t EncodeVarint(uint64_t value, uint8_t* out) {
+    size_t length = 0;
+    while (value >= 0x80) {
+      out[length++] = (uint8_t)(value | 0x80);
+      value >>= 7;
+    }
+    out[length++] = (uint8_t)value;
+    return length;
+  }
+  // Zigzag first, so small negative deltas stay one byte too
+  static size_t EncodeSigned(int64_t value, uint8_t* out) {
+    return EncodeVarint(((uint64_t)value << 1) ^ (uint64_t)(value >> 63), out);
+  }
+
+  // Append the CRC, stuff and write the frame in one Platform::WriteBytes()
+  void Send() {
+    const uint16_t sequence = next_sequence_.fetch_add(1, std::memory_order_relaxed);
+    data_[2] = (uint8_t)sequence;
+    data_[3] = (uint8_t)(sequence >> 8);
+    const uint16_t crc = Crc16(data_, length_);
+    data_[length_++] = (uint8_t)crc;
+    data_[length_++] = (uint8_t)(crc >> 8);
+    uint8_t wire[2 * kMaxFrameBytes + 2];
+    size_t out = 0;
+    wire[out++] = kFlag;
+    for (size_t i = 0; i < length_; i++) {
+      uint8_t byte = data_[i];
+      if (byte == kFlag || byte == kEscape || byte == '\n' || byte == '\r') {
+        wire[out++] = kEscape;
+        byte ^= 0x20;
+      }
+      wire[out++] = byte;
+    }
+    wire[out++] = kFlag;
+    Platform::WriteBytes(wire, out);
+  }
+
+  static uint16_t Crc16(const uint8_t* data, size_t length) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < length; i++) {
+      crc ^= (uint16_t)data[i] << 8;
+      for (int bit = 0; bit < 8; bit++) {
+        crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+      }
+    }
+    return crc;
+  }
+
+ private:
+  static constexpr uint8_t kFlag = 0x7E;
+  static constexpr uint8_t kEscape = 0x7D;
+  // Room for a MODEL frame with two full strings (137 bytes) and for a
+  // batch of INFERENCE samples; a frame plus its wire buffer take about
+  // 500 bytes of the sending task's stack
+  static constexpr size_t kMaxStringBytes = 63;
+  static constexpr size_t kMaxFrameBytes = 160;
+  static_assert(kMaxFrameBytes >= 4 + 1 + 2 + 2 * (1 + kMaxStringBytes) + 2,
+                "a MODEL frame must fit");
+
+  void PutBytes(const void* bytes, size_t count) {
+    if (length_ + count > kMaxFrameBytes - 2) return;  // Keep room for the CRC
+    memcpy(data_ + length_, bytes, count);
+    length_ += count;
+  }
+
+  uint8_t data_[kMaxFrameBytes];
+  size_t length_ = 0;
+  // Lets the decoder spot lost frames; wraps at 65536
+  static inline std::atomic<uint16_t> next_sequence_{0};
+};
+
+#endif  // TELEMETRY_FRAME_H_
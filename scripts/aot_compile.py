@@ -0,0 +1,538 @@
+"""Compile TFLite models ahead of time into straight-line C++.
+
+The interpreter path parses the flatbuffer, plans the arena, resolves ops
+and runs Prepare() for every op on each Begin(), then dispatches every op
+through its registration on each Invoke(). This script does all of that at
+build time instead: for each model it emits one function that calls the
+TFLite Micro reference kernels directly, in graph order, with
+
+- weights and biases as typed constant arrays,
+- every kernel's params (padding, strides, activation clamps, fixed-point
+  multipliers and shifts) computed here the way the kernels' Prepare()
+  computes them, so results match the interpreter's reference kernels,
+- activations at fixed offsets of one static arena, placed with the
+  offline planner of convert_model.py (RESHAPE outputs alias their input;
+  the graph input and output are the caller's buffers).
+
+Supported: FULLY_CONNECTED, CONV_2D, MAX_POOL_2D, RESHAPE and SOFTMAX on
+float32 or int8 models. Other models get a null function and the reason in
+the header instead of failing the build.
+
+Build time (main/CMakeLists.txt), from the same model arrays as the op
+resolvers:
+
+    python aot_compile.py --output generated/aot_models.cpp model.cpp...
+
+A .tflite works too (e.g. from models_source/); the function is then named
+after the file.
+"""
+
+import argparse
+import math
+import os
+import struct
+import sys
+
+from convert_model import PlanError, check_plan, optimize, planned_buffers
+from generate_op_resolvers import cpp_identifier
+from tflite_flatbuffer import read_c_array, Model
+
+ACTIVATIONS = {0: 'NONE', 1: 'RELU', 2: 'RELU_N1_TO_1', 3: 'RELU6'}
+PADDING_SAME, PADDING_VALID = 0, 1
+SOFTMAX_INTEGER_BITS = 5  # kScaledDiffIntegerBits of the softmax kernel
+INT8_MIN, INT8_MAX = -128, 127
+C_TYPES = {'FLOAT32': 'float', 'INT8': 'int8_t', 'INT32': 'int32_t'}
+
+
+class AotError(Exception):
+    pass
+
+
+def f32(value):
+    """Round a Python float to float32, as the C++ float arithmetic does."""
+    return struct.unpack('<f', struct.pack('<f', value))[0]
+
+
+def tflite_round(value):
+    """TfLiteRound / std::round: halves away from zero."""
+    return int(math.floor(abs(value) + 0.5)) * (1 if value >= 0 else -1)
+
+
+def quantize_multiplier(real):
+    """(multiplier, shift) like tflite::QuantizeMultiplier()."""
+    if real == 0.0:
+        return 0, 0
+    q, shift = math.frexp(real)
+    q_fixed = tflite_round(q * (1 << 31))
+    if q_fixed == (1 << 31):
+        q_fixed //= 2
+        shift += 1
+    if shift < -31:
+        shift, q_fixed = 0, 0
+    if shift > 30:
+        shift, q_fixed = 30, (1 << 31) - 1
+    return q_fixed, shift
+
+
+def float_literal(value):
+    if math.isinf(value) or math.isnan(value):
+        raise AotError('non-finite constant')
+    text = '%.9g' % value
+    if '.' not in text and 'e' not in text:
+        text += '.0'
+    return text + 'f'
+
+
+def out_size(padding, image, filter_size, stride, dilation):
+    effective = (filter_size - 1) * dilation + 1
+    if padding == PADDING_SAME:
+        return (image + stride - 1) // stride
+    return (image + stride - effective) // stride
+
+
+def padding_with_offset(stride, dilation, in_size, filter_size, output):
+    """(padding, offset) like tflite::ComputePaddingWithOffset()."""
+    effective = (filter_size - 1) * dilation + 1
+    total = max((output - 1) * stride + effective - in_size, 0)
+    return total // 2, total % 2
+
+
+class Compiler:
+    """Code for one model; raises AotError when it cannot be compiled."""
+
+    def __init__(self, model, namespace):
+        self.model = model
+        self.namespace = namespace
+        subgraphs = model.subgraphs()
+        if len(subgraphs) != 1:
+            raise AotError('%d subgraphs' % len(subgraphs))
+        self.subgraph = subgraphs[0]
+        self.tensors = self.subgraph.tensors()
+        self.codes = model.operator_codes()
+        self.operators = self.subgraph.operators()
+        self.op_tables = model.root.tables(2)[0].tables(3)
+        if len(self.subgraph.inputs()) != 1 or len(self.subgraph.outputs()) != 1:
+            raise AotError('only one input and one output are supported')
+        self.input = self.subgraph.inputs()[0]
+        self.output = self.subgraph.outputs()[0]
+        self.dtype = self.tensors[self.input]['type']
+        if self.dtype not in ('FLOAT32', 'INT8'):
+            raise AotError('%s input' % self.dtype)
+        self.constants = []   # Declarations in the model namespace
+        self.calls = []       # Statements of the function body
+        self.emitted_shapes = set()
+        self.emitted_data = set()
+
+    # Tensors ------------------------------------------------------------
+
+    def is_constant(self, index):
+        return bool(self.model.buffer_data(self.tensors[index]['buffer']))
+
+    def tensor_type(self, index, *allowed):
+        tensor_type = self.tensors[index]['type']
+        if tensor_type not in allowed:
+            raise AotError('tensor %d is %s' % (index, tensor_type))
+        return tensor_type
+
+    def quantization(self, index):
+        tensor = self.tensors[index]
+        if not tensor['scale']:
+            raise AotError('tensor %d is not quantized' % index)
+        return tensor['scale'], tensor['zero_point']
+
+    def shape(self, index):
+        name = 'kShape%d' % index
+        if index not in self.emitted_shapes:
+            self.emitted_shapes.add(index)
+            dims = ', '.join(str(d) for d in self.tensors[index]['shape'])
+            self.constants.append('const tflite::RuntimeShape %s({%s});' % (name, dims))
+        return name
+
+    def data(self, index):
+        """Name of the constant array holding a weight or bias tensor."""
+        name = 'kTensor%d' % index
+        if index in self.emitted_data:
+            return name
+        self.emitted_data.add(index)
+        tensor = self.tensors[index]
+        raw = self.model.buffer_data(tensor['buffer'])
+        tensor_type = self.tensor_type(index, *C_TYPES)
+        fmt = {'FLOAT32': 'f', 'INT8': 'b', 'INT32': 'i'}[tensor_type]
+        values = struct.unpack('<%d%s' % (len(raw) // struct.calcsize(fmt), fmt), raw)
+        text = [float_literal(v) for v in values] if fmt == 'f' else [str(v) for v in values]
+        per_line = 8 if fmt == 'f' else 16
+        lines = ['    %s,' % ', '.join(text[i:i + per_line])
+                 for i in range(0, len(text), per_line)]
+        self.constants.append('// %s\nalignas(16) const %s %s[%d] = {\n%s\n};' % (
+            tensor['name'], C_TYPES[tensor_type], name, len(values), '\n'.join(lines)))
+        return name
+
+    def bias(self, inputs):
+        if len(inputs) < 3 or inputs[2] < 0:
+            bias_type = 'float' if self.dtype == 'FLOAT32' else 'int32_t'
+            return 'tflite::RuntimeShape()', 'static_cast<const %s*>(nullptr)' % bias_type
+        if not self.is_constant(inputs[2]):
+            raise AotError('non-constant bias')
+        self.tensor_type(inputs[2], 'FLOAT32' if self.dtype == 'FLOAT32' else 'INT32')
+        return self.shape(inputs[2]), self.data(inputs[2])
+
+    def weights(self, index):
+        if not self.is_constant(index):
+            raise AotError('non-constant weights')
+        self.tensor_type(index, self.dtype)
+        return self.shape(index), self.data(index)
+
+    # Params -------------------------------------------------------------
+
+    def activation(self, code):
+        if code not in ACTIVATIONS:
+            raise AotError('fused activation %d' % code)
+        return ACTIVATIONS[code]
+
+    def float_range(self, activation):
+        low = 'std::numeric_limits<float>::lowest()'
+        high = 'std::numeric_limits<float>::max()'
+        return {'NONE': (low, high), 'RELU': ('0.0f', high),
+                'RELU_N1_TO_1': ('-1.0f', '1.0f'), 'RELU6': ('0.0f', '6.0f')}[activation]
+
+    def quantized_range(self, activation, output):
+        """CalculateActivationRangeQuantized() for an int8 output."""
+        scales, zero_points = self.quantization(output)
+        scale, zero_point = scales[0], zero_points[0]
+
+        def quantize(value):
+            return zero_point + tflite_round(f32(value / scale))
+        if activation == 'RELU':
+            return max(INT8_MIN, quantize(0.0)), INT8_MAX
+        if activation == 'RELU6':
+            return max(INT8_MIN, quantize(0.0)), min(INT8_MAX, quantize(6.0))
+        if activation == 'RELU_N1_TO_1':
+            return max(INT8_MIN, quantize(-1.0)), min(INT8_MAX, quantize(1.0))
+        return INT8_MIN, INT8_MAX
+
+    def range_fields(self, activation, output):
+        if self.dtype == 'FLOAT32':
+            low, high = self.float_range(activation)
+            return [('float_activation_min', low), ('float_activation_max', high)]
+        low, high = self.quantized_range(activation, output)
+        return [('quantized_activation_min', low), ('quantized_activation_max', high)]
+
+    def params(self, op_index, struct_name, fields):
+        name = 'kOp%dParams' % op_index
+        lines = ['const tflite::%s %s = [] {' % (struct_name, name),
+                 '  tflite::%s params = {};' % struct_name]
+        lines += ['  params.%s = %s;' % (field, value) for field, value in fields]
+        lines += ['  return params;', '}();']
+        self.constants.append('\n'.join(lines))
+        return name
+
+    def per_channel(self, op_index, multipliers, shifts, shift_type):
+        self.constants.append(
+            'const int32_t kOp%dMultipliers[%d] = {%s};\nconst %s kOp%dShifts[%d] = {%s};' % (
+                op_index, len(multipliers), ', '.join(str(m) for m in multipliers),
+                shift_type, op_index, len(shifts), ', '.join(str(s) for s in shifts)))
+        return 'kOp%dMultipliers' % op_index, 'kOp%dShifts' % op_index
+
+    def channel_multipliers(self, input_index, filter_index, output_index):
+        """PopulateConvolutionQuantizationParams(): one per output channel."""
+        input_scale = self.quantization(input_index)[0][0]
+        output_scale = self.quantization(output_index)[0][0]
+        filter_scales = self.quantization(filter_index)[0]
+        channels = self.tensors[filter_index]['shape'][0]
+        if len(filter_scales) not in (1, channels):
+            raise AotError('filter quantized along an unexpected axis')
+        pairs = [quantize_multiplier(input_scale * filter_scales[min(i, len(filter_scales) - 1)]
+                                     / output_scale) for i in range(channels)]
+        return [m for m, _ in pairs], [s for _, s in pairs]
+
+    # Ops ----------------------------------------------------------------
+
+    def fully_connected(self, op_index, op, options):
+        inputs, output = op['inputs'], op['outputs'][0]
+        activation = self.activation(options.scalar(0, 'b'))
+        if options.scalar(1, 'b') != 0:
+            raise AotError('shuffled FULLY_CONNECTED weights')
+        filter_shape, filter_data = self.weights(inputs[1])
+        bias_shape, bias_data = self.bias(inputs)
+        fields = self.range_fields(activation, output)
+        args = [self.shape(inputs[0]), self.ptr(inputs[0]), filter_shape, filter_data,
+                bias_shape, bias_data, self.shape(output), self.ptr(output)]
+        if self.dtype == 'FLOAT32':
+            params = self.params(op_index, 'FullyConnectedParams', fields)
+            self.call('tflite::reference_ops::FullyConnected', [params] + args)
+            return
+        fields += self.zero_point_fields(inputs[0], inputs[1], output)
+        filter_scales = self.quantization(inputs[1])[0]
+        if len(filter_scales) > 1:
+            multipliers, shifts = self.channel_multipliers(inputs[0], inputs[1], output)
+            params = self.params(op_index, 'FullyConnectedParams', fields)
+            arrays = self.per_channel(op_index, multipliers, shifts, 'int')
+            self.call('tflite::reference_integer_ops::FullyConnectedPerChannel',
+                      [params] + list(arrays) + args)
+            return
+        # GetQuantizedConvolutionMultipler(): the scale product is a float
+        real = f32(self.quantization(inputs[0])[0][0] * filter_scales[0]) \
+            / self.quantization(output)[0][0]
+        multiplier, shift = quantize_multiplier(real)
+        fields += [('output_multiplier', multiplier), ('output_shift', shift)]
+        params = self.params(op_index, 'FullyConnectedParams', fields)
+        self.call('tflite::reference_integer_ops::FullyConnected', [params] + args)
+
+    def zero_point_fields(self, input_index, filter_index, output_index):
+        return [('input_offset', -self.quantization(input_index)[1][0]),
+                ('weights_offset', -self.quantization(filter_index)[1][0]),
+                ('output_offset', self.quantization(output_index)[1][0])]
+
+    def conv_2d(self, op_index, op, options):
+        inputs, output = op['inputs'], op['outputs'][0]
+        padding = options.scalar(0, 'b')
+        stride_w, stride_h = options.scalar(1, 'i'), options.scalar(2, 'i')
+        activation = self.activation(options.scalar(3, 'b'))
+        dilation_w, dilation_h = options.scalar(4, 'i', 1), options.scalar(5, 'i', 1)
+        _, in_h, in_w, in_c = self.tensors[inputs[0]]['shape']
+        _, filter_h, filter_w, filter_c = self.tensors[inputs[1]]['shape']
+        if filter_c != in_c:
+            raise AotError('grouped CONV_2D')
+        fields = self.spatial_fields(padding, stride_w, stride_h, dilation_w, dilation_h,
+                                     in_h, in_w, filter_h, filter_w, output)
+        fields += [('stride_width', stride_w), ('stride_height', stride_h),
+                   ('dilation_width_factor', dilation_w),
+                   ('dilation_height_factor', dilation_h)]
+        fields += self.range_fields(activation, output)
+        filter_shape, filter_data = self.weights(inputs[1])
+        bias_shape, bias_data = self.bias(inputs)
+        args = [self.shape(inputs[0]), self.ptr(inputs[0]), filter_shape, filter_data,
+                bias_shape, bias_data, self.shape(output), self.ptr(output)]
+        if self.dtype == 'FLOAT32':
+            params = self.params(op_index, 'ConvParams', fields)
+            self.call('tflite::reference_ops::Conv',
+                      [params] + args + ['tflite::RuntimeShape()', 'nullptr'])
+            return
+        fields += self.zero_point_fields(inputs[0], inputs[1], output)
+        multipliers, shifts = self.channel_multipliers(inputs[0], inputs[1], output)
+        params = self.params(op_index, 'ConvParams', fields)
+        arrays = self.per_channel(op_index, multipliers, shifts, 'int32_t')
+        self.call('tflite::reference_integer_ops::ConvPerChannel',
+                  [params] + list(arrays) + args)
+
+    def spatial_fields(self, padding, stride_w, stride_h, dilation_w, dilation_h,
+                       in_h, in_w, filter_h, filter_w, output):
+        """ComputePaddingHeightWidth(), checked against the model's shapes."""
+        if padding not in (PADDING_SAME, PADDING_VALID):
+            raise AotError('padding %d' % padding)
+        out_h = out_size(padding, in_h, filter_h, stride_h, dilation_h)
+        out_w = out_size(padding, in_w, filter_w, stride_w, dilation_w)
+        if self.tensors[output]['shape'][1:3] != [out_h, out_w]:
+            raise AotError('output shape of tensor %d does not match its op' % output)
+        pad_h, offset_h = padding_with_offset(stride_h, dilation_h, in_h, filter_h, out_h)
+        pad_w, offset_w = padding_with_offset(stride_w, dilation_w, in_w, filter_w, out_w)
+        return [('padding_values.width', pad_w), ('padding_values.height', pad_h),
+                ('padding_values.width_offset', offset_w),
+                ('padding_values.height_offset', offset_h)]
+
+    def max_pool_2d(self, op_index, op, options):
+        inputs, output = op['inputs'], op['outputs'][0]
+        padding = options.scalar(0, 'b')
+        stride_w, stride_h = options.scalar(1, 'i'), options.scalar(2, 'i')
+        filter_w, filter_h = options.scalar(3, 'i'), options.scalar(4, 'i')
+        activation = self.activation(options.scalar(5, 'b'))
+        _, in_h, in_w, _ = self.tensors[inputs[0]]['shape']
+        fields = self.spatial_fields(padding, stride_w, stride_h, 1, 1,
+                                     in_h, in_w, filter_h, filter_w, output)
+        fields += [('stride_width', stride_w), ('stride_height', stride_h),
+                   ('filter_width', filter_w), ('filter_height', filter_h)]
+        fields += self.range_fields(activation, output)
+        params = self.params(op_index, 'PoolParams', fields)
+        namespace = 'reference_ops' if self.dtype == 'FLOAT32' else 'reference_integer_ops'
+        self.call('tflite::%s::MaxPool' % namespace,
+                  [params, self.shape(inputs[0]), self.ptr(inputs[0]),
+                   self.shape(output), self.ptr(output)])
+
+    def softmax(self, op_index, op, options):
+        inputs, output = op['inputs'], op['outputs'][0]
+        beta = options.scalar(0, 'f', 0.0) if options else 0.0
+        if self.dtype == 'FLOAT32':
+            fields = [('beta', repr(beta))]
+        else:
+            scales, zero_points = self.quantization(output)
+            if scales[0] != 1.0 / 256 or zero_points[0] != INT8_MIN:
+                raise AotError('int8 SOFTMAX output must have scale 1/256, zero point -128')
+            # PreprocessSoftmaxScaling() and CalculateInputRadius()
+            real = min(beta * self.quantization(inputs[0])[0][0]
+                       * (1 << (31 - SOFTMAX_INTEGER_BITS)), (1 << 31) - 1.0)
+            multiplier, left_shift = quantize_multiplier(real)
+            radius = math.floor(((1 << SOFTMAX_INTEGER_BITS) - 1)
+                                * (1 << (31 - SOFTMAX_INTEGER_BITS)) / (1 << left_shift))
+            fields = [('input_multiplier', multiplier), ('input_left_shift', left_shift),
+                      ('diff_min', -radius)]
+        params = self.params(op_index, 'SoftmaxParams', fields)
+        self.call('tflite::reference_ops::Softmax',
+                  [params, self.shape(inputs[0]), self.ptr(inputs[0]),
+                   self.shape(output), self.ptr(output)])
+
+    def reshape(self, op_index, op, options):
+        source, target = op['inputs'][0], op['outputs'][0]
+        if target in self.aliases:
+            return  # Same bytes, nothing to run
+        self.calls.append('memcpy(%s, %s, %d);' % (self.ptr(target), self.ptr(source),
+                                                   self.tensor_bytes(source)))
+
+    # Buffers --------------------------------------------------------------
+
+    def tensor_bytes(self, index):
+        size = {'FLOAT32': 4, 'INT8': 1}[self.tensor_type(index, 'FLOAT32', 'INT8')]
+        for dim in self.tensors[index]['shape']:
+            size *= dim
+        return size
+
+    def ptr(self, index):
+        index = self.aliases.get(index, index)
+        return 't%d' % index
+
+    def call(self, function, args):
+        self.calls.append('%s(%s);' % (function, ', '.join(str(a) for a in args)))
+
+    def plan(self):
+        """Arena offsets of the activations; RESHAPE outputs that are not
+        the graph output share their input's buffer."""
+        self.aliases = {}
+        for op in self.operators:
+            if self.codes[op['opcode_index']][0] != 'RESHAPE':
+                continue
+            source, target = op['inputs'][0], op['outputs'][0]
+            if target != self.output and source != self.input:
+                self.aliases[target] = self.aliases.get(source, source)
+        try:
+            buffers, _ = planned_buffers(self.model)
+        except PlanError as e:
+            raise AotError(str(e))
+        greedy_bytes = optimize(buffers)[2]
+        lifetimes = {}
+        for tensor, size, first, last in buffers:
+            if tensor in (self.input, self.output):
+                continue
+            tensor = self.aliases.get(tensor, tensor)
+            _, _, old_first, old_last = lifetimes.get(tensor, (tensor, size, first, last))
+            lifetimes[tensor] = (tensor, size, min(first, old_first), max(last, old_last))
+        arena_buffers = [lifetimes[t] for t in sorted(lifetimes)]
+        offsets, arena_bytes, _, _ = optimize(arena_buffers)
+        check_plan(arena_buffers, offsets)
+        self.arena_offsets = {b[0]: offsets[i] for i, b in enumerate(arena_buffers)}
+        self.arena_bytes = arena_bytes
+        self.greedy_bytes = greedy_bytes
+
+    def compile(self, function):
+        handlers = {'FULLY_CONNECTED': self.fully_connected, 'CONV_2D': self.conv_2d,
+                    'MAX_POOL_2D': self.max_pool_2d, 'SOFTMAX': self.softmax,
+                    'RESHAPE': self.reshape}
+        names = []
+        for op in self.operators:
+            name, custom_code, _ = self.codes[op['opcode_index']]
+            if name not in handlers:
+                raise AotError('%s not supported' % (custom_code or name))
+            names.append(name)
+        self.plan()
+        for op_index, op in enumerate(self.operators):
+            name = names[op_index]
+            for index in op['outputs']:
+                self.tensor_type(index, self.dtype)
+            self.calls.append('// %d: %s' % (op_index, name))
+            handlers[name](op_index, op, self.op_tables[op_index].table(4))
+
+        c_type = C_TYPES[self.dtype]
+        body = ['  using namespace %s;' % self.namespace,
+                '  const %s* t%d = static_cast<const %s*>(input);' % (c_type, self.input, c_type),
+                '  %s* t%d = static_cast<%s*>(output);' % (c_type, self.output, c_type)]
+        for tensor, offset in sorted(self.arena_offsets.items(), key=lambda x: x[1]):
+            body.append('  %s* t%d = reinterpret_cast<%s*>(g_aot_arena + %d);'
+                        % (c_type, tensor, c_type, offset))
+        body += ['  ' + line for line in self.calls]
+        return ('namespace %s {\n\n%s\n\n}  // namespace %s\n\n'
+                'void %s(const void* input, void* output) {\n%s\n}\n' % (
+                    self.namespace, '\n\n'.join(self.constants), self.namespace,
+                    function, '\n'.join(body)))
+
+
+def load(path):
+    """(function name, namespace, model) for a model .cpp array or .tflite."""
+    if path.endswith('.tflite'):
+        with open(path, 'rb') as f:
+            data = f.read()
+        stem = os.path.splitext(os.path.basename(path))[0]
+        return cpp_identifier(stem) + 'Aot', stem + '_aot', Model(data)
+    array_name, data = read_c_array(path)
+    stem = array_name[2:] if array_name.startswith('g_') else array_name
+    return cpp_identifier(array_name) + 'Aot', stem + '_aot', Model(data)
+
+
+def generate(paths, output_cpp):
+    header_path = os.path.splitext(output_cpp)[0] + '.h'
+    guard = os.path.basename(header_path).upper().replace('.', '_') + '_'
+    decls, definitions = [], []
+    max_arena = 0
+    for path in paths:
+        function, namespace, model = load(path)
+        ops = ', '.join(code[1] or code[0] for code in model.operator_codes())
+        decls.append('// %s: %s' % (os.path.basename(path), ops))
+        try:
+            compiler = Compiler(model, namespace)
+            definition = compiler.compile(function)
+        except AotError as e:
+            print('%s: not compiled: %s' % (os.path.basename(path), e), file=sys.stderr)
+            decls += ['// Not compiled: %s' % e,
+                      'constexpr AotInvokeFunction k%sInvoke = nullptr;' % function,
+                      'constexpr size_t k%sArenaBytes = 0;' % function, '']
+            continue
+        summary = ('%d ops, %d arena bytes (interpreter greedy plan: %d)'
+                   % (len(compiler.operators), compiler.arena_bytes, compiler.greedy_bytes))
+        print('%s: %s' % (os.path.basename(path), summary), file=sys.stderr)
+        decls += ['void %s(const void* input, void* output);' % function,
+                  'constexpr AotInvokeFunction k%sInvoke = %s;' % (function, function),
+                  'constexpr size_t k%sArenaBytes = %d;' % (function, compiler.arena_bytes), '']
+        definitions.append('// %s: %s\n%s' % (os.path.basename(path), summary, definition))
+        max_arena = max(max_arena, compiler.arena_bytes)
+
+    banner = ('// Generated by scripts/aot_compile.py - do not edit.\n'
+              '// Ahead-of-time compiled models: one function per model calling\n'
+              '// the reference kernels directly on a statically planned arena.\n')
+    header = (banner + '\n#ifndef %s\n#define %s\n\n#include <stddef.h>\n\n'
+              '// Runs one inference: input and output are laid out like the\n'
+              '// model\'s input and output tensors. Activations live in one static\n'
+              '// arena shared by all models, so calls must not overlap.\n'
+              'using AotInvokeFunction = void (*)(const void* input, void* output);\n\n'
+              '// Largest arena of any compiled model\n'
+              'constexpr size_t kAotArenaBytes = %d;\n\n%s\n#endif  // %s\n'
+              % (guard, guard, max_arena, '\n'.join(decls), guard))
+    source = (banner + '\n#include "%s"\n\n#include <stdint.h>\n#include <string.h>\n\n'
+              '#include <limits>\n\n'
+              '#include "tensorflow/lite/kernels/internal/reference/conv.h"\n'
+              '#include "tensorflow/lite/kernels/internal/reference/fully_connected.h"\n'
+              '#include "tensorflow/lite/kernels/internal/reference/integer_ops/conv.h"\n'
+              '#include "tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h"\n'
+              '#include "tensorflow/lite/kernels/internal/reference/integer_ops/pooling.h"\n'
+              '#include "tensorflow/lite/kernels/internal/reference/pooling.h"\n'
+              '#include "tensorflow/lite/kernels/internal/reference/softmax.h"\n\n'
+              'namespace {\nalignas(16) uint8_t g_aot_arena[kAotArenaBytes > 0 ? kAotArenaBytes : 16];\n'
+              '}  // namespace\n\n%s'
+              % (os.path.basename(header_path), '\n'.join(definitions)))
+    for path, text in ((header_path, header), (output_cpp, source)):
+        # Only touch the files when they change to avoid needless rebuilds
+        if os.path.exists(path):
+            with open(path) as f:
+                if f.read() == text:
+                    continue
+        with open(path, 'w') as f:
+            f.write(text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('--output', required=True, help='source to write (and .h next to it)')
+    parser.add_argument('models', nargs='+', help='model .cpp C arrays or .tflite files')
+    args = parser.parse_args()
+    generate(args.models, args.output)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
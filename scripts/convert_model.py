@@ -0,0 +1,283 @@
+"""Embed an offline tensor arena plan into TFLite models.
+
+TFLite Micro places activation tensors with a greedy planner inside
+AllocateTensors() on every boot: largest buffer first, each at the lowest
+offset that does not collide with a buffer alive at the same time. That
+costs time and is not optimal. A model can instead carry the offsets in an
+"OfflineMemoryAllocation" metadata buffer, which the planner takes as is:
+
+    int32 [version = 0, subgraph = 0, tensor count, offset per tensor...]
+
+with -1 for tensors the runtime allocates itself (constants, variables).
+Kernel scratch buffers are not tensors and stay online planned, fitted
+around the offline tensors.
+
+This script derives each tensor's lifetime the way TFLite Micro does
+(graph inputs alive from the start, op outputs from their op to their last
+reader, graph outputs to the end), then searches placements for the
+smallest arena: every order for small graphs, several heuristics plus
+seeded random orders otherwise, stopping early when the peak of live bytes
+(a lower bound for any placement) is reached. Single-subgraph models only.
+
+Convert one model (.tflite or generated .cpp) into a C array with the plan:
+
+    python convert_model.py model.tflite --output main/models/cnn/cnn_model_float32.cpp \\
+        --var-name g_cnn_model_float32 --header model32.h
+
+Build time (main/CMakeLists.txt): offline-planned twins of every model,
+g_<name>_offline[] in one source file plus header, for the harness's
+kUseOfflinePlan and kCompareOfflinePlan:
+
+    python convert_model.py --variants generated/offline_planned_models.cpp model.cpp...
+"""
+
+import argparse
+import itertools
+import os
+import random
+import struct
+import sys
+
+from tflite_flatbuffer import (TENSOR_TYPE_SIZES, load_model, read_c_array,
+                               replace_metadata, write_c_array, Model)
+
+METADATA_NAME = 'OfflineMemoryAllocation'
+ONLINE = -1
+ALIGNMENT = 16          # MicroArenaBufferAlignment()
+EXHAUSTIVE_MAX = 8      # Try every order up to this many buffers
+RANDOM_ORDERS = 500
+
+
+class PlanError(Exception):
+    pass
+
+
+def align(size):
+    return (size + ALIGNMENT - 1) // ALIGNMENT * ALIGNMENT
+
+
+def planned_buffers(model):
+    """[(tensor index, aligned bytes, first op, last op)] for the tensors
+    the micro allocator plans, with lifetimes as its AllocationInfoBuilder
+    marks them."""
+    subgraphs = model.subgraphs()
+    if len(subgraphs) != 1:
+        raise PlanError('%d subgraphs; only single-subgraph models are planned'
+                        % len(subgraphs))
+    subgraph = subgraphs[0]
+    tensors = subgraph.tensors()
+    operators = subgraph.operators()
+
+    first, last = {}, {}
+
+    def created(index, op):
+        if index >= 0 and index not in first:
+            first[index] = op
+
+    def used(index, op):
+        if index >= 0:
+            last[index] = max(last.get(index, op), op)
+
+    for index in subgraph.inputs():
+        created(index, 0)
+        used(index, 0)
+    for op_index, op in enumerate(operators):
+        for index in op['inputs']:
+            used(index, op_index)
+        for index in op['outputs']:
+            created(index, op_index)
+            used(index, op_index)
+    for index in subgraph.outputs():
+        used(index, max(len(operators) - 1, 0))
+
+    buffers = []
+    for index, tensor in enumerate(tensors):
+        if tensor['is_variable'] or model.buffer_data(tensor['buffer']):
+            continue
+        if index not in first:
+            continue  # Never produced or read; not allocated either
+        if tensor['type'] not in TENSOR_TYPE_SIZES or any(d < 0 for d in tensor['shape']):
+            raise PlanError('tensor %d (%s): no static size' % (index, tensor['name']))
+        elements = 1
+        for dim in tensor['shape']:
+            elements *= dim
+        size = elements * TENSOR_TYPE_SIZES[tensor['type']]
+        if size:
+            buffers.append((index, align(size), first[index], last[index]))
+    return buffers, len(tensors)
+
+
+def place(buffers, order):
+    """First fit at the lowest offset, in the given order; {i: offset}."""
+    offsets = {}
+    for i in order:
+        _, size, first, last = buffers[i]
+        # Buffers alive at the same time, by offset
+        busy = sorted((offsets[j], offsets[j] + buffers[j][1]) for j in offsets
+                      if buffers[j][2] <= last and first <= buffers[j][3])
+        offset = 0
+        for start, end in busy:
+            if offset + size <= start:
+                break
+            offset = max(offset, end)
+        offsets[i] = offset
+    return offsets
+
+
+def arena_size(buffers, offsets):
+    return max((offsets[i] + buffers[i][1] for i in offsets), default=0)
+
+
+def peak_live(buffers):
+    ops = max((b[3] for b in buffers), default=-1) + 1
+    return max((sum(b[1] for b in buffers if b[2] <= op <= b[3])
+                for op in range(ops)), default=0)
+
+
+def greedy_order(buffers):
+    """TFLite Micro's online order: largest first."""
+    return sorted(range(len(buffers)), key=lambda i: -buffers[i][1])
+
+
+def optimize(buffers):
+    """Return (offsets, arena size, online greedy size, lower bound)."""
+    indices = range(len(buffers))
+    bound = peak_live(buffers)
+    greedy = place(buffers, greedy_order(buffers))
+    best, best_size = greedy, arena_size(buffers, greedy)
+
+    def candidates():
+        if len(buffers) <= EXHAUSTIVE_MAX:
+            yield from itertools.permutations(indices)
+            return
+        yield sorted(indices, key=lambda i: -(buffers[i][3] - buffers[i][2]))
+        yield sorted(indices, key=lambda i: -buffers[i][1] * (buffers[i][3] - buffers[i][2] + 1))
+        yield sorted(indices, key=lambda i: (buffers[i][2], -buffers[i][1]))
+        rng = random.Random(0)  # Deterministic output for the build
+        order = list(indices)
+        for _ in range(RANDOM_ORDERS):
+            rng.shuffle(order)
+            yield list(order)
+
+    for order in candidates():
+        if best_size <= bound:
+            break
+        offsets = place(buffers, order)
+        size = arena_size(buffers, offsets)
+        if size < best_size:
+            best, best_size = offsets, size
+    return best, best_size, arena_size(buffers, greedy), bound
+
+
+def check_plan(buffers, offsets):
+    for i, j in itertools.combinations(range(len(buffers)), 2):
+        a, b = buffers[i], buffers[j]
+        if a[2] <= b[3] and b[2] <= a[3]:
+            if offsets[i] < offsets[j] + b[1] and offsets[j] < offsets[i] + a[1]:
+                raise AssertionError('tensors %d and %d overlap' % (a[0], b[0]))
+
+
+def plan_payload(buffers, tensor_count, offsets):
+    values = [ONLINE] * tensor_count
+    for i, (tensor, _, _, _) in enumerate(buffers):
+        values[tensor] = offsets[i]
+    return struct.pack('<%di' % (3 + tensor_count), 0, 0, tensor_count, *values)
+
+
+def add_offline_plan(data):
+    """Return (model bytes with the plan embedded, stats dict)."""
+    model = Model(data)
+    buffers, tensor_count = planned_buffers(model)
+    offsets, size, greedy_size, bound = optimize(buffers)
+    check_plan(buffers, offsets)
+    stats = {'buffers': len(buffers), 'offline': size, 'greedy': greedy_size,
+             'bound': bound}
+    return replace_metadata(data, METADATA_NAME,
+                            plan_payload(buffers, tensor_count, offsets)), stats
+
+
+def describe(path, stats):
+    gain = (', no gain over greedy' if stats['offline'] >= stats['greedy']
+            else ', %d bytes saved' % (stats['greedy'] - stats['offline']))
+    return ('%s: %d tensors planned, %d bytes offline vs %d bytes greedy '
+            '(lower bound %d%s)' % (os.path.basename(path), stats['buffers'],
+                                    stats['offline'], stats['greedy'],
+                                    stats['bound'], gain))
+
+
+def write_variants(sources, output_cpp):
+    """One g_<name>_offline array per source model; models that cannot be
+    planned get a zero length so the harness falls back to the original."""
+    header = os.path.splitext(output_cpp)[0] + '.h'
+    guard = os.path.basename(header).upper().replace('.', '_') + '_'
+    decls, arrays = [], []
+    for path in sources:
+        var_name, data = read_c_array(path)
+        name = var_name + '_offline'
+        decls += ['extern const unsigned char %s[];' % name,
+                  'extern const int %s_len;' % name]
+        try:
+            planned, stats = add_offline_plan(data)
+        except PlanError as e:
+            print('%s: not planned: %s' % (os.path.basename(path), e), file=sys.stderr)
+            arrays.append('// %s: not planned: %s\n'
+                          'alignas(16) const unsigned char %s[1] = {0};\n'
+                          'const int %s_len = 0;\n' % (os.path.basename(path), e, name, name))
+            continue
+        print(describe(path, stats), file=sys.stderr)
+        hex_bytes = ['0x%02x' % b for b in planned]
+        lines = ['    %s,' % ', '.join(hex_bytes[i:i + 12]) for i in range(0, len(hex_bytes), 12)]
+        arrays.append('// %s\nalignas(16) const unsigned char %s[] = {\n%s\n};\n'
+                      'const int %s_len = %d;\n' % (describe(path, stats), name,
+                                                    '\n'.join(lines), name, len(planned)))
+
+    banner = ('// Generated by scripts/convert_model.py - do not edit.\n'
+              '// Offline-planned copies of the benchmark models\n'
+              '// (OfflineMemoryAllocation metadata); length 0 when a model\n'
+              '// could not be planned.\n')
+    with open(header, 'w') as f:
+        f.write(banner + '\n#ifndef %s\n#define %s\n\n%s\n\n#endif  // %s\n'
+                % (guard, guard, '\n'.join(decls), guard))
+    with open(output_cpp, 'w') as f:
+        f.write(banner + '\n#include "%s"\n\n%s' % (os.path.basename(header),
+                                                     '\n'.join(arrays)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('models', nargs='+', help='.tflite files or model .cpp arrays')
+    parser.add_argument('--output', help='C array (.cpp) or .tflite to write')
+    parser.add_argument('--var-name', help='C array name (default: from the input .cpp)')
+    parser.add_argument('--header', default='model.h', help='header the C array includes')
+    parser.add_argument('--variants', metavar='CPP',
+                        help='write offline-planned twins of all models here (and .h)')
+    args = parser.parse_args()
+
+    if args.variants:
+        write_variants(args.models, args.variants)
+        return 0
+    if len(args.models) != 1 or not args.output:
+        parser.error('convert one model at a time with --output')
+
+    source = args.models[0]
+    data = load_model(source).data
+    try:
+        planned, stats = add_offline_plan(data)
+    except PlanError as e:
+        raise SystemExit('%s: %s' % (source, e))
+    print(describe(source, stats))
+    if args.output.endswith('.tflite'):
+        with open(args.output, 'wb') as f:
+            f.write(planned)
+        return 0
+    var_name = args.var_name
+    if var_name is None:
+        if source.endswith('.tflite'):
+            parser.error('--var-name is needed for a .tflite input')
+        var_name = read_c_array(source)[0]
+    write_c_array(planned, var_name, args.output, header=args.header)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,298 @@
+"""Decode binary benchmark telemetry back into CSV.
+
+With kLogFormat = LogFormat::BINARY the firmware replaces CSV_TIMER,
+CSV_DATA and CSV_SUMMARY lines with framed binary records (see
+main/utils/telemetry_frame.h). Capture the raw serial stream, e.g.
+
+    idf.py monitor | tee capture.log   (or any raw serial logger)
+
+and decode it. By default the capture is written back out as a text log
+with every frame replaced by the CSV line text mode would have printed, so
+tools that read CSV_* lines keep working. --columns writes one CSV file per
+record type instead.
+
+Frames that fail their CRC are dropped and counted; sequence gaps (frames
+lost on the wire) are reported on stderr.
+
+Usage:
+    python decode_telemetry.py capture.log [-o decoded.log]
+    python decode_telemetry.py capture.log --columns out_dir
+"""
+
+import argparse
+import csv
+import os
+import struct
+import sys
+
+VERSION = 3  # TelemetryFrame::kVersion
+FLAG, ESCAPE = 0x7E, 0x7D
+
+SESSION, MODEL, INFERENCE, SUMMARY = 1, 2, 3, 4
+
+PERCENTILES = ('p50_us', 'p90_us', 'p99_us', 'p999_us')
+
+# (frame type, struct layout after the 4-byte header, column names);
+# MODEL and SESSION end in length-prefixed strings and are parsed by hand
+LAYOUTS = {
+    SUMMARY: ('<BBfIfff4fIIIf', ('model_id', 'completed', 'avg_us', 'avg_ticks',
+                                 'min_us', 'max_us', 'stddev_us') + PERCENTILES +
+              ('arena_bytes', 'heap_used', 'inferences', 'throughput_ips')),
+}
+
+# INFERENCE: model id u8, then samples of these fields, each a zigzag
+# varint delta against the same field of the previous sample in the frame
+# (the first against 0), with the divisor turning it back into CSV units
+SAMPLE_FIELDS = (('iteration', 1), ('latency_us', 100), ('latency_ticks', 1),
+                 ('min_us', 100), ('max_us', 100), ('avg_us', 100),
+                 ('stddev_us', 100)) + tuple((name, 10) for name in PERCENTILES) + \
+    (('arena_bytes', 1), ('free_heap', 1))
+
+DATA_COLUMNS = ('iteration', 'model_name', 'quantization', 'latency_us',
+                'latency_ticks', 'min_us', 'max_us', 'avg_us', 'stddev_us') + \
+    PERCENTILES + ('arena_bytes', 'free_heap')
+SUMMARY_COLUMNS = ('model_name', 'quantization', 'completed', 'avg_us',
+                   'avg_ticks', 'min_us', 'max_us', 'stddev_us') + \
+    PERCENTILES + ('arena_bytes', 'heap_used', 'inferences', 'throughput_ips',
+                   'batch_size', 'per_sample_us')
+TIMER_COLUMNS = ('backend', 'ticks_per_us', 'overhead_ticks')
+
+
+def crc16(data):
+    """CRC-16/CCITT-FALSE, as TelemetryFrame::Crc16."""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+
+def unstuff(data):
+    out = bytearray()
+    escaped = False
+    for byte in data:
+        if escaped:
+            out.append(byte ^ 0x20)
+            escaped = False
+        elif byte == ESCAPE:
+            escaped = True
+        else:
+            out.append(byte)
+    return bytes(out)
+
+
+def read_string(body, pos):
+    length = body[pos]
+    return body[pos + 1:pos + 1 + length].decode('utf-8', 'replace'), pos + 1 + length
+
+
+def read_varint(body, pos):
+    value = shift = 0
+    while True:
+        byte = body[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        if byte < 0x80:
+            return value, pos
+        shift += 7
+
+
+def parse_samples(body):
+    """Decode the delta-coded samples of an INFERENCE frame body."""
+    samples, values, pos = [], [0] * len(SAMPLE_FIELDS), 1
+    while pos < len(body):
+        for i in range(len(SAMPLE_FIELDS)):
+            raw, pos = read_varint(body, pos)
+            values[i] += (raw >> 1) ^ -(raw & 1)
+        samples.append({name: value if scale == 1 else value / scale
+                        for (name, scale), value in zip(SAMPLE_FIELDS, values)})
+    return samples
+
+
+def parse_frame(frame):
+    """Return (type, sequence, fields dict), or None if not a valid frame."""
+    if len(frame) < 6 or frame[0] != VERSION:
+        return None
+    if crc16(frame[:-2]) != struct.unpack_from('<H', frame, len(frame) - 2)[0]:
+        return None
+    frame_type, sequence = frame[1], struct.unpack_from('<H', frame, 2)[0]
+    body = frame[4:-2]
+    try:
+        if frame_type in LAYOUTS:
+            layout, names = LAYOUTS[frame_type]
+            fields = dict(zip(names, struct.unpack(layout, body)))
+        elif frame_type == INFERENCE:
+            fields = {'model_id': body[0], 'samples': parse_samples(body)}
+        elif frame_type == MODEL:
+            model_id, batch_size = struct.unpack_from('<BH', body)
+            name, pos = read_string(body, 3)
+            quantization, _ = read_string(body, pos)
+            fields = {'model_id': model_id, 'batch_size': batch_size,
+                      'model_name': name, 'quantization': quantization}
+        elif frame_type == SESSION:
+            ticks_per_us, overhead = struct.unpack_from('<fI', body)
+            backend, _ = read_string(body, 8)
+            fields = {'backend': backend, 'ticks_per_us': ticks_per_us,
+                      'overhead_ticks': overhead}
+        else:
+            return None
+    except (struct.error, IndexError):
+        return None
+    return frame_type, sequence, fields
+
+
+def split_capture(data):
+    """Yield ('text', bytes), ('frame', parsed) and ('corrupt', None)."""
+    text_start = pos = 0
+    while True:
+        start = data.find(FLAG, pos)
+        if start < 0:
+            break
+        end = data.find(FLAG, start + 1)
+        if end < 0:
+            break
+        frame = unstuff(data[start + 1:end])
+        parsed = parse_frame(frame)
+        if parsed is None:
+            # A frame-looking candidate with a bad CRC is corruption; anything
+            # else is a stray 0x7E ('~') in ordinary text
+            if len(frame) >= 6 and frame[0] == VERSION and frame[1] in (
+                    SESSION, MODEL, INFERENCE, SUMMARY):
+                if start > text_start:
+                    yield 'text', data[text_start:start]
+                yield 'corrupt', None
+                text_start = pos = end + 1
+            else:
+                pos = start + 1
+            continue
+        if start > text_start:
+            yield 'text', data[text_start:start]
+        yield 'frame', parsed
+        text_start = pos = end + 1
+    if text_start < len(data):
+        yield 'text', data[text_start:]
+
+
+def fmt(value):
+    return '%.2f' % value
+
+
+def percentiles(fields):
+    return ['%.1f' % fields[name] for name in PERCENTILES]
+
+
+class Decoder:
+    def __init__(self):
+        self.models = {}
+        self.frames = self.corrupt = self.lost = 0
+        self.last_sequence = None
+
+    def track(self, sequence):
+        if self.last_sequence is not None:
+            self.lost += (sequence - self.last_sequence - 1) & 0xFFFF
+        self.last_sequence = sequence
+
+    def model(self, model_id):
+        return self.models.get(model_id, {'model_name': 'model%d' % model_id,
+                                          'quantization': '?', 'batch_size': 1})
+
+    def rows(self, frame_type, fields):
+        """(record kind, ordered column values as text) per record in one
+        frame."""
+        if frame_type == SESSION:
+            return [('timer', [fields['backend'], '%.3f' % fields['ticks_per_us'],
+                               str(fields['overhead_ticks'])])]
+        if frame_type == MODEL:
+            self.models[fields['model_id']] = fields
+            return []
+        model = self.model(fields['model_id'])
+        if frame_type == INFERENCE:
+            return [('data', [str(sample['iteration']), model['model_name'],
+                              model['quantization'], fmt(sample['latency_us']),
+                              str(sample['latency_ticks']), fmt(sample['min_us']),
+                              fmt(sample['max_us']), fmt(sample['avg_us']),
+                              fmt(sample['stddev_us'])] + percentiles(sample) + [
+                                  str(sample['arena_bytes']), str(sample['free_heap'])])
+                    for sample in fields['samples']]
+        batch_size = model['batch_size']
+        return [('summary', [model['model_name'], model['quantization'],
+                             str(fields['completed']), fmt(fields['avg_us']),
+                             str(fields['avg_ticks']), fmt(fields['min_us']),
+                             fmt(fields['max_us']), fmt(fields['stddev_us'])] +
+                 percentiles(fields) +
+                 [str(fields['arena_bytes']), str(fields['heap_used']),
+                  str(fields['inferences']), fmt(fields['throughput_ips']),
+                  str(batch_size), fmt(fields['avg_us'] / batch_size)])]
+
+    def decode(self, data):
+        """Yield ('text', str) and (record kind, values) in capture order."""
+        for kind, item in split_capture(data):
+            if kind == 'text':
+                yield 'text', item.decode('utf-8', 'replace')
+            elif kind == 'corrupt':
+                self.corrupt += 1
+            else:
+                frame_type, sequence, fields = item
+                self.frames += 1
+                self.track(sequence)
+                yield from self.rows(frame_type, fields)
+
+
+LINE_PREFIXES = {'timer': 'CSV_TIMER', 'data': 'CSV_DATA', 'summary': 'CSV_SUMMARY'}
+COLUMNS = {'timer': TIMER_COLUMNS, 'data': DATA_COLUMNS, 'summary': SUMMARY_COLUMNS}
+
+
+def write_log(decoder, data, out):
+    for kind, value in decoder.decode(data):
+        if kind == 'text':
+            out.write(value)
+        else:
+            out.write(','.join([LINE_PREFIXES[kind]] + value) + '\n')
+
+
+def write_columns(decoder, data, directory):
+    os.makedirs(directory, exist_ok=True)
+    files, writers = {}, {}
+    try:
+        for kind, value in decoder.decode(data):
+            if kind == 'text':
+                continue
+            if kind not in writers:
+                files[kind] = open(os.path.join(directory, kind + '.csv'), 'w',
+                                   newline='')
+                writers[kind] = csv.writer(files[kind])
+                writers[kind].writerow(COLUMNS[kind])
+            writers[kind].writerow(value)
+    finally:
+        for f in files.values():
+            f.close()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('capture', help='raw serial capture')
+    parser.add_argument('-o', '--output', help='decoded log (default: stdout)')
+    parser.add_argument('--columns', metavar='DIR',
+                        help='write timer.csv, data.csv and summary.csv here')
+    args = parser.parse_args()
+
+    with open(args.capture, 'rb') as f:
+        data = f.read()
+    decoder = Decoder()
+    if args.columns:
+        write_columns(decoder, data, args.columns)
+    elif args.output:
+        with open(args.output, 'w') as out:
+            write_log(decoder, data, out)
+    else:
+        write_log(decoder, data, sys.stdout)
+
+    sys.stderr.write('%d frames decoded, %d corrupt, %d lost\n'
+                     % (decoder.frames, decoder.corrupt, decoder.lost))
+    return 1 if decoder.corrupt or decoder.lost else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,261 @@
+"""Fuse CONV_2D + MAX_POOL_2D pairs into the CONV_RELU_POOL custom op.
+
+A CONV_2D (with fused NONE, RELU or RELU6 activation) whose output is read
+only by a VALID-padded MAX_POOL_2D without activation is replaced by one
+CONV_RELU_POOL operator (main/kernels/conv_relu_pool.cpp) that takes the
+conv's input, filter and bias and writes the pool's output. The conv
+output tensor, the largest activation in the CNN, disappears from the
+graph and with it from the arena plan.
+
+The operator's custom_options are little-endian int32s in the order of
+ConvReluPoolOptions in conv_relu_pool.h:
+
+    padding, stride_w, stride_h, dilation_w, dilation_h, activation,
+    pool_filter_w, pool_filter_h, pool_stride_w, pool_stride_h
+
+For int8 models the conv and pool outputs must share scale and zero point
+(the converter always emits max pool that way), since the fused kernel
+requantizes straight to the pool output. Operator codes left unused are
+dropped, tensor indices renumbered, and the rest of the model (buffers,
+metadata, description) is reused as is. Single-subgraph models only.
+
+Usage:
+    python fuse_conv_pool.py --var g_cnn_fused_model_int8 \\
+        --header model8.h cnn_model_int8.cpp cnn_fused_model_int8.cpp
+"""
+
+import argparse
+import struct
+import sys
+
+from tflite_flatbuffer import (BUILTIN_OPERATORS, Model, Object, Ref, Vector,
+                               load_model, rewrite_root, write_c_array)
+
+CUSTOM_CODE = 'CONV_RELU_POOL'
+
+# Flatbuffer field indices (tensorflow/lite/schema/schema.fbs)
+MODEL_OPERATOR_CODES, MODEL_SUBGRAPHS, MODEL_SIGNATURE_DEFS = 1, 2, 7
+SUBGRAPH_TENSORS, SUBGRAPH_INPUTS, SUBGRAPH_OUTPUTS = 0, 1, 2
+SUBGRAPH_OPERATORS, SUBGRAPH_NAME = 3, 4
+OPERATOR_OPCODE, OPERATOR_INPUTS, OPERATOR_OUTPUTS = 0, 1, 2
+OPERATOR_OPTIONS_TYPE, OPERATOR_OPTIONS = 3, 4
+OPERATOR_CUSTOM_OPTIONS, OPERATOR_CUSTOM_FORMAT = 5, 6
+OPERATOR_MUTATING_INPUTS, OPERATOR_INTERMEDIATES = 7, 8
+SIGNATURE_INPUTS, SIGNATURE_OUTPUTS, SIGNATURE_KEY = 0, 1, 2
+SIGNATURE_SUBGRAPH = 4
+TENSOR_MAP_NAME, TENSOR_MAP_INDEX = 0, 1
+
+# Conv2DOptions / Pool2DOptions
+PADDING_VALID = 1
+ACTIVATION_NONE, ACTIVATION_RELU, ACTIVATION_RELU6 = 0, 1, 3
+FUSABLE_ACTIVATIONS = (ACTIVATION_NONE, ACTIVATION_RELU, ACTIVATION_RELU6)
+
+
+class FuseError(Exception):
+    pass
+
+
+def _check_fields(table, known, what):
+    """Rebuilt tables must not lose fields this script does not copy."""
+    for index in range(table.field_count()):
+        if table.has(index) and index not in known:
+            raise FuseError('%s has unknown field %d' % (what, index))
+
+
+def conv_options(op):
+    options = op.table(OPERATOR_OPTIONS)
+    return {
+        'padding': options.scalar(0, 'b'),
+        'stride_w': options.scalar(1, 'i'),
+        'stride_h': options.scalar(2, 'i'),
+        'activation': options.scalar(3, 'b'),
+        'dilation_w': options.scalar(4, 'i', 1),
+        'dilation_h': options.scalar(5, 'i', 1),
+    }
+
+
+def pool_options(op):
+    options = op.table(OPERATOR_OPTIONS)
+    return {
+        'padding': options.scalar(0, 'b'),
+        'stride_w': options.scalar(1, 'i'),
+        'stride_h': options.scalar(2, 'i'),
+        'filter_w': options.scalar(3, 'i'),
+        'filter_h': options.scalar(4, 'i'),
+        'activation': options.scalar(5, 'b'),
+    }
+
+
+def custom_options(conv, pool):
+    return struct.pack('<10i', conv['padding'], conv['stride_w'], conv['stride_h'],
+                       conv['dilation_w'], conv['dilation_h'], conv['activation'],
+                       pool['filter_w'], pool['filter_h'],
+                       pool['stride_w'], pool['stride_h'])
+
+
+def find_pairs(model):
+    """[(conv op index, pool op index)] of fusable pairs."""
+    subgraph = model.subgraphs()[0]
+    codes = model.operator_codes()
+    tensors = subgraph.tensors()
+    operators = subgraph.operators()
+    op_tables = model.root.tables(MODEL_SUBGRAPHS)[0].tables(SUBGRAPH_OPERATORS)
+    readers = {}
+    for op_index, op in enumerate(operators):
+        for index in op['inputs']:
+            readers.setdefault(index, []).append(op_index)
+
+    pairs = []
+    for conv_index, conv in enumerate(operators):
+        if codes[conv['opcode_index']][0] != 'CONV_2D' or len(conv['outputs']) != 1:
+            continue
+        out = conv['outputs'][0]
+        consumers = readers.get(out, [])
+        if len(consumers) != 1 or out in subgraph.outputs():
+            continue
+        pool_index = consumers[0]
+        pool = operators[pool_index]
+        if codes[pool['opcode_index']][0] != 'MAX_POOL_2D' or pool['inputs'][0] != out:
+            continue
+        if conv_options(op_tables[conv_index])['activation'] not in FUSABLE_ACTIVATIONS:
+            continue
+        options = pool_options(op_tables[pool_index])
+        if options['padding'] != PADDING_VALID or options['activation'] != ACTIVATION_NONE:
+            continue
+        pool_out = tensors[pool['outputs'][0]]
+        if tensors[out]['type'] == 'INT8' and (
+                tensors[out]['scale'] != pool_out['scale'] or
+                tensors[out]['zero_point'] != pool_out['zero_point']):
+            continue
+        pairs.append((conv_index, pool_index))
+    return pairs
+
+
+def fuse(data):
+    """Return (fused model bytes, number of pairs fused)."""
+    model = Model(data)
+    root = model.root
+    if len(model.subgraphs()) != 1:
+        raise FuseError('only single-subgraph models can be fused')
+    if 'OfflineMemoryAllocation' in model.metadata():
+        raise FuseError('model carries an offline plan; fuse the unplanned model')
+    pairs = find_pairs(model)
+    if not pairs:
+        raise FuseError('no fusable CONV_2D + MAX_POOL_2D pair')
+
+    subgraph = root.tables(MODEL_SUBGRAPHS)[0]
+    _check_fields(subgraph, (SUBGRAPH_TENSORS, SUBGRAPH_INPUTS, SUBGRAPH_OUTPUTS,
+                             SUBGRAPH_OPERATORS, SUBGRAPH_NAME), 'subgraph')
+    operators = subgraph.tables(SUBGRAPH_OPERATORS)
+    code_tables = root.tables(MODEL_OPERATOR_CODES)
+
+    # The fused op takes the pool's place: its inputs exist by then, and
+    # the pool output's readers all come later
+    fused_at = {pool: conv for conv, pool in pairs}
+    dropped_ops = {conv for conv, _ in pairs}
+    dropped_tensors = {operators[conv].scalars(OPERATOR_OUTPUTS, 'i')[0]
+                       for conv, _ in pairs}
+
+    tensor_tables = subgraph.tables(SUBGRAPH_TENSORS)
+    renumber, kept_tensors = {-1: -1}, []
+    for index, tensor in enumerate(tensor_tables):
+        if index not in dropped_tensors:
+            renumber[index] = len(kept_tensors)
+            kept_tensors.append(Ref(tensor.pos))
+
+    def tensor_vector(table, field):
+        return Vector('i', [renumber[i] for i in table.scalars(field, 'i')])
+
+    # Operator codes still in use, in their original order, then the custom op
+    used_codes = sorted({op.scalar(OPERATOR_OPCODE, 'I') for i, op in enumerate(operators)
+                         if i not in dropped_ops and i not in fused_at})
+    code_index = {old: new for new, old in enumerate(used_codes)}
+    codes = [Ref(code_tables[i].pos) for i in used_codes]
+    custom = BUILTIN_OPERATORS.index('CUSTOM')
+    codes.append(Object({0: ('b', custom), 1: CUSTOM_CODE, 2: ('i', 1), 3: ('i', custom)}))
+    custom_index = len(codes) - 1
+
+    new_operators = []
+    for op_index, op in enumerate(operators):
+        if op_index in dropped_ops:
+            continue
+        if op_index in fused_at:
+            conv = operators[fused_at[op_index]]
+            new_operators.append(Object({
+                OPERATOR_OPCODE: ('I', custom_index),
+                OPERATOR_INPUTS: tensor_vector(conv, OPERATOR_INPUTS),
+                OPERATOR_OUTPUTS: tensor_vector(op, OPERATOR_OUTPUTS),
+                OPERATOR_CUSTOM_OPTIONS: Vector('B', custom_options(conv_options(conv),
+                                                                    pool_options(op))),
+                OPERATOR_CUSTOM_FORMAT: ('b', 0),
+            }))
+            continue
+        _check_fields(op, range(OPERATOR_INTERMEDIATES + 1), 'operator %d' % op_index)
+        new_operators.append(Object({
+            OPERATOR_OPCODE: ('I', code_index[op.scalar(OPERATOR_OPCODE, 'I')]),
+            OPERATOR_INPUTS: tensor_vector(op, OPERATOR_INPUTS),
+            OPERATOR_OUTPUTS: tensor_vector(op, OPERATOR_OUTPUTS),
+            OPERATOR_OPTIONS_TYPE: (('B', op.scalar(OPERATOR_OPTIONS_TYPE, 'B'))
+                                    if op.has(OPERATOR_OPTIONS_TYPE) else None),
+            OPERATOR_OPTIONS: op.ref(OPERATOR_OPTIONS),
+            OPERATOR_CUSTOM_OPTIONS: op.ref(OPERATOR_CUSTOM_OPTIONS),
+            OPERATOR_CUSTOM_FORMAT: (('b', op.scalar(OPERATOR_CUSTOM_FORMAT, 'b'))
+                                     if op.has(OPERATOR_CUSTOM_FORMAT) else None),
+            OPERATOR_MUTATING_INPUTS: op.ref(OPERATOR_MUTATING_INPUTS),
+            OPERATOR_INTERMEDIATES: (tensor_vector(op, OPERATOR_INTERMEDIATES)
+                                     if op.has(OPERATOR_INTERMEDIATES) else None),
+        }))
+
+    new_subgraph = Object({
+        SUBGRAPH_TENSORS: kept_tensors,
+        SUBGRAPH_INPUTS: tensor_vector(subgraph, SUBGRAPH_INPUTS),
+        SUBGRAPH_OUTPUTS: tensor_vector(subgraph, SUBGRAPH_OUTPUTS),
+        SUBGRAPH_OPERATORS: new_operators,
+        SUBGRAPH_NAME: subgraph.ref(SUBGRAPH_NAME),
+    })
+    fields = {MODEL_OPERATOR_CODES: codes, MODEL_SUBGRAPHS: [new_subgraph]}
+
+    # Signatures name graph inputs/outputs by tensor index
+    if root.has(MODEL_SIGNATURE_DEFS):
+        def tensor_maps(signature, field):
+            return [Object({TENSOR_MAP_NAME: entry.ref(TENSOR_MAP_NAME),
+                            TENSOR_MAP_INDEX: ('I', renumber[entry.scalar(TENSOR_MAP_INDEX, 'I')])})
+                    for entry in signature.tables(field)]
+        signatures = []
+        for signature in root.tables(MODEL_SIGNATURE_DEFS):
+            _check_fields(signature, (SIGNATURE_INPUTS, SIGNATURE_OUTPUTS, SIGNATURE_KEY,
+                                      SIGNATURE_SUBGRAPH), 'signature')
+            signatures.append(Object({
+                SIGNATURE_INPUTS: tensor_maps(signature, SIGNATURE_INPUTS),
+                SIGNATURE_OUTPUTS: tensor_maps(signature, SIGNATURE_OUTPUTS),
+                SIGNATURE_KEY: signature.ref(SIGNATURE_KEY),
+                SIGNATURE_SUBGRAPH: ('I', signature.scalar(SIGNATURE_SUBGRAPH, 'I')),
+            }))
+        fields[MODEL_SIGNATURE_DEFS] = signatures
+
+    return rewrite_root(data, fields), len(pairs)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('--var', required=True, help='C array name, e.g. g_cnn_fused_model_int8')
+    parser.add_argument('--header', default='model.h', help='header the .cpp includes')
+    parser.add_argument('--tflite', help='also write the fused .tflite here')
+    parser.add_argument('input', help='model to fuse (.tflite or generated .cpp)')
+    parser.add_argument('output', help='generated .cpp to write')
+    args = parser.parse_args()
+
+    try:
+        fused, count = fuse(load_model(args.input).data)
+    except FuseError as e:
+        raise SystemExit('%s: %s' % (args.input, e))
+    print('%s: %d CONV_2D + MAX_POOL_2D pair(s) fused' % (args.input, count))
+    write_c_array(fused, args.var, args.output, args.header)
+    if args.tflite:
+        with open(args.tflite, 'wb') as f:
+            f.write(fused)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,99 @@
+"""Generate per-model tensor arena constants from a benchmark log.
+
+Parses the CSV_ARENA lines printed when kEnableArenaSizing is set in
+main/constants.h and writes a header with one constexpr per model plus the
+largest of them, so a production image can reserve exactly the arena its
+model needs instead of the benchmark's generic kTensorArenaSize.
+
+Run the sizing on the target: arena usage depends on pointer size and the
+TFLite Micro version, so numbers from the host build do not transfer.
+
+Usage:
+    idf.py monitor | tee benchmark.log
+    python generate_arena_sizes.py --output main/model_arena_sizes.h benchmark.log
+"""
+
+import argparse
+import csv
+import sys
+
+from generate_op_resolvers import cpp_identifier
+
+
+def model_identifier(name, quantization):
+    """('cnn_b2', 'int8') -> CnnB2ModelInt8, matching model_op_resolvers.h"""
+    return cpp_identifier('g_%s_model_%s' % (name, quantization))
+
+
+def parse_log(path):
+    """Return {(name, quantization): (used_bytes, min_bytes)} for fitting models."""
+    sizes = {}
+    with open(path, errors='replace') as f:
+        for row in csv.reader(f):
+            if not row or not row[0].endswith('CSV_ARENA'):
+                continue
+            # endswith() tolerates a log prefix glued to the tag
+            _, name, quantization, fits, used, minimum = row[:6]
+            if fits.strip() != '1':
+                print('warning: no arena size for %s (%s): unsupported or '
+                      'does not fit the configured arena'
+                      % (name, quantization), file=sys.stderr)
+                continue
+            sizes[(name, quantization)] = (int(used), int(minimum))
+    return sizes
+
+
+def round_up(value, multiple):
+    return (value + multiple - 1) // multiple * multiple
+
+
+def generate(sizes, headroom_pct):
+    lines = [
+        '// Generated by scripts/generate_arena_sizes.py - do not edit.',
+        '// Minimum tensor arena per model as measured on the target',
+    ]
+    if headroom_pct:
+        lines.append('// plus %d%% headroom' % headroom_pct)
+    lines += [
+        '',
+        '#ifndef MODEL_ARENA_SIZES_H_',
+        '#define MODEL_ARENA_SIZES_H_',
+        '',
+        '#include <stddef.h>',
+        '',
+    ]
+    largest = 0
+    for (name, quantization), (used, minimum) in sorted(sizes.items()):
+        size = round_up(minimum * (100 + headroom_pct) // 100, 16)
+        largest = max(largest, size)
+        lines.append('constexpr size_t k%sArenaSize = %d;  // arena_used_bytes() %d'
+                     % (model_identifier(name, quantization), size, used))
+    lines += [
+        '',
+        '// Enough for any single model above',
+        'constexpr size_t kMaxModelArenaSize = %d;' % largest,
+        '',
+        '#endif  // MODEL_ARENA_SIZES_H_',
+    ]
+    return '\n'.join(lines) + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('--output', required=True, help='header to write')
+    parser.add_argument('--headroom-pct', type=int, default=0,
+                        help='extra arena on top of the measured minimum')
+    parser.add_argument('log', help='serial log containing CSV_ARENA lines')
+    args = parser.parse_args()
+
+    sizes = parse_log(args.log)
+    if not sizes:
+        raise SystemExit('%s: no CSV_ARENA lines for fitting models '
+                         '(is kEnableArenaSizing set?)' % args.log)
+    with open(args.output, 'w') as f:
+        f.write(generate(sizes, args.headroom_pct))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -85,7 +85,8 @@ print(f"Int8 model saved: {len(tflite_model_int8)} bytes")
 def convert_to_c_array(tflite_model, var_name, output_file):
     with open(output_file, 'w') as f:
         f.write('#include "model.h"\n\n')
-        f.write(f'alignas(8) const unsigned char {var_name}[] = {{\n')
+        # 16 bytes: the packed weight blocks are aligned to it in the flatbuffer
+        f.write(f'alignas(16) const unsigned char {var_name}[] = {{\n')
         
         hex_array = [f'0x{byte:02x}' for byte in tflite_model]
         
@@ -99,4 +100,24 @@ def convert_to_c_array(tflite_model, var_name, output_file):
     print(f"C array saved: {output_file}")
 
 convert_to_c_array(tflite_model_float32, 'g_cnn_model_float32', 'cnn_model_float32.cpp')
-convert_to_c_array(tflite_model_int8, 'g_cnn_model_int8', 'cnn_model_int8.cpp')
\ No newline at end of file
+# int8 weights also pre-packed for the packed CONV_2D/FULLY_CONNECTED kernels
+from pack_weights import pack
+
+convert_to_c_array(pack(tflite_model_int8)[0], 'g_cnn_model_int8', 'cnn_model_int8.cpp')
+
+# Fixed batch-N variants: same weights, batch dimension patched in place
+from make_batched_model import make_batched
+
+for batch in (2, 4, 8):
+    convert_to_c_array(make_batched(tflite_model_float32, batch),
+                       f'g_cnn_b{batch}_model_float32', f'cnn_b{batch}_model_float32.cpp')
+    convert_to_c_array(pack(make_batched(tflite_model_int8, batch))[0],
+                       f'g_cnn_b{batch}_model_int8', f'cnn_b{batch}_model_int8.cpp')
+
+# CONV_2D + MAX_POOL_2D fused into the CONV_RELU_POOL custom op
+from fuse_conv_pool import fuse
+
+convert_to_c_array(fuse(tflite_model_float32)[0], 'g_cnn_fused_model_float32',
+                   'cnn_fused_model_float32.cpp')
+convert_to_c_array(fuse(tflite_model_int8)[0], 'g_cnn_fused_model_int8',
+                   'cnn_fused_model_int8.cpp')
\ No newline at end of file
@@ -0,0 +1,261 @@
+"""Generate a minimal TFLite Micro op resolver per model.
+
+Reads the operator_codes table of every model C array passed on the command
+line and emits a header with one exactly-sized MicroMutableOpResolver per
+model. Runs at build time from main/CMakeLists.txt.
+
+Ops with switchable kernels (KERNEL_BACKEND_OPS) are registered with the
+kernel KernelBackends currently selects (main/kernels/kernel_backends.h);
+each resolver rebuilds itself when that selection has changed.
+
+Builtin ops without a known TFLite Micro registration abort generation, so
+a model that cannot run fails the build rather than AllocateTensors().
+Models that need Flex (SELECT_TF_OPS) kernels can never run on TFLite Micro;
+they get a null resolver and the list of offending ops so the sweep can skip
+them with a clear message.
+
+Usage:
+    python generate_op_resolvers.py --output model_op_resolvers.h model.cpp...
+"""
+
+import argparse
+import os
+import sys
+
+from tflite_flatbuffer import load_model, read_c_array
+
+# BuiltinOperator -> MicroMutableOpResolver method
+MICRO_RESOLVER_METHODS = {
+    'ABS': 'AddAbs',
+    'ADD': 'AddAdd',
+    'ADD_N': 'AddAddN',
+    'ARG_MAX': 'AddArgMax',
+    'ARG_MIN': 'AddArgMin',
+    'ASSIGN_VARIABLE': 'AddAssignVariable',
+    'AVERAGE_POOL_2D': 'AddAveragePool2D',
+    'BATCH_MATMUL': 'AddBatchMatMul',
+    'BATCH_TO_SPACE_ND': 'AddBatchToSpaceNd',
+    'BROADCAST_ARGS': 'AddBroadcastArgs',
+    'BROADCAST_TO': 'AddBroadcastTo',
+    'CALL_ONCE': 'AddCallOnce',
+    'CAST': 'AddCast',
+    'CEIL': 'AddCeil',
+    'CONCATENATION': 'AddConcatenation',
+    'CONV_2D': 'AddConv2D',
+    'COS': 'AddCos',
+    'CUMSUM': 'AddCumSum',
+    'DEPTH_TO_SPACE': 'AddDepthToSpace',
+    'DEPTHWISE_CONV_2D': 'AddDepthwiseConv2D',
+    'DEQUANTIZE': 'AddDequantize',
+    'DIV': 'AddDiv',
+    'ELU': 'AddElu',
+    'EMBEDDING_LOOKUP': 'AddEmbeddingLookup',
+    'EQUAL': 'AddEqual',
+    'EXP': 'AddExp',
+    'EXPAND_DIMS': 'AddExpandDims',
+    'FILL': 'AddFill',
+    'FLOOR': 'AddFloor',
+    'FLOOR_DIV': 'AddFloorDiv',
+    'FLOOR_MOD': 'AddFloorMod',
+    'FULLY_CONNECTED': 'AddFullyConnected',
+    'GATHER': 'AddGather',
+    'GATHER_ND': 'AddGatherNd',
+    'GREATER': 'AddGreater',
+    'GREATER_EQUAL': 'AddGreaterEqual',
+    'HARD_SWISH': 'AddHardSwish',
+    'IF': 'AddIf',
+    'L2_NORMALIZATION': 'AddL2Normalization',
+    'L2_POOL_2D': 'AddL2Pool2D',
+    'LEAKY_RELU': 'AddLeakyRelu',
+    'LESS': 'AddLess',
+    'LESS_EQUAL': 'AddLessEqual',
+    'LOG': 'AddLog',
+    'LOG_SOFTMAX': 'AddLogSoftmax',
+    'LOGICAL_AND': 'AddLogicalAnd',
+    'LOGICAL_NOT': 'AddLogicalNot',
+    'LOGICAL_OR': 'AddLogicalOr',
+    'LOGISTIC': 'AddLogistic',
+    'MAX_POOL_2D': 'AddMaxPool2D',
+    'MAXIMUM': 'AddMaximum',
+    'MEAN': 'AddMean',
+    'MINIMUM': 'AddMinimum',
+    'MIRROR_PAD': 'AddMirrorPad',
+    'MUL': 'AddMul',
+    'NEG': 'AddNeg',
+    'NOT_EQUAL': 'AddNotEqual',
+    'PACK': 'AddPack',
+    'PAD': 'AddPad',
+    'PADV2': 'AddPadV2',
+    'PRELU': 'AddPrelu',
+    'QUANTIZE': 'AddQuantize',
+    'READ_VARIABLE': 'AddReadVariable',
+    'REDUCE_MAX': 'AddReduceMax',
+    'RELU': 'AddRelu',
+    'RELU6': 'AddRelu6',
+    'RESHAPE': 'AddReshape',
+    'RESIZE_BILINEAR': 'AddResizeBilinear',
+    'RESIZE_NEAREST_NEIGHBOR': 'AddResizeNearestNeighbor',
+    'ROUND': 'AddRound',
+    'RSQRT': 'AddRsqrt',
+    'SELECT_V2': 'AddSelectV2',
+    'SHAPE': 'AddShape',
+    'SIN': 'AddSin',
+    'SLICE': 'AddSlice',
+    'SOFTMAX': 'AddSoftmax',
+    'SPACE_TO_BATCH_ND': 'AddSpaceToBatchNd',
+    'SPACE_TO_DEPTH': 'AddSpaceToDepth',
+    'SPLIT': 'AddSplit',
+    'SPLIT_V': 'AddSplitV',
+    'SQRT': 'AddSqrt',
+    'SQUARE': 'AddSquare',
+    'SQUARED_DIFFERENCE': 'AddSquaredDifference',
+    'SQUEEZE': 'AddSqueeze',
+    'STRIDED_SLICE': 'AddStridedSlice',
+    'SUB': 'AddSub',
+    'SUM': 'AddSum',
+    'SVDF': 'AddSvdf',
+    'TANH': 'AddTanh',
+    'TRANSPOSE': 'AddTranspose',
+    'TRANSPOSE_CONV': 'AddTransposeConv',
+    'UNIDIRECTIONAL_SEQUENCE_LSTM': 'AddUnidirectionalSequenceLSTM',
+    'UNPACK': 'AddUnpack',
+    'VAR_HANDLE': 'AddVarHandle',
+    'WHILE': 'AddWhile',
+    'ZEROS_LIKE': 'AddZerosLike',
+}
+
+# Builtin ops with a runtime-selectable kernel -> KernelOp
+KERNEL_BACKEND_OPS = {
+    'CONV_2D': 'KernelOp::CONV_2D',
+    'FULLY_CONNECTED': 'KernelOp::FULLY_CONNECTED',
+    'MAX_POOL_2D': 'KernelOp::MAX_POOL_2D',
+    'UNIDIRECTIONAL_SEQUENCE_LSTM': 'KernelOp::UNIDIRECTIONAL_SEQUENCE_LSTM',
+}
+
+# Project-local custom ops: custom_code -> (header, registration function)
+CUSTOM_OP_REGISTRATIONS = {
+    'CONV_RELU_POOL': ('conv_relu_pool.h', 'RegisterConvReluPool'),
+}
+
+
+def cpp_identifier(array_name):
+    """g_cnn_model_int8 -> CnnModelInt8"""
+    name = array_name[2:] if array_name.startswith('g_') else array_name
+    return ''.join(part.capitalize() for part in name.split('_'))
+
+
+def model_ops(path):
+    """Return (builtin ops, custom ops, unsupported ops) for one model."""
+    model = load_model(path)
+    builtins, customs, unsupported = [], [], []
+    for builtin, custom_code, _ in model.operator_codes():
+        if builtin == 'CUSTOM':
+            if custom_code in CUSTOM_OP_REGISTRATIONS:
+                if custom_code not in customs:
+                    customs.append(custom_code)
+            elif custom_code.startswith('Flex'):
+                if custom_code not in unsupported:
+                    unsupported.append(custom_code)
+            else:
+                raise SystemExit('%s: custom op %s has no registration in '
+                                 'CUSTOM_OP_REGISTRATIONS' % (path, custom_code))
+        elif builtin not in MICRO_RESOLVER_METHODS:
+            raise SystemExit('%s: builtin op %s is not available in TFLite Micro'
+                             % (path, builtin))
+        elif builtin not in builtins:
+            builtins.append(builtin)
+    return builtins, customs, unsupported
+
+
+def generate(model_paths):
+    lines = [
+        '// Generated by scripts/generate_op_resolvers.py - do not edit.',
+        '// One resolver per model, registering exactly the ops in its',
+        '// operator_codes table.',
+        '',
+        '#ifndef MODEL_OP_RESOLVERS_H_',
+        '#define MODEL_OP_RESOLVERS_H_',
+        '',
+        '#include <stdint.h>',
+        '',
+        '#include <new>',
+        '',
+        '#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"',
+        '#include "kernel_backends.h"',
+    ]
+    headers = sorted({CUSTOM_OP_REGISTRATIONS[c][0]
+                      for path in model_paths for c in model_ops(path)[1]})
+    lines += ['#include "%s"' % header for header in headers]
+    lines.append('')
+
+    for path in model_paths:
+        array_name, _ = read_c_array(path)
+        ident = cpp_identifier(array_name)
+        builtins, customs, unsupported = model_ops(path)
+        op_count = len(builtins) + len(customs)
+
+        lines.append('// %s: %s' % (os.path.basename(path),
+                                    ', '.join(builtins + customs + unsupported)))
+        if unsupported:
+            lines += [
+                'constexpr const char* k%sUnsupportedOps = "%s";' % (
+                    ident, ' '.join(unsupported)),
+                'inline const tflite::MicroOpResolver* Get%sOpResolver() {' % ident,
+                '  return nullptr;  // Needs Flex kernels, not runnable on TFLite Micro',
+                '}',
+                '',
+            ]
+            continue
+
+        lines += [
+            'constexpr const char* k%sUnsupportedOps = nullptr;' % ident,
+            'constexpr int k%sOpCount = %d;' % (ident, op_count),
+            'inline const tflite::MicroOpResolver* Get%sOpResolver() {' % ident,
+            '  static tflite::MicroMutableOpResolver<k%sOpCount> resolver;' % ident,
+            '  static uint32_t generation = 0;  // Kernel selection it was filled for',
+            '  if (generation != KernelBackends::generation()) {',
+            '    resolver.~MicroMutableOpResolver();',
+            '    new (&resolver) tflite::MicroMutableOpResolver<k%sOpCount>();' % ident,
+        ]
+        for builtin in builtins:
+            if builtin in KERNEL_BACKEND_OPS:
+                lines.append('    if (resolver.%s(KernelBackends::Registration(%s)) != kTfLiteOk) '
+                             'return nullptr;' % (MICRO_RESOLVER_METHODS[builtin],
+                                                  KERNEL_BACKEND_OPS[builtin]))
+            else:
+                lines.append('    if (resolver.%s() != kTfLiteOk) return nullptr;'
+                             % MICRO_RESOLVER_METHODS[builtin])
+        for custom in customs:
+            lines.append('    if (resolver.AddCustom("%s", %s()) != kTfLiteOk) return nullptr;'
+                         % (custom, CUSTOM_OP_REGISTRATIONS[custom][1]))
+        lines += [
+            '    generation = KernelBackends::generation();',
+            '  }',
+            '  return &resolver;',
+            '}',
+            '',
+        ]
+
+    lines.append('#endif  // MODEL_OP_RESOLVERS_H_')
+    return '\n'.join(lines) + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('--output', required=True, help='header to write')
+    parser.add_argument('models', nargs='+', help='model .cpp C arrays or .tflite files')
+    args = parser.parse_args()
+
+    header = generate(args.models)
+    # Only touch the file when it changes to avoid needless rebuilds
+    if os.path.exists(args.output):
+        with open(args.output) as f:
+            if f.read() == header:
+                return 0
+    with open(args.output, 'w') as f:
+        f.write(header)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -95,5 +95,12 @@ def convert_to_c_array(tflite_model, var_name, output_file):
     
     print(f"C array saved: {output_file}")
 
-convert_to_c_array(tflite_model_float32, 'g_rnn_model_float32', 'rnn_model_float32.cpp')
-convert_to_c_array(tflite_model_int8, 'g_rnn_model_int8', 'rnn_model_int8.cpp')
\ No newline at end of file
+convert_to_c_array(tflite_model_int8, 'g_rnn_model_int8', 'rnn_model_int8.cpp')
+
+# The float32 export needs Flex kernels; lower it to the builtin
+# UNIDIRECTIONAL_SEQUENCE_LSTM op in full-sequence and streaming variants
+# (rnn_model_float32.cpp, rnn_stream_model_float32.cpp)
+import subprocess
+import sys
+subprocess.run([sys.executable, 'make_lstm_models.py',
+                'rnn_model_float32.tflite', '.'], check=True)
\ No newline at end of file
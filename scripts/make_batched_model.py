@@ -0,0 +1,122 @@
+"""Derive a fixed batch-N variant of a batch-1 TFLite model.
+
+TFLite Micro never resizes tensors; every kernel takes its shapes from the
+flatbuffer. A batch-N model is therefore the batch-1 model with the batch
+dimension of each activation tensor set to N (and any RESHAPE target that
+pins batch 1 updated). Weights, quantization and the byte layout are
+unchanged, so the patch is done in place on the serialized model.
+
+The batch dimension is taken from shape_signature (-1 marks the dynamic
+batch the converter saw) and falls back to a leading 1 on non-constant
+tensors for models exported without signatures. Only ops known to be
+batch-agnostic are accepted; anything else aborts.
+
+Usage:
+    python make_batched_model.py --batch 4 --var g_cnn_b4_model_int8 \\
+        --header model8.h cnn_model_int8.cpp cnn_b4_model_int8.cpp
+"""
+
+import argparse
+import struct
+import sys
+
+from tflite_flatbuffer import Model, Table, load_model, write_c_array
+
+# Ops whose kernels handle any leading batch dimension from tensor shapes
+BATCH_AGNOSTIC_OPS = {
+    'ADD', 'AVERAGE_POOL_2D', 'CONV_2D', 'DEPTHWISE_CONV_2D', 'DEQUANTIZE',
+    'FULLY_CONNECTED', 'LOGISTIC', 'MAX_POOL_2D', 'MUL', 'QUANTIZE', 'RELU',
+    'RELU6', 'RESHAPE', 'SOFTMAX', 'TANH',
+}
+
+# Flatbuffer field indices (tensorflow/lite/schema/schema.fbs)
+MODEL_SUBGRAPHS, MODEL_BUFFERS = 2, 4
+SUBGRAPH_TENSORS, SUBGRAPH_OPERATORS = 0, 3
+TENSOR_SHAPE, TENSOR_BUFFER, TENSOR_SHAPE_SIGNATURE = 0, 2, 7
+OPERATOR_OPCODE, OPERATOR_INPUTS = 0, 1
+OPERATOR_BUILTIN_OPTIONS = 4
+RESHAPE_OPTIONS_NEW_SHAPE = 0
+BUFFER_DATA = 0
+
+
+def _patch_leading_dim(buf, table, field, batch):
+    """Set element 0 of an int32 vector field (or int32 buffer) to batch if 1."""
+    start, length = table.vector(field)
+    if start is None or length == 0:
+        return False
+    if struct.unpack_from('<i', buf, start)[0] != 1:
+        return False
+    struct.pack_into('<i', buf, start, batch)
+    return True
+
+
+def make_batched(data, batch):
+    opcodes = Model(data).operator_codes()
+    buf = bytearray(data)
+    root = Table(buf, struct.unpack_from('<I', buf, 0)[0])
+    buffers = root.tables(MODEL_BUFFERS)
+
+    if len(root.tables(MODEL_SUBGRAPHS)) != 1:
+        raise SystemExit('only single-subgraph models can be batched')
+    subgraph = root.tables(MODEL_SUBGRAPHS)[0]
+    operators = subgraph.tables(SUBGRAPH_OPERATORS)
+    for op in operators:
+        name = opcodes[op.scalar(OPERATOR_OPCODE, 'I')][0]
+        if name not in BATCH_AGNOSTIC_OPS:
+            raise SystemExit('op %s is not known to be batch-agnostic' % name)
+
+    def is_constant(tensor):
+        index = tensor.scalar(TENSOR_BUFFER, 'I')
+        return index < len(buffers) and buffers[index].vector(BUFFER_DATA)[1] > 0
+
+    patched = 0
+    for tensor in subgraph.tables(SUBGRAPH_TENSORS):
+        if is_constant(tensor):
+            continue
+        signature = tensor.scalars(TENSOR_SHAPE_SIGNATURE, 'i')
+        shape = tensor.scalars(TENSOR_SHAPE, 'i')
+        if signature:
+            batched = signature[0] == -1 and shape and shape[0] == 1
+        else:
+            batched = len(shape) >= 2 and shape[0] == 1
+        if batched:
+            patched += _patch_leading_dim(buf, tensor, TENSOR_SHAPE, batch)
+
+    # RESHAPE targets that pin batch 1 (the converter usually emits -1)
+    tensors = subgraph.tables(SUBGRAPH_TENSORS)
+    for op in operators:
+        if opcodes[op.scalar(OPERATOR_OPCODE, 'I')][0] != 'RESHAPE':
+            continue
+        inputs = op.scalars(OPERATOR_INPUTS, 'i')
+        if len(inputs) > 1 and inputs[1] >= 0:
+            shape_buffer = buffers[tensors[inputs[1]].scalar(TENSOR_BUFFER, 'I')]
+            _patch_leading_dim(buf, shape_buffer, BUFFER_DATA, batch)
+        options = op.table(OPERATOR_BUILTIN_OPTIONS)
+        if options is not None:
+            _patch_leading_dim(buf, options, RESHAPE_OPTIONS_NEW_SHAPE, batch)
+
+    if patched == 0:
+        raise SystemExit('no batch dimension found')
+    return bytes(buf)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('--batch', type=int, required=True)
+    parser.add_argument('--var', required=True, help='C array name, e.g. g_cnn_b4_model_int8')
+    parser.add_argument('--header', default='model.h', help='header the .cpp includes')
+    parser.add_argument('--tflite', help='also write the batched .tflite here')
+    parser.add_argument('input', help='batch-1 model (.tflite or generated .cpp)')
+    parser.add_argument('output', help='generated .cpp to write')
+    args = parser.parse_args()
+
+    batched = make_batched(load_model(args.input).data, args.batch)
+    write_c_array(batched, args.var, args.output, args.header)
+    if args.tflite:
+        with open(args.tflite, 'wb') as f:
+            f.write(batched)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
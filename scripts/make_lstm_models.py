@@ -0,0 +1,189 @@
+"""Lower the Keras LSTM classifier to builtin TFLite Micro models.
+
+The converter exports Keras LSTM(16) -> Dense(8, relu) -> Dense(3, softmax)
+as a WHILE loop over Flex TensorList ops, which TFLite Micro cannot run.
+This script lifts the weights out of that export and rebuilds the network
+around the fused UNIDIRECTIONAL_SEQUENCE_LSTM builtin, in two variants:
+
+  full      [1, seq_len, 1] input, every Invoke() classifies a whole window
+            starting from zero state (the benchmark resets the state)
+  stream    [1, 1, 1] input, one timestep per Invoke(); hidden and cell
+            state are variable tensors that persist in the arena
+
+Float32 only: the int8 export keeps its float LSTM body between DEQUANTIZE
+and QUANTIZE, so there is no integer LSTM to lift out of it.
+
+Usage:
+    python make_lstm_models.py [--sequence-length N] [--tflite-dir DIR]
+        rnn_model_float32.tflite output_dir
+"""
+
+import argparse
+import os
+import sys
+
+from tflite_flatbuffer import ACTIVATIONS, ModelBuilder, load_model, write_c_array
+
+# Keras packs LSTM gates as [input, forget, cell, output] along the units axis
+GATES = ('input', 'forget', 'cell', 'output')
+
+
+def extract_weights(model):
+    """Return the LSTM kernels/bias and the two dense layers of the export."""
+    codes = [code[0] for code in model.operator_codes()]
+    main, _, body = model.subgraphs()[:3]
+
+    def fully_connected(subgraph):
+        return [op for op in subgraph.operators()
+                if codes[op['opcode_index']] == 'FULLY_CONNECTED']
+
+    # Loop body: FC(x_t, kernel) and FC(h_prev, recurrent), then ADD(bias)
+    tensors = body.tensors()
+    kernel = recurrent = bias = None
+    for op in fully_connected(body):
+        weights = op['inputs'][1]
+        if tensors[weights]['shape'][1] == 1:
+            kernel = weights
+        else:
+            recurrent = weights
+    for op in body.operators():
+        if codes[op['opcode_index']] != 'ADD':
+            continue
+        for index in op['inputs']:
+            if tensors[index]['buffer'] and len(tensors[index]['shape']) == 1:
+                bias = index
+    if None in (kernel, recurrent, bias):
+        raise SystemExit('LSTM weights not found in the WHILE body')
+
+    units = tensors[recurrent]['shape'][1]
+    lstm = {
+        'units': units,
+        'kernel': body.tensor_values(kernel),        # [4 * units, 1]
+        'recurrent': body.tensor_values(recurrent),  # [4 * units, units]
+        'bias': body.tensor_values(bias),            # [4 * units]
+    }
+
+    dense = []
+    main_tensors = main.tensors()
+    for op in fully_connected(main):
+        weights, dense_bias = op['inputs'][1], op['inputs'][2]
+        options = op['options']
+        dense.append({
+            'shape': main_tensors[weights]['shape'],
+            'weights': main.tensor_values(weights),
+            'bias': main.tensor_values(dense_bias),
+            'activation': ACTIVATIONS[options.scalar(0, 'b') if options else 0],
+        })
+    if len(dense) != 2:
+        raise SystemExit('expected two dense layers after the LSTM, found %d'
+                         % len(dense))
+    return lstm, dense
+
+
+def gate_rows(values, gate, rows, cols):
+    start = GATES.index(gate) * rows * cols
+    return values[start:start + rows * cols]
+
+
+def build(lstm, dense, timesteps, streaming):
+    builder = ModelBuilder()
+    units = lstm['units']
+
+    model_input = builder.tensor('input', [1, timesteps, 1])
+    lstm_inputs = [model_input]
+    for gate in GATES:
+        lstm_inputs.append(builder.constant(
+            'lstm/%s_kernel' % gate, [units, 1], 'FLOAT32',
+            gate_rows(lstm['kernel'], gate, units, 1)))
+    for gate in GATES:
+        lstm_inputs.append(builder.constant(
+            'lstm/%s_recurrent' % gate, [units, units], 'FLOAT32',
+            gate_rows(lstm['recurrent'], gate, units, units)))
+    lstm_inputs += [-1, -1, -1]  # No peephole connections
+    for gate in GATES:
+        lstm_inputs.append(builder.constant(
+            'lstm/%s_bias' % gate, [units], 'FLOAT32',
+            gate_rows(lstm['bias'], gate, units, 1)))
+    lstm_inputs += [-1, -1]  # No projection
+    lstm_inputs.append(builder.tensor('lstm/output_state', [1, units],
+                                      is_variable=True))
+    lstm_inputs.append(builder.tensor('lstm/cell_state', [1, units],
+                                      is_variable=True))
+    lstm_inputs += [-1, -1, -1, -1]  # No layer normalization
+
+    sequence = builder.tensor('lstm/sequence', [1, timesteps, units])
+    builder.operator('UNIDIRECTIONAL_SEQUENCE_LSTM', lstm_inputs, [sequence],
+                     'UnidirectionalSequenceLSTMOptions', {
+                         0: ('b', ACTIVATIONS.index('TANH')),
+                         1: ('f', 0.0),   # cell_clip
+                         2: ('f', 0.0),   # proj_clip
+                         3: ('B', 0),     # time_major
+                     })
+
+    if streaming:
+        # One timestep: FULLY_CONNECTED flattens [1, 1, units] by itself
+        features = sequence
+    else:
+        # Keras return_sequences=False keeps only the last timestep
+        features = builder.tensor('lstm/last', [1, units])
+        builder.operator('STRIDED_SLICE', [
+            sequence,
+            builder.constant('lstm/last/begin', [3], 'INT32', [0, timesteps - 1, 0]),
+            builder.constant('lstm/last/end', [3], 'INT32', [1, timesteps, units]),
+            builder.constant('lstm/last/strides', [3], 'INT32', [1, 1, 1]),
+        ], [features], 'StridedSliceOptions', {4: ('i', 2)})  # shrink_axis_mask
+
+    for i, layer in enumerate(dense):
+        outputs, depth = layer['shape']
+        weights = builder.constant('dense_%d/weights' % i, [outputs, depth],
+                                   'FLOAT32', layer['weights'])
+        bias = builder.constant('dense_%d/bias' % i, [outputs], 'FLOAT32',
+                                layer['bias'])
+        result = builder.tensor('dense_%d' % i, [1, outputs])
+        builder.operator('FULLY_CONNECTED', [features, weights, bias], [result],
+                         'FullyConnectedOptions',
+                         {0: ('b', ACTIVATIONS.index(layer['activation']))})
+        features = result
+
+    probabilities = builder.tensor('probabilities', [1, dense[-1]['shape'][0]])
+    builder.operator('SOFTMAX', [features], [probabilities],
+                     'SoftmaxOptions', {0: ('f', 1.0)})
+    description = ('LSTM classifier, %s' % ('streaming, 1 timestep per Invoke'
+                                           if streaming else
+                                           '%d timesteps per Invoke' % timesteps))
+    return builder.build([model_input], [probabilities], description)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('--sequence-length', type=int, default=10,
+                        help='timesteps of the full-sequence model')
+    parser.add_argument('--tflite-dir', help='also write .tflite files here')
+    parser.add_argument('input', help='converter export (.tflite or model .cpp)')
+    parser.add_argument('output_dir', help='directory for the model .cpp files')
+    args = parser.parse_args()
+
+    model = load_model(args.input)
+    if len(model.subgraphs()) < 3:
+        raise SystemExit('%s: not a Keras LSTM WHILE-loop export' % args.input)
+    lstm, dense = extract_weights(model)
+
+    variants = [
+        ('g_rnn_model_float32', 'rnn_model_float32',
+         build(lstm, dense, args.sequence_length, streaming=False)),
+        ('g_rnn_stream_model_float32', 'rnn_stream_model_float32',
+         build(lstm, dense, 1, streaming=True)),
+    ]
+    for var_name, file_name, data in variants:
+        write_c_array(data, var_name,
+                      os.path.join(args.output_dir, file_name + '.cpp'),
+                      header='model32.h')
+        if args.tflite_dir:
+            with open(os.path.join(args.tflite_dir, file_name + '.tflite'), 'wb') as f:
+                f.write(data)
+        print('%s: %d bytes' % (file_name, len(data)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
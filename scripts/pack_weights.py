@@ -0,0 +1,160 @@
+"""Pre-pack int8 CONV_2D / FULLY_CONNECTED weights into a SIMD-friendly layout.
+
+Every constant int8 filter of a CONV_2D or FULLY_CONNECTED operator is
+copied, re-laid out, into one "PackedWeights" metadata buffer of the model
+(replace_metadata() places it 16-byte aligned). The canonical weights stay
+where they are, so the model still runs on any kernel; the packed kernels
+(main/kernels/packed_kernels.cpp) find their filter's packed copy by
+buffer index at Prepare() time.
+
+A filter is viewed as `channels` rows of `depth` int8s: [out, in] for
+FULLY_CONNECTED, [oc, kh * kw * ic] for CONV_2D (OHWI). Rows are grouped
+by PACKED_CHANNELS and each row split into blocks of PACKED_DEPTH, both
+zero-padded, and stored group by group, block by block, with the group's
+rows interleaved inside a block:
+
+    byte[(g * blocks + b) * 64 + r * 16 + i] = W[g * 4 + r][b * 16 + i]
+
+so one 16-byte input vector meets four consecutive, aligned 16-byte
+weight vectors and the inner loop needs no tail handling.
+
+The payload is little-endian int32s, then the blocks:
+
+    version (1), count,
+    count x (buffer index, channels, depth, offset of the blocks),
+    blocks, each entry starting 16-byte aligned
+
+Only per-channel or per-tensor int8 filters with zero point 0 and the
+default FULLY_CONNECTED weights format are packed; a buffer shared by
+several operators is packed once. Models that need Flex kernels are
+refused: they never run on TFLite Micro (generate_op_resolvers.py), so the
+copy would only cost flash.
+
+Usage:
+    python pack_weights.py --var g_cnn_model_int8 --header model8.h \\
+        cnn_model_int8.cpp cnn_model_int8.cpp
+"""
+
+import argparse
+import struct
+import sys
+
+from tflite_flatbuffer import Model, load_model, replace_metadata, write_c_array
+
+METADATA_NAME = 'PackedWeights'
+VERSION = 1
+PACKED_CHANNELS = 4  # kPackedChannels in main/kernels/packed_weights.h
+PACKED_DEPTH = 16    # kPackedDepth
+ENTRY_FORMAT = '<4i'
+
+# Flatbuffer field indices (tensorflow/lite/schema/schema.fbs)
+SUBGRAPH_OPERATORS, OPERATOR_OPTIONS = 3, 4
+FC_WEIGHTS_FORMAT, FC_WEIGHTS_DEFAULT = 1, 0
+FILTER_INPUT = 1
+
+
+class PackError(Exception):
+    pass
+
+
+def _round_up(value, multiple):
+    return (value + multiple - 1) // multiple * multiple
+
+
+def pack_filter(values, channels, depth):
+    """Packed blocks of a [channels, depth] int8 filter given as bytes."""
+    groups = _round_up(channels, PACKED_CHANNELS) // PACKED_CHANNELS
+    blocks = _round_up(depth, PACKED_DEPTH) // PACKED_DEPTH
+    packed = bytearray(groups * blocks * PACKED_CHANNELS * PACKED_DEPTH)
+    pos = 0
+    for g in range(groups):
+        for b in range(blocks):
+            for r in range(PACKED_CHANNELS):
+                row = g * PACKED_CHANNELS + r
+                if row < channels:
+                    start = row * depth + b * PACKED_DEPTH
+                    chunk = values[start:min(start + PACKED_DEPTH, (row + 1) * depth)]
+                    packed[pos:pos + len(chunk)] = chunk
+                pos += PACKED_DEPTH
+    return bytes(packed)
+
+
+def find_filters(model):
+    """{buffer index: (channels, depth)} of the filters to pack."""
+    codes = model.operator_codes()
+    filters = {}
+    for subgraph, table in zip(model.subgraphs(), model.root.tables(2)):
+        tensors = subgraph.tensors()
+        op_tables = table.tables(SUBGRAPH_OPERATORS)
+        for op, op_table in zip(subgraph.operators(), op_tables):
+            name = codes[op['opcode_index']][0]
+            if name not in ('CONV_2D', 'FULLY_CONNECTED') or len(op['inputs']) < 2:
+                continue
+            if name == 'FULLY_CONNECTED':
+                options = op_table.table(OPERATOR_OPTIONS)
+                if options and options.scalar(FC_WEIGHTS_FORMAT, 'b') != FC_WEIGHTS_DEFAULT:
+                    continue
+            filt = tensors[op['inputs'][FILTER_INPUT]]
+            shape = filt['shape']
+            if (filt['type'] != 'INT8' or not filt['buffer'] or len(shape) < 2 or
+                    any(zp != 0 for zp in filt['zero_point'])):
+                continue
+            channels = shape[0]
+            depth = 1
+            for dim in shape[1:]:
+                depth *= dim
+            if len(model.buffer_data(filt['buffer'])) != channels * depth:
+                continue
+            filters[filt['buffer']] = (channels, depth)
+    return filters
+
+
+def pack(data):
+    """Return (model bytes with the PackedWeights metadata, filters packed)."""
+    model = Model(data)
+    if METADATA_NAME in model.metadata():
+        raise PackError('model already carries packed weights')
+    flex = sorted({custom_code for _, custom_code, _ in model.operator_codes()
+                   if custom_code and custom_code.startswith('Flex')})
+    if flex:
+        raise PackError('needs Flex kernels (%s), not runnable on TFLite Micro'
+                        % ' '.join(flex))
+    filters = find_filters(model)
+    if not filters:
+        raise PackError('no int8 CONV_2D / FULLY_CONNECTED filter to pack')
+
+    header_size = _round_up(8 + struct.calcsize(ENTRY_FORMAT) * len(filters), 16)
+    entries, blocks = [], bytearray()
+    for buffer, (channels, depth) in sorted(filters.items()):
+        offset = header_size + len(blocks)
+        entries.append(struct.pack(ENTRY_FORMAT, buffer, channels, depth, offset))
+        blocks += pack_filter(model.buffer_data(buffer), channels, depth)
+
+    header = struct.pack('<2i', VERSION, len(filters)) + b''.join(entries)
+    payload = header + bytes(header_size - len(header)) + bytes(blocks)
+    return replace_metadata(data, METADATA_NAME, payload), len(filters)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('--var', required=True, help='C array name, e.g. g_cnn_model_int8')
+    parser.add_argument('--header', default='model.h', help='header the .cpp includes')
+    parser.add_argument('--tflite', help='also write the packed .tflite here')
+    parser.add_argument('input', help='model to pack (.tflite or generated .cpp)')
+    parser.add_argument('output', help='generated .cpp to write (may be the input)')
+    args = parser.parse_args()
+
+    try:
+        packed, count = pack(load_model(args.input).data)
+    except PackError as e:
+        raise SystemExit('%s: %s' % (args.input, e))
+    print('%s: %d filter(s) packed, %d bytes' % (args.input, count, len(packed)))
+    write_c_array(packed, args.var, args.output, args.header)
+    if args.tflite:
+        with open(args.tflite, 'wb') as f:
+            f.write(packed)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
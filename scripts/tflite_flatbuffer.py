@@ -0,0 +1,514 @@
+"""Minimal TFLite flatbuffer reader and writer (standard library only).
+
+Used by the build-time generators, which must run inside the ESP-IDF Python
+environment where TensorFlow and the flatbuffers package are not installed.
+Only the parts of the schema the benchmark tooling needs are exposed.
+"""
+
+import re
+import struct
+
+# BuiltinOperator enum from tensorflow/lite/schema/schema.fbs
+BUILTIN_OPERATORS = [
+    'ADD', 'AVERAGE_POOL_2D', 'CONCATENATION', 'CONV_2D', 'DEPTHWISE_CONV_2D',
+    'DEPTH_TO_SPACE', 'DEQUANTIZE', 'EMBEDDING_LOOKUP', 'FLOOR',
+    'FULLY_CONNECTED', 'HASHTABLE_LOOKUP', 'L2_NORMALIZATION', 'L2_POOL_2D',
+    'LOCAL_RESPONSE_NORMALIZATION', 'LOGISTIC', 'LSH_PROJECTION', 'LSTM',
+    'MAX_POOL_2D', 'MUL', 'RELU', 'RELU_N1_TO_1', 'RELU6', 'RESHAPE',
+    'RESIZE_BILINEAR', 'RNN', 'SOFTMAX', 'SPACE_TO_DEPTH', 'SVDF', 'TANH',
+    'CONCAT_EMBEDDINGS', 'SKIP_GRAM', 'CALL', 'CUSTOM',
+    'EMBEDDING_LOOKUP_SPARSE', 'PAD', 'UNIDIRECTIONAL_SEQUENCE_RNN', 'GATHER',
+    'BATCH_TO_SPACE_ND', 'SPACE_TO_BATCH_ND', 'TRANSPOSE', 'MEAN', 'SUB',
+    'DIV', 'SQUEEZE', 'UNIDIRECTIONAL_SEQUENCE_LSTM', 'STRIDED_SLICE',
+    'BIDIRECTIONAL_SEQUENCE_RNN', 'EXP', 'TOPK_V2', 'SPLIT', 'LOG_SOFTMAX',
+    'DELEGATE', 'BIDIRECTIONAL_SEQUENCE_LSTM', 'CAST', 'PRELU', 'MAXIMUM',
+    'ARG_MAX', 'MINIMUM', 'LESS', 'NEG', 'PADV2', 'GREATER', 'GREATER_EQUAL',
+    'LESS_EQUAL', 'SELECT', 'SLICE', 'SIN', 'TRANSPOSE_CONV',
+    'SPARSE_TO_DENSE', 'TILE', 'EXPAND_DIMS', 'EQUAL', 'NOT_EQUAL', 'LOG',
+    'SUM', 'SQRT', 'RSQRT', 'SHAPE', 'POW', 'ARG_MIN', 'FAKE_QUANT',
+    'REDUCE_PROD', 'REDUCE_MAX', 'PACK', 'LOGICAL_OR', 'ONE_HOT',
+    'LOGICAL_AND', 'LOGICAL_NOT', 'UNPACK', 'REDUCE_MIN', 'FLOOR_DIV',
+    'REDUCE_ANY', 'SQUARE', 'ZEROS_LIKE', 'FILL', 'FLOOR_MOD', 'RANGE',
+    'RESIZE_NEAREST_NEIGHBOR', 'LEAKY_RELU', 'SQUARED_DIFFERENCE',
+    'MIRROR_PAD', 'ABS', 'SPLIT_V', 'UNIQUE', 'CEIL', 'REVERSE_V2', 'ADD_N',
+    'GATHER_ND', 'COS', 'WHERE', 'RANK', 'ELU', 'REVERSE_SEQUENCE',
+    'MATRIX_DIAG', 'QUANTIZE', 'MATRIX_SET_DIAG', 'ROUND', 'HARD_SWISH', 'IF',
+    'WHILE', 'NON_MAX_SUPPRESSION_V4', 'NON_MAX_SUPPRESSION_V5', 'SCATTER_ND',
+    'SELECT_V2', 'DENSIFY', 'SEGMENT_SUM', 'BATCH_MATMUL',
+    'PLACEHOLDER_FOR_GREATER_OP_CODES', 'CUMSUM', 'CALL_ONCE', 'BROADCAST_TO',
+    'RFFT2D', 'CONV_3D', 'IMAG', 'REAL', 'COMPLEX_ABS', 'HASHTABLE',
+    'HASHTABLE_FIND', 'HASHTABLE_IMPORT', 'HASHTABLE_SIZE', 'REDUCE_ALL',
+    'CONV_3D_TRANSPOSE', 'VAR_HANDLE', 'READ_VARIABLE', 'ASSIGN_VARIABLE',
+    'BROADCAST_ARGS', 'RANDOM_STANDARD_NORMAL', 'BUCKETIZE', 'RANDOM_UNIFORM',
+    'MULTINOMIAL', 'GELU', 'DYNAMIC_UPDATE_SLICE', 'RELU_0_TO_1',
+    'UNSORTED_SEGMENT_PROD', 'UNSORTED_SEGMENT_MAX', 'UNSORTED_SEGMENT_SUM',
+    'ATAN2', 'UNSORTED_SEGMENT_MIN', 'SIGN', 'BITCAST', 'BITWISE_XOR',
+    'RIGHT_SHIFT',
+]
+
+# TensorType enum
+TENSOR_TYPES = [
+    'FLOAT32', 'FLOAT16', 'INT32', 'UINT8', 'INT64', 'STRING', 'BOOL',
+    'INT16', 'COMPLEX64', 'INT8', 'FLOAT64', 'COMPLEX128', 'UINT64',
+    'RESOURCE', 'VARIANT', 'UINT32', 'UINT16', 'INT4',
+]
+
+TENSOR_TYPE_SIZES = {
+    'FLOAT32': 4, 'FLOAT16': 2, 'INT32': 4, 'UINT8': 1, 'INT64': 8,
+    'BOOL': 1, 'INT16': 2, 'INT8': 1, 'FLOAT64': 8, 'UINT64': 8,
+    'UINT32': 4, 'UINT16': 2,
+}
+
+
+def builtin_name(code):
+    if 0 <= code < len(BUILTIN_OPERATORS):
+        return BUILTIN_OPERATORS[code]
+    return 'BUILTIN_%d' % code
+
+
+class Table:
+    """Read-only view of one flatbuffer table."""
+
+    def __init__(self, buf, pos):
+        self.buf = buf
+        self.pos = pos
+        self.vtable = pos - struct.unpack_from('<i', buf, pos)[0]
+        self.vtable_len = struct.unpack_from('<H', buf, self.vtable)[0]
+
+    def _field_offset(self, index):
+        entry = 4 + 2 * index
+        if entry >= self.vtable_len:
+            return 0
+        return struct.unpack_from('<H', self.buf, self.vtable + entry)[0]
+
+    def has(self, index):
+        return self._field_offset(index) != 0
+
+    def scalar(self, index, fmt, default=0):
+        offset = self._field_offset(index)
+        if not offset:
+            return default
+        return struct.unpack_from('<' + fmt, self.buf, self.pos + offset)[0]
+
+    def _indirect(self, index):
+        offset = self._field_offset(index)
+        if not offset:
+            return None
+        field = self.pos + offset
+        return field + struct.unpack_from('<I', self.buf, field)[0]
+
+    def table(self, index):
+        pos = self._indirect(index)
+        return Table(self.buf, pos) if pos is not None else None
+
+    def ref(self, index):
+        """Ref to the table, vector or string a field points at, for reusing
+        it as is in serialize(tail=...); None when the field is absent."""
+        pos = self._indirect(index)
+        return Ref(pos) if pos is not None else None
+
+    def field_count(self):
+        return (self.vtable_len - 4) // 2
+
+    def vector(self, index):
+        """(start, length) of a vector field, or (None, 0)."""
+        pos = self._indirect(index)
+        if pos is None:
+            return None, 0
+        return pos + 4, struct.unpack_from('<I', self.buf, pos)[0]
+
+    def tables(self, index):
+        start, length = self.vector(index)
+        result = []
+        for i in range(length):
+            element = start + 4 * i
+            result.append(Table(self.buf, element +
+                                struct.unpack_from('<I', self.buf, element)[0]))
+        return result
+
+    def scalars(self, index, fmt):
+        start, length = self.vector(index)
+        if start is None:
+            return []
+        return list(struct.unpack_from('<%d%s' % (length, fmt), self.buf, start))
+
+    def bytes(self, index):
+        start, length = self.vector(index)
+        if start is None:
+            return b''
+        return bytes(self.buf[start:start + length])
+
+    def string(self, index):
+        start, length = self.vector(index)
+        if start is None:
+            return None
+        return bytes(self.buf[start:start + length]).decode('utf-8')
+
+
+class Model:
+    """Convenience accessors over the root Model table."""
+
+    def __init__(self, data):
+        self.data = bytes(data)
+        if self.data[4:8] != b'TFL3':
+            raise ValueError('not a TFLite flatbuffer (missing TFL3 identifier)')
+        self.root = Table(self.data, struct.unpack_from('<I', self.data, 0)[0])
+
+    @property
+    def version(self):
+        return self.root.scalar(0, 'I')
+
+    def operator_codes(self):
+        """List of (builtin_name, custom_code or None, version)."""
+        codes = []
+        for code in self.root.tables(1):
+            # builtin_code (field 3) supersedes deprecated_builtin_code
+            builtin = max(code.scalar(0, 'b'), code.scalar(3, 'i'))
+            codes.append((builtin_name(builtin), code.string(1),
+                          code.scalar(2, 'i', 1)))
+        return codes
+
+    def subgraphs(self):
+        return [SubGraph(self, table) for table in self.root.tables(2)]
+
+    def buffer_data(self, index):
+        buffers = self.root.tables(4)
+        return buffers[index].bytes(0) if index < len(buffers) else b''
+
+    def metadata(self):
+        """Dict of metadata name -> buffer index."""
+        return {entry.string(0): entry.scalar(1, 'I')
+                for entry in self.root.tables(6)}
+
+
+class SubGraph:
+    def __init__(self, model, table):
+        self.model = model
+        self.table = table
+
+    def tensors(self):
+        result = []
+        for tensor in self.table.tables(0):
+            quantization = tensor.table(4)
+            type_index = tensor.scalar(1, 'b')
+            result.append({
+                'name': tensor.string(3) or '',
+                'shape': tensor.scalars(0, 'i'),
+                'type': TENSOR_TYPES[type_index],
+                'buffer': tensor.scalar(2, 'I'),
+                'is_variable': bool(tensor.scalar(5, 'B')),
+                'scale': quantization.scalars(2, 'f') if quantization else [],
+                'zero_point': quantization.scalars(3, 'q') if quantization else [],
+            })
+        return result
+
+    def inputs(self):
+        return self.table.scalars(1, 'i')
+
+    def outputs(self):
+        return self.table.scalars(2, 'i')
+
+    def operators(self):
+        """List of dicts with opcode_index, inputs, outputs, intermediates
+        and the builtin options table (None when absent)."""
+        return [{
+            'opcode_index': op.scalar(0, 'I'),
+            'inputs': op.scalars(1, 'i'),
+            'outputs': op.scalars(2, 'i'),
+            'intermediates': op.scalars(8, 'i'),
+            'options': op.table(4),
+        } for op in self.table.tables(3)]
+
+    def tensor_values(self, index):
+        """Constant data of a FLOAT32/INT32 tensor as a flat list."""
+        tensor = self.tensors()[index]
+        data = self.model.buffer_data(tensor['buffer'])
+        fmt = {'FLOAT32': 'f', 'INT32': 'i'}[tensor['type']]
+        return list(struct.unpack('<%d%s' % (len(data) // 4, fmt), data))
+
+
+# BuiltinOptions union members used by ModelBuilder callers
+BUILTIN_OPTIONS = {
+    'FullyConnectedOptions': 8,
+    'SoftmaxOptions': 9,
+    'ReshapeOptions': 17,
+    'StridedSliceOptions': 32,
+    'UnidirectionalSequenceLSTMOptions': 71,
+}
+
+# ActivationFunctionType enum
+ACTIVATIONS = ['NONE', 'RELU', 'RELU_N1_TO_1', 'RELU6', 'TANH', 'SIGN_BIT']
+
+
+class Vector:
+    """Vector of scalars for the writer, e.g. Vector('i', [1, 8])."""
+
+    def __init__(self, fmt, values, alignment=4):
+        self.fmt = fmt
+        self.values = list(values)
+        self.alignment = max(alignment, struct.calcsize(fmt))
+
+
+class Object:
+    """Table for the writer: {field index: value}.
+
+    Values are (fmt, scalar) tuples, str, Vector, Object, Ref or a list of
+    Objects/Refs (vector of tables).
+    """
+
+    def __init__(self, fields):
+        self.fields = {k: v for k, v in fields.items() if v is not None}
+
+
+class Ref:
+    """Reference to an object at `pos` in the `tail` passed to serialize(),
+    e.g. a table or vector of an existing model reused as is."""
+
+    def __init__(self, pos):
+        self.pos = pos
+
+
+def _pad_to(buf, alignment, offset=0):
+    while (len(buf) + offset) % alignment:
+        buf.append(0)
+
+
+class _Serializer:
+    """Lays objects out front to back: every referenced object is written
+    after the field that points to it, so all uoffsets are positive. The
+    vtable sits directly in front of its table. Not as compact as the
+    official back-to-front builder, but byte-for-byte valid."""
+
+    def __init__(self):
+        self.buf = bytearray()
+        self.refs = []  # (field position, Ref) resolved once the tail is placed
+
+    def _patch(self, field_pos, target_pos):
+        struct.pack_into('<I', self.buf, field_pos, target_pos - field_pos)
+
+    def _link(self, field_pos, value):
+        if isinstance(value, Ref):
+            self.refs.append((field_pos, value))
+        else:
+            self._patch(field_pos, self.place(value))
+
+    def place(self, value):
+        if isinstance(value, Object):
+            return self._table(value)
+        if isinstance(value, Vector):
+            _pad_to(self.buf, value.alignment, 4)
+            pos = len(self.buf)
+            self.buf += struct.pack('<I', len(value.values))
+            self.buf += struct.pack('<%d%s' % (len(value.values), value.fmt),
+                                    *value.values)
+            return pos
+        if isinstance(value, str):
+            _pad_to(self.buf, 4)
+            pos = len(self.buf)
+            data = value.encode('utf-8')
+            self.buf += struct.pack('<I', len(data)) + data + b'\0'
+            return pos
+        if isinstance(value, list):
+            _pad_to(self.buf, 4)
+            pos = len(self.buf)
+            self.buf += struct.pack('<I', len(value)) + bytes(4 * len(value))
+            for i, element in enumerate(value):
+                self._link(pos + 4 + 4 * i, element)
+            return pos
+        raise TypeError('cannot serialize %r' % (value,))
+
+    def _table(self, obj):
+        # Inline layout: soffset to vtable, then fields largest first so
+        # every scalar is naturally aligned inside an 8-aligned table
+        def size(value):
+            return struct.calcsize(value[0]) if isinstance(value, tuple) else 4
+        order = sorted(obj.fields, key=lambda k: (-size(obj.fields[k]), k))
+        offsets, cursor = {}, 4
+        for index in order:
+            field_size = size(obj.fields[index])
+            cursor = (cursor + field_size - 1) // field_size * field_size
+            offsets[index] = cursor
+            cursor += field_size
+        table_size = (cursor + 3) // 4 * 4
+
+        field_count = max(obj.fields) + 1 if obj.fields else 0
+        _pad_to(self.buf, 2)
+        vtable_pos = len(self.buf)
+        self.buf += struct.pack('<HH', 4 + 2 * field_count, table_size)
+        self.buf += struct.pack('<%dH' % field_count,
+                                *[offsets.get(i, 0) for i in range(field_count)])
+        _pad_to(self.buf, 8)
+        table_pos = len(self.buf)
+        self.buf += bytes(table_size)
+        struct.pack_into('<i', self.buf, table_pos, table_pos - vtable_pos)
+
+        children = []
+        for index, value in obj.fields.items():
+            if isinstance(value, tuple):
+                struct.pack_into('<' + value[0], self.buf,
+                                 table_pos + offsets[index], value[1])
+            else:
+                children.append((table_pos + offsets[index], value))
+        for field_pos, value in children:
+            self._link(field_pos, value)
+        return table_pos
+
+
+def serialize(root, file_identifier=b'TFL3', tail=b''):
+    """Serialize a root Object into flatbuffer bytes.
+
+    `tail` is appended 16-byte aligned, so alignment inside it is kept, and
+    Refs resolve into it. Offsets only point forward, which is why reused
+    objects go after the new ones.
+    """
+    serializer = _Serializer()
+    serializer.buf += bytes(4) + file_identifier
+    serializer._patch(0, serializer.place(root))
+    if tail:
+        _pad_to(serializer.buf, 16)
+        tail_start = len(serializer.buf)
+        for field_pos, ref in serializer.refs:
+            serializer._patch(field_pos, tail_start + ref.pos)
+        serializer.buf += tail
+    elif serializer.refs:
+        raise ValueError('Ref without a tail to resolve it in')
+    return bytes(serializer.buf)
+
+
+# Model table fields holding offsets, by index; 0 (version) is the only scalar
+_MODEL_OFFSET_FIELDS = (1, 2, 3, 4, 5, 6, 7)
+
+
+def rewrite_root(data, fields):
+    """Return model bytes with the root Model table's `fields` replaced.
+
+    The new root and whatever the new fields hold are written in front of
+    the original model, which is kept byte for byte behind them; every
+    other field is referenced, not rewritten, so fields this module does
+    not know survive. Objects in `fields` may Ref into the original.
+    """
+    model = Model(data)
+    root = model.root
+    merged = {0: ('I', model.version)}
+    for index in _MODEL_OFFSET_FIELDS:
+        if index not in fields:
+            merged[index] = root.ref(index)
+    merged.update(fields)
+    return serialize(Object(merged), tail=model.data)
+
+
+def replace_metadata(data, name, payload):
+    """Return model bytes with metadata entry `name` holding `payload`.
+
+    Only the buffers and metadata vectors and the new entry are added (see
+    rewrite_root()). An existing entry of the same name is dropped from the
+    metadata vector (its buffer stays, unused).
+    """
+    root = Model(data).root
+    buffers = [Ref(table.pos) for table in root.tables(4)]
+    buffers.append(Object({0: Vector('B', payload, 16)}))
+    metadata = [Ref(entry.pos) for entry in root.tables(6)
+                if entry.string(0) != name]
+    metadata.append(Object({0: name, 1: ('I', len(buffers) - 1)}))
+    return rewrite_root(data, {4: buffers, 6: metadata})
+
+
+class ModelBuilder:
+    """Assemble a single-subgraph TFLite model from tensors and builtin ops.
+
+    Buffer 0 stays the empty sentinel; activations and variable tensors
+    point at it and are placed in the arena by the interpreter.
+    """
+
+    def __init__(self):
+        self.tensors = []
+        self.buffers = [b'']
+        self.operator_codes = []
+        self.operators = []
+
+    def tensor(self, name, shape, tensor_type='FLOAT32', is_variable=False):
+        return self._add_tensor(name, shape, tensor_type, 0, is_variable)
+
+    def constant(self, name, shape, tensor_type, values):
+        fmt = {'FLOAT32': 'f', 'INT32': 'i'}[tensor_type]
+        self.buffers.append(struct.pack('<%d%s' % (len(values), fmt), *values))
+        return self._add_tensor(name, shape, tensor_type, len(self.buffers) - 1, False)
+
+    def _add_tensor(self, name, shape, tensor_type, buffer, is_variable):
+        self.tensors.append(Object({
+            0: Vector('i', shape),
+            1: ('b', TENSOR_TYPES.index(tensor_type)),
+            2: ('I', buffer),
+            3: name,
+            5: ('B', 1) if is_variable else None,
+        }))
+        return len(self.tensors) - 1
+
+    def operator(self, builtin, inputs, outputs, options_type=None, options=None,
+                 version=1):
+        code = (BUILTIN_OPERATORS.index(builtin), version)
+        if code not in self.operator_codes:
+            self.operator_codes.append(code)
+        self.operators.append(Object({
+            0: ('I', self.operator_codes.index(code)),
+            1: Vector('i', inputs),
+            2: Vector('i', outputs),
+            3: ('B', BUILTIN_OPTIONS[options_type]) if options_type else None,
+            4: Object(options) if options_type else None,
+        }))
+
+    def build(self, inputs, outputs, description=''):
+        codes = [Object({
+            # deprecated_builtin_code saturates at 127 for newer ops
+            0: ('b', min(builtin, 127)),
+            2: ('i', version),
+            3: ('i', builtin),
+        }) for builtin, version in self.operator_codes]
+        subgraph = Object({
+            0: self.tensors,
+            1: Vector('i', inputs),
+            2: Vector('i', outputs),
+            3: self.operators,
+            4: 'main',
+        })
+        # Tensor data aligned to 16 bytes like the converter's output
+        buffers = [Object({0: Vector('B', data, 16) if data else None})
+                   for data in self.buffers]
+        return serialize(Object({
+            0: ('I', 3),
+            1: codes,
+            2: [subgraph],
+            3: description,
+            4: buffers,
+        }))
+
+
+def read_c_array(path):
+    """Return (variable name, model bytes) from a generated model .cpp file."""
+    with open(path) as f:
+        source = f.read()
+    match = re.search(r'unsigned char\s+(\w+)\[\]\s*=\s*\{(.*?)\};', source, re.S)
+    if not match:
+        raise ValueError('%s: no model C array found' % path)
+    values = re.findall(r'0x([0-9a-fA-F]{2})', match.group(2))
+    return match.group(1), bytes(int(v, 16) for v in values)
+
+
+def write_c_array(data, var_name, output_file, header='model.h'):
+    """Write model bytes as a C array in the layout of the model generators."""
+    with open(output_file, 'w') as f:
+        f.write('#include "%s"\n\n' % header)
+        f.write('alignas(16) const unsigned char %s[] = {\n' % var_name)
+        hex_array = ['0x%02x' % byte for byte in data]
+        for i in range(0, len(hex_array), 12):
+            f.write('    %s,\n' % ', '.join(hex_array[i:i + 12]))
+        f.write('};\n\n')
+        f.write('const int %s_len = %d;\n' % (var_name, len(data)))
+
+
+def load_model(path):
+    """Load a model from a .tflite file or a generated .cpp C array."""
+    if path.endswith('.tflite'):
+        with open(path, 'rb') as f:
+            return Model(f.read())
+    return Model(read_c_array(path)[1])
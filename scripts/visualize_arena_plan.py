@@ -0,0 +1,179 @@
+"""Chart the tensor arena plan of each model from a benchmark log.
+
+Parses the CSV_PLAN lines printed when kDumpArenaPlan is set in
+main/constants.h: one line per buffer the memory planner placed in the
+arena's non-persistent section, with its offset, size and the first and
+last operator using it. For every model this writes an SVG with operators
+on the x axis and arena offset on the y axis, so each buffer is a box
+spanning its lifetime, and prints a text summary:
+
+  planned   bytes the planner reserved (highest offset + size)
+  peak live most bytes alive during any one operator; no placement can
+            go below it without changing the graph
+  gaps      planned - peak live, lost to the placement itself
+
+A large gap points at the layout (offline planning can fix it); a large
+peak points at the graph, e.g. a wide layer whose input and output are
+alive together and could be split or reordered.
+
+Usage:
+    idf.py monitor | tee benchmark.log
+    python visualize_arena_plan.py benchmark.log --output-dir plans
+"""
+
+import argparse
+import csv
+import html
+import os
+import sys
+
+# SVG geometry
+OP_WIDTH = 60
+CHART_HEIGHT = 480
+MARGIN_LEFT, MARGIN_RIGHT, MARGIN_TOP, MARGIN_BOTTOM = 70, 220, 40, 40
+COLORS = ('#4e79a7', '#f28e2b', '#59a14f', '#76b7b2', '#edc948',
+          '#b07aa1', '#ff9da7', '#9c755f')
+SCRATCH_COLOR = '#bab0ac'
+
+
+def parse_log(path):
+    """Return {(name, quantization): [buffer dict, ...]} in buffer order."""
+    plans = {}
+    with open(path, errors='replace') as f:
+        for row in csv.reader(f):
+            if not row or not row[0].endswith('CSV_PLAN'):
+                continue
+            # endswith() tolerates a log prefix glued to the tag; tensor
+            # names may contain commas, so the name is everything left
+            (_, name, quantization, buffer, subgraph, tensor, offset, size,
+             first_op, last_op, offline) = row[:11]
+            plans.setdefault((name, quantization), []).append({
+                'buffer': int(buffer),
+                'subgraph': int(subgraph),
+                'tensor': int(tensor),
+                'offset': int(offset),
+                'bytes': int(size),
+                'first_op': int(first_op),
+                'last_op': int(last_op),
+                'offline': offline.strip() == '1',
+                'name': ','.join(row[11:]),
+            })
+    return plans
+
+
+def summarize(buffers):
+    planned = max((b['offset'] + b['bytes'] for b in buffers), default=0)
+    ops = max((b['last_op'] for b in buffers), default=-1) + 1
+    live = [sum(b['bytes'] for b in buffers if b['first_op'] <= op <= b['last_op'])
+            for op in range(ops)]
+    peak = max(live, default=0)
+    return {
+        'planned': planned,
+        'ops': ops,
+        'live': live,
+        'peak': peak,
+        'peak_op': live.index(peak) if live else 0,
+        'gaps': planned - peak,
+    }
+
+
+def label(b):
+    if b['tensor'] < 0:
+        return 'scratch #%d' % b['buffer']
+    return 't%d %s' % (b['tensor'], b['name'])
+
+
+def render_svg(title, buffers, summary):
+    ops = max(summary['ops'], 1)
+    planned = max(summary['planned'], 1)
+    width = MARGIN_LEFT + ops * OP_WIDTH + MARGIN_RIGHT
+    height = MARGIN_TOP + CHART_HEIGHT + MARGIN_BOTTOM
+    scale = CHART_HEIGHT / planned
+
+    def y(offset):
+        # Offset 0 at the bottom, like a memory map
+        return MARGIN_TOP + CHART_HEIGHT - offset * scale
+
+    out = ['<svg xmlns="http://www.w3.org/2000/svg" width="%d" height="%d" '
+           'font-family="sans-serif" font-size="11">' % (width, height),
+           '<text x="%d" y="20" font-size="14">%s: planned %d B, peak live %d B '
+           'at op %d, gaps %d B</text>' % (
+               MARGIN_LEFT, html.escape(title), summary['planned'],
+               summary['peak'], summary['peak_op'], summary['gaps'])]
+
+    # Axes and grid: one column per operator, offsets in quarters
+    out.append('<rect x="%d" y="%d" width="%d" height="%d" fill="none" stroke="#888"/>'
+               % (MARGIN_LEFT, MARGIN_TOP, ops * OP_WIDTH, CHART_HEIGHT))
+    for op in range(ops):
+        x = MARGIN_LEFT + op * OP_WIDTH
+        out.append('<text x="%d" y="%d" text-anchor="middle">op %d</text>'
+                   % (x + OP_WIDTH / 2, height - MARGIN_BOTTOM / 2, op))
+        if op:
+            out.append('<line x1="%d" y1="%d" x2="%d" y2="%d" stroke="#eee"/>'
+                       % (x, MARGIN_TOP, x, MARGIN_TOP + CHART_HEIGHT))
+    for quarter in range(5):
+        offset = planned * quarter // 4
+        out.append('<text x="%d" y="%.1f" text-anchor="end">%d</text>'
+                   % (MARGIN_LEFT - 6, y(offset) + 4, offset))
+
+    for i, b in enumerate(buffers):
+        x = MARGIN_LEFT + b['first_op'] * OP_WIDTH + 2
+        w = (b['last_op'] - b['first_op'] + 1) * OP_WIDTH - 4
+        top = y(b['offset'] + b['bytes'])
+        h = max(b['bytes'] * scale, 1)
+        color = SCRATCH_COLOR if b['tensor'] < 0 else COLORS[i % len(COLORS)]
+        out.append('<rect x="%d" y="%.1f" width="%d" height="%.1f" fill="%s" '
+                   'fill-opacity="0.8" stroke="%s"%s><title>%s: offset %d, %d B, '
+                   'ops %d-%d</title></rect>' % (
+                       x, top, w, h, color, '#000' if b['offline'] else '#fff',
+                       ' stroke-dasharray="3,2"' if b['offline'] else '',
+                       html.escape(label(b)), b['offset'], b['bytes'],
+                       b['first_op'], b['last_op']))
+        if h >= 12:
+            out.append('<text x="%d" y="%.1f" fill="#fff">%s</text>'
+                       % (x + 3, top + 12, html.escape(label(b)[:max(w // 7, 1)])))
+
+    # Live bytes per operator down the right-hand side
+    legend_x = MARGIN_LEFT + ops * OP_WIDTH + 12
+    out.append('<text x="%d" y="%d">live bytes per op</text>' % (legend_x, MARGIN_TOP + 10))
+    for op, live in enumerate(summary['live']):
+        out.append('<text x="%d" y="%d">op %d: %d%s</text>' % (
+            legend_x, MARGIN_TOP + 26 + 14 * op, op, live,
+            ' (peak)' if op == summary['peak_op'] else ''))
+    out.append('</svg>')
+    return '\n'.join(out) + '\n'
+
+
+def file_stem(name, quantization):
+    return '%s_%s_plan' % (name, quantization)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('log', help='serial log containing CSV_PLAN lines')
+    parser.add_argument('--output-dir', default='arena_plans',
+                        help='directory for one SVG per model')
+    args = parser.parse_args()
+
+    plans = parse_log(args.log)
+    if not plans:
+        raise SystemExit('%s: no CSV_PLAN lines (is kDumpArenaPlan set?)' % args.log)
+
+    os.makedirs(args.output_dir, exist_ok=True)
+    print('%-22s %6s %9s %9s %9s %6s' % ('model', 'bufs', 'planned', 'peak', 'gaps', 'gap%'))
+    for (name, quantization), buffers in sorted(plans.items()):
+        summary = summarize(buffers)
+        title = '%s (%s)' % (name, quantization)
+        path = os.path.join(args.output_dir, file_stem(name, quantization) + '.svg')
+        with open(path, 'w') as f:
+            f.write(render_svg(title, buffers, summary))
+        gap_pct = 100.0 * summary['gaps'] / summary['planned'] if summary['planned'] else 0.0
+        print('%-22s %6d %9d %9d %9d %5.1f%%' % (
+            title, len(buffers), summary['planned'], summary['peak'],
+            summary['gaps'], gap_pct))
+    print('SVGs written to %s' % args.output_dir)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())